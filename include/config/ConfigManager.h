@@ -21,6 +21,23 @@ static constexpr uint8_t LCD_SPI_MODE = 0;
 static constexpr uint32_t LCD_SPI_HZ = 40000000;
 static constexpr int8_t LCD_BACKLIGHT_GPIO = 5;
 static constexpr bool LCD_BACKLIGHT_ACTIVE_LOW = true;
+static constexpr uint8_t LCD_BACKLIGHT_LEVEL = 100;
+static constexpr int8_t LCD_GAMMA = 0;
+static constexpr int8_t LCD_CONTRAST = 0;
+
+// Colour effect defaults (identity)
+static constexpr uint8_t FX_BRIGHTNESS = 100;
+static constexpr int8_t FX_TEMPERATURE = 0;
+static constexpr bool FX_GREYSCALE = false;
+static constexpr uint8_t FX_BRIGHTNESS_MAX = 100;
+static constexpr int8_t FX_TEMPERATURE_MAX = 100;
+
+// Clock time source defaults
+static constexpr const char* NTP_SERVER = "pool.ntp.org";
+static constexpr const char* TIMEZONE = "UTC0";
+
+// Remote frame stream UDP port, 0 disables it
+static constexpr uint16_t STREAM_PORT = 4210;
 
 class ConfigManager {
    public:
@@ -44,6 +61,17 @@ class ConfigManager {
     uint32_t getLCDSpiHz() const;
     int8_t getLCDBacklightGpio() const;
     bool getLCDBacklightActiveLow() const;
+    uint8_t getLCDBacklightLevel() const;
+    int8_t getLCDGamma() const;
+    int8_t getLCDContrast() const;
+    void setLCDPanelProfile(uint8_t backlightLevel, int8_t gamma, int8_t contrast);
+    uint8_t getFxBrightness() const;
+    int8_t getFxTemperature() const;
+    bool getFxGreyscale() const;
+    void setFx(uint8_t brightness, int8_t temperature, bool greyscale);
+    const char* getNtpServer() const;
+    const char* getTimezone() const;
+    uint16_t getStreamPort() const;
 
    public:
     bool getLCDEnableSafe() const { return lcd_enable; }
@@ -83,6 +111,15 @@ class ConfigManager {
     uint32_t lcd_spi_hz = 40000000;
     int8_t lcd_backlight_gpio = 5;
     bool lcd_backlight_active_low = true;
+    uint8_t lcd_backlight_level = LCD_BACKLIGHT_LEVEL;
+    int8_t lcd_gamma = LCD_GAMMA;
+    int8_t lcd_contrast = LCD_CONTRAST;
+    uint8_t fx_brightness = FX_BRIGHTNESS;
+    int8_t fx_temperature = FX_TEMPERATURE;
+    bool fx_greyscale = FX_GREYSCALE;
+    std::string ntp_server = NTP_SERVER;
+    std::string time_zone = TIMEZONE;
+    uint16_t stream_port = STREAM_PORT;
 };
 
 #endif  // CONFIG_MANAGER_H
@@ -0,0 +1,30 @@
+#ifndef SRC_DISPLAY_BLEND565_H
+#define SRC_DISPLAY_BLEND565_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @class Blend565
+ * @brief Line kernels mixing two RGB565 sources, two pixels per 32 bit operation
+ *
+ * The LX106 has no SIMD, so pixel pairs are packed in one register and the colour fields are spread apart with masks
+ * (SWAR) leaving enough headroom between them for a 5 bit weight multiply. Lines are expected 4 byte aligned, an odd
+ * trailing pixel is handled on its own. Plain C++ without the Arduino core, tested on the host (test/test_blend565)
+ */
+class Blend565 {
+   public:
+    static constexpr uint8_t ALPHA_MAX = 32;
+    static constexpr uint8_t DISSOLVE_LEVELS = 16;
+
+    static auto blend(uint16_t from, uint16_t to, uint8_t alpha) -> uint16_t;
+    static auto blendPair(uint32_t from, uint32_t to, uint8_t alpha) -> uint32_t;
+
+    static auto crossfade(uint16_t* dst, const uint16_t* from, const uint16_t* to, size_t count, uint8_t alpha)
+        -> void;
+    static auto wipe(uint16_t* dst, const uint16_t* from, const uint16_t* to, size_t count, size_t split) -> void;
+    static auto dissolve(uint16_t* dst, const uint16_t* from, const uint16_t* to, size_t count, uint16_t row,
+                         uint8_t level) -> void;
+};
+
+#endif  // SRC_DISPLAY_BLEND565_H
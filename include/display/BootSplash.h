@@ -0,0 +1,2064 @@
+// Generated by scripts/splash_gen.py, do not edit
+// Source: built-in artwork
+#ifndef SRC_DISPLAY_BOOTSPLASH_H
+#define SRC_DISPLAY_BOOTSPLASH_H
+
+#include <Arduino.h>
+
+static constexpr uint16_t BOOT_SPLASH_BG = 0x0000;
+static constexpr uint16_t BOOT_SPLASH_W = 128;
+static constexpr uint16_t BOOT_SPLASH_H = 128;
+
+// RGB565 big endian, upright: the panel rotation is applied by MADCTL when it is drawn
+static const uint8_t BOOT_SPLASH_DATA[32768] PROGMEM __attribute__((aligned(4))) = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xBF,
+    0x5E, 0x5F, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF,
+    0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xBF, 0xEF, 0xBF,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0xEF, 0xBF,
+    0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0xEF, 0xBF, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xBF, 0xEF, 0xBF,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0xEF, 0xBF,
+    0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xBF,
+    0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0xEF, 0xBF, 0xEF, 0xBF,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xBF, 0xEF, 0xBF,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0xEF, 0xBF,
+    0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0xEF, 0xBF, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xBF, 0xEF, 0xBF,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0xEF, 0xBF,
+    0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xBF,
+    0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0xEF, 0xBF, 0xEF, 0xBF,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF, 0xEF, 0xBF,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0xEF, 0xBF,
+    0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0xEF, 0xBF, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF, 0xEF, 0xBF,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0xEF, 0xBF,
+    0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0xEF, 0xBF, 0xEF, 0xBF,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF, 0xEF, 0xBF,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0xEF, 0xBF,
+    0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0xEF, 0xBF, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF, 0xEF, 0xBF,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0xEF, 0xBF,
+    0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x5E, 0x5F, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x5E, 0x5F,
+    0x5E, 0x5F, 0x5E, 0x5F, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF,
+    0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF, 0xEF, 0xBF,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xBF,
+    0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xBF, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xBF,
+    0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xBF, 0xEF, 0xBF,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF, 0xEF, 0xBF,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xBF,
+    0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF,
+    0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79,
+    0x1B, 0x79, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xBF, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xBF,
+    0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0x1B, 0x79, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF,
+    0xEF, 0xBF, 0x1B, 0x79, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF,
+    0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xBF, 0xEF, 0xBF,
+    0xEF, 0xBF, 0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+#endif  // SRC_DISPLAY_BOOTSPLASH_H
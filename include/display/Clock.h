@@ -0,0 +1,42 @@
+#ifndef SRC_DISPLAY_CLOCK_H
+#define SRC_DISPLAY_CLOCK_H
+
+#include <Arduino.h>
+#include <Arduino_GFX_Library.h>
+#include <array>
+#include <ctime>
+
+/**
+ * @class Clock
+ * @brief HH:MM clock face drawn from the digit sprites of ClockFont.h
+ *
+ * The time is read a few times per second but a glyph is only decoded and blitted when its slot changes: one digit per
+ * minute most of the time plus the blinking colon, so the clock costs next to nothing next to the web server. The date
+ * line is redrawn once per day. Until SNTP has answered the digits show dashes
+ */
+class Clock {
+   public:
+    auto start() -> bool;
+    auto stop() -> void;
+    auto update() -> bool;
+    auto isRunning() const -> bool;
+    auto getBlits() const -> uint32_t;
+
+   private:
+    static constexpr uint8_t SLOT_COUNT = 5;
+    static constexpr uint8_t GLYPH_BLANK = 0xFE;
+    static constexpr uint8_t GLYPH_UNKNOWN = 0xFF;
+
+    Arduino_TFT* m_tft = nullptr;
+    bool m_running = false;
+    uint32_t m_lastPollMs = 0;
+    time_t m_lastSecond = 0;
+    uint32_t m_blits = 0;
+    int m_shownDay = -1;
+    std::array<uint8_t, SLOT_COUNT> m_shown{};
+
+    auto drawSlot(uint8_t slot, uint8_t glyph) -> void;
+    auto drawDate(const struct tm& now) -> void;
+};
+
+#endif  // SRC_DISPLAY_CLOCK_H
@@ -0,0 +1,466 @@
+// Generated by scripts/clock_font_gen.py, do not edit
+// Colours: E0F0FF lit, 181C24 unlit, 000000 background
+#ifndef SRC_DISPLAY_CLOCKFONT_H
+#define SRC_DISPLAY_CLOCKFONT_H
+
+#include <Arduino.h>
+#include <array>
+
+static constexpr uint16_t CLOCK_DIGIT_W = 48;
+static constexpr uint16_t CLOCK_DIGIT_H = 88;
+static constexpr uint16_t CLOCK_COLON_W = 24;
+static constexpr uint8_t CLOCK_GLYPH_COUNT = 12;
+
+// Glyph order: 0-9, ':', '-'
+static constexpr uint8_t CLOCK_GLYPH_COLON = 10;
+static constexpr uint8_t CLOCK_GLYPH_DASH = 11;
+
+// Byte offset of each glyph in CLOCK_GLYPH_DATA, the last entry is the total size
+static constexpr std::array<uint16_t, 13> CLOCK_GLYPH_OFFSETS = {0, 605, 1165, 1791, 2422, 3021, 3647, 4280, 4870, 5521, 6148, 6487, 7050};
+
+// One 4 bit palette GMI asset per glyph
+static const uint8_t CLOCK_GLYPH_DATA[7050] PROGMEM __attribute__((aligned(4))) = {
+    0x47, 0x4D, 0x49, 0x4D, 0x01, 0x02, 0x30, 0x00, 0x58, 0x00, 0x10, 0x00, 0x08, 0x04, 0x00, 0x00,
+    0xFF, 0xEF, 0xBF, 0xE7, 0x9F, 0xE7, 0x9F, 0xE7, 0x9F, 0xE7, 0x7F, 0xDF, 0x7F, 0xDF, 0x7F, 0xDF,
+    0x1E, 0xD7, 0xB8, 0xAD, 0x0D, 0x5B, 0xE4, 0x18, 0x82, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x80, 0x0F, 0xDE, 0x05, 0x40, 0x03, 0x7F, 0x81, 0x31, 0xEE, 0xFE, 0x73, 0x00, 0x15, 0xCF,
+    0xF7, 0x08, 0x1F, 0xBF, 0x97, 0xC4, 0x00, 0x2A, 0xF3, 0xFD, 0x1F, 0x37, 0xB7, 0xF3, 0x02, 0x88,
+    0x80, 0x2A, 0x41, 0x9F, 0xEF, 0x0B, 0x9B, 0x21, 0x75, 0xAA, 0x80, 0x2A, 0xAF, 0x09, 0x18, 0x2F,
+    0xB7, 0xB3, 0x07, 0x99, 0x80, 0x32, 0xE1, 0x9D, 0x18, 0x1F, 0xFB, 0xDF, 0xFA, 0x82, 0x54, 0xC2,
+    0xD7, 0x35, 0xA0, 0x6B, 0xC2, 0x62, 0x5D, 0x3D, 0x7E, 0x82, 0x8F, 0x66, 0x00, 0x55, 0xD2, 0x15,
+    0xFA, 0x30, 0x91, 0x74, 0x80, 0xE3, 0x00, 0x00, 0x60, 0x9C, 0x4C, 0x25, 0xEE, 0xFC, 0xC1, 0xC6,
+    0xE3, 0xA9, 0xCC, 0x80, 0x2B, 0x34, 0x57, 0x1B, 0x86, 0x7F, 0xDD, 0xDD, 0xC8, 0x5C, 0xEA, 0x90,
+    0xA7, 0x75, 0x80, 0x07, 0x41, 0x45, 0x9B, 0xC2, 0x7B, 0xBF, 0xCB, 0x95, 0x4C, 0x0A, 0x40, 0x0C,
+    0x14, 0x8C, 0xD6, 0x4F, 0xCF, 0xFE, 0x60, 0x6A, 0x73, 0x62, 0x70, 0x8B, 0xAC, 0xE0, 0x36, 0x39,
+    0xAC, 0x60, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F,
+    0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B,
+    0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2,
+    0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0x9B,
+    0x95, 0x4E, 0x6E, 0x17, 0xFB, 0x9C, 0xD6, 0x4F, 0xCF, 0xEE, 0x81, 0x46, 0xA9, 0x0A, 0xFF, 0x05,
+    0xEF, 0xDF, 0xA0, 0xA2, 0x8A, 0x47, 0xBB, 0xEE, 0xFC, 0xC1, 0xE8, 0x1A, 0xFE, 0x5F, 0x30, 0x01,
+    0x5B, 0xCF, 0xD4, 0x12, 0xE1, 0x9F, 0xF7, 0x7F, 0x86, 0xC3, 0x0A, 0xFE, 0x6E, 0xC0, 0x19, 0xCF,
+    0xD0, 0x16, 0x07, 0xDF, 0xFF, 0xF6, 0xFE, 0x45, 0xC2, 0x17, 0xD1, 0x80, 0xE7, 0xFB, 0xC4, 0xE1,
+    0xFF, 0x7B, 0xC5, 0xDC, 0x30, 0x20, 0x98, 0x9F, 0xCC, 0x2F, 0xE1, 0x71, 0x4F, 0x9F, 0xF7, 0xF5,
+    0xBF, 0x23, 0xFF, 0xEF, 0x5F, 0xDF, 0x17, 0x16, 0x83, 0x16, 0x77, 0xFD, 0xC4, 0x28, 0x60, 0x22,
+    0xE1, 0x83, 0xC6, 0x06, 0x1A, 0x2E, 0x1C, 0x0D, 0xC0, 0x60, 0x3D, 0xE6, 0x28, 0xD8, 0x71, 0x7F,
+    0xDE, 0xE8, 0x02, 0xBB, 0xFB, 0x88, 0xB3, 0xA4, 0x7D, 0xBF, 0xCB, 0x8D, 0x4D, 0xBA, 0x26, 0x73,
+    0x00, 0x43, 0x40, 0x6E, 0x73, 0x58, 0xBF, 0x3F, 0xF9, 0x82, 0xA9, 0xCD, 0x82, 0xFF, 0x63, 0x9A,
+    0xCA, 0x02, 0xE3, 0x81, 0x0B, 0xF8, 0x5C, 0xE3, 0x01, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17,
+    0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85,
+    0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1,
+    0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8,
+    0x5F, 0xC2, 0xFE, 0x17, 0x1B, 0x95, 0x4E, 0x6F, 0x09, 0xEE, 0x80, 0x33, 0x21, 0x73, 0x9A, 0xC9,
+    0xF9, 0xE0, 0x52, 0xAA, 0x42, 0x85, 0xD6, 0x00, 0x1D, 0x05, 0x14, 0x52, 0x5E, 0xEF, 0xCC, 0x1E,
+    0x81, 0xAF, 0xD4, 0xE6, 0x40, 0x15, 0x9A, 0xFD, 0x41, 0x2E, 0x19, 0xFF, 0x77, 0xF8, 0x9C, 0x30,
+    0xAF, 0xD4, 0x00, 0x01, 0x9A, 0xFD, 0x01, 0xC0, 0x7D, 0xFF, 0xFF, 0x6F, 0xE4, 0x0E, 0x34, 0x7B,
+    0x30, 0x02, 0xAE, 0x82, 0x71, 0xCF, 0xF7, 0x89, 0xA3, 0xFE, 0xF7, 0x8D, 0xC6, 0xA7, 0x33, 0x00,
+    0x54, 0xD4, 0xAE, 0x21, 0x31, 0x33, 0x17, 0xB7, 0xB3, 0x07, 0x0B, 0x58, 0x00, 0x6E, 0x19, 0xD1,
+    0x71, 0x0C, 0x08, 0xC2, 0x37, 0x5A, 0xA8, 0x02, 0xAA, 0xE5, 0xD3, 0x00, 0x19, 0x84, 0x60, 0x51,
+    0x10, 0x05, 0x48, 0x0B, 0xA6, 0x30, 0x5C, 0xBE, 0x20, 0x01, 0x57, 0x91, 0x73, 0x00, 0x07, 0xDD,
+    0xFC, 0xE6, 0x00, 0x2B, 0x9F, 0xEE, 0x70, 0xC0, 0x81, 0xC7, 0xCA, 0x05, 0x40, 0x47, 0x4D, 0x49,
+    0x4D, 0x01, 0x02, 0x30, 0x00, 0x58, 0x00, 0x10, 0x00, 0x08, 0x04, 0x00, 0x00, 0xDF, 0xEF, 0x9F,
+    0xE7, 0x7F, 0xDF, 0xB8, 0xAD, 0xE4, 0x18, 0xE4, 0x18, 0xE4, 0x18, 0xE4, 0x18, 0xE4, 0x18, 0xC4,
+    0x10, 0xA3, 0x10, 0x82, 0x08, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x3C,
+    0x01, 0x7F, 0xCE, 0xE8, 0x02, 0xB9, 0xE1, 0x79, 0xDB, 0xE6, 0x40, 0x15, 0x7B, 0x0B, 0x47, 0xEE,
+    0x8F, 0x66, 0x00, 0x55, 0xD3, 0x7E, 0x17, 0x7D, 0xA6, 0x1E, 0xEE, 0x00, 0xAB, 0xC5, 0x2C, 0x2A,
+    0xBF, 0xEE, 0xDD, 0x20, 0x2D, 0x60, 0x01, 0xC2, 0x6F, 0x7B, 0xE4, 0x65, 0xAB, 0x85, 0xF6, 0xEB,
+    0xBF, 0xFE, 0x86, 0x0F, 0xF7, 0xBF, 0xDA, 0xDE, 0x02, 0xD7, 0x87, 0xA5, 0xFD, 0x27, 0xFD, 0xD2,
+    0xE9, 0xD6, 0xFF, 0x75, 0x4A, 0x20, 0x02, 0xF7, 0xF4, 0x08, 0x1F, 0xF0, 0x60, 0x3F, 0xBA, 0x40,
+    0xDC, 0x77, 0x5A, 0xA0, 0x05, 0x6A, 0xFE, 0x90, 0x19, 0x00, 0xC0, 0x7F, 0xA8, 0xC2, 0x40, 0x30,
+    0x01, 0xBB, 0xF4, 0x08, 0x94, 0x4A, 0x07, 0xCC, 0xFE, 0xDD, 0x8A, 0x23, 0x4A, 0x0B, 0xEC, 0xC2,
+    0x42, 0x18, 0x13, 0xD0, 0xE5, 0x82, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B,
+    0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2,
+    0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0,
+    0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC,
+    0x2F, 0xE1, 0x7F, 0x0B, 0xF5, 0xD8, 0x2F, 0xE1, 0x76, 0xDA, 0x61, 0xEE, 0xF4, 0xB0, 0xBE, 0xD0,
+    0x02, 0xC3, 0x03, 0xE6, 0x7F, 0xFF, 0x74, 0x8B, 0xAE, 0xFF, 0x75, 0xAA, 0x00, 0x56, 0xAF, 0xE9,
+    0x01, 0x90, 0x4F, 0xFB, 0xA1, 0xF1, 0xDA, 0x56, 0xFF, 0x75, 0x4A, 0x20, 0x02, 0xF7, 0xF4, 0x08,
+    0x1F, 0xF3, 0xBE, 0x17, 0x1F, 0xDE, 0xFF, 0x6B, 0x78, 0x31, 0x88, 0x02, 0x70, 0xF4, 0xBF, 0xA0,
+    0xB8, 0xC3, 0x05, 0x57, 0x0B, 0x58, 0x00, 0x4A, 0xE3, 0xFD, 0x17, 0x10, 0x5C, 0xA9, 0x01, 0x7D,
+    0xC2, 0x6B, 0xFF, 0x81, 0x52, 0xFF, 0x7E, 0xF9, 0xE9, 0x22, 0x00, 0x5D, 0x2B, 0xE9, 0x4F, 0xE7,
+    0x85, 0xC7, 0xDF, 0xB4, 0xCE, 0x7E, 0xE8, 0xF6, 0x60, 0x05, 0x5D, 0x35, 0xF4, 0x28, 0x20, 0xC0,
+    0x8B, 0xA3, 0x59, 0xE7, 0xEE, 0x73, 0x20, 0x0A, 0xCD, 0x7D, 0x24, 0x12, 0x0A, 0x79, 0x80, 0x76,
+    0xA6, 0x71, 0xCE, 0x7F, 0x3B, 0xA0, 0x0A, 0xE7, 0xD0, 0xA0, 0x52, 0x18, 0x27, 0x73, 0xFB, 0x86,
+    0x28, 0x13, 0xBF, 0x66, 0x12, 0x18, 0x94, 0x09, 0x24, 0x39, 0x60, 0xBF, 0x85, 0xCE, 0x24, 0x17,
+    0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85,
+    0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1,
+    0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8,
+    0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xCD, 0xD8, 0x2F, 0xE1,
+    0x76, 0xDA, 0x61, 0xEE, 0xF4, 0xB0, 0xBE, 0xD0, 0x02, 0xC3, 0x03, 0xE6, 0x7F, 0xFF, 0x74, 0x8B,
+    0xAE, 0xFF, 0x75, 0xAA, 0x00, 0x56, 0xAF, 0xE9, 0x01, 0x90, 0x4F, 0xFB, 0xA1, 0xF1, 0xDA, 0x56,
+    0xFF, 0x75, 0x4A, 0x20, 0x02, 0xF7, 0xF4, 0x08, 0x1F, 0xF3, 0xBE, 0x17, 0x1F, 0xDE, 0xFF, 0x6B,
+    0x78, 0x31, 0x88, 0x02, 0x70, 0xF4, 0xBF, 0xA0, 0xB8, 0xC3, 0x05, 0x57, 0x0B, 0x58, 0x00, 0x4A,
+    0xE3, 0xFD, 0x17, 0x17, 0xFF, 0xFD, 0xDB, 0xA4, 0x05, 0xF7, 0x09, 0xBD, 0x0B, 0x18, 0x00, 0x92,
+    0x44, 0x00, 0xAB, 0xC2, 0x7A, 0x3F, 0x74, 0x7B, 0x30, 0x02, 0xAE, 0x9B, 0xF5, 0x94, 0x6D, 0xF3,
+    0x20, 0x0A, 0xBD, 0xB2, 0xA7, 0xF9, 0xDD, 0x00, 0x57, 0x3D, 0xCB, 0x80, 0x0F, 0x47, 0x4D, 0x49,
+    0x4D, 0x01, 0x02, 0x30, 0x00, 0x58, 0x00, 0x10, 0x00, 0x08, 0x04, 0x00, 0x00, 0xFF, 0xEF, 0xBF,
+    0xE7, 0x9F, 0xE7, 0x9F, 0xE7, 0x7F, 0xDF, 0x7B, 0xBE, 0x8B, 0x4A, 0xE4, 0x18, 0xE4, 0x18, 0xE4,
+    0x18, 0xC4, 0x10, 0x82, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x0F,
+    0xBE, 0x05, 0x40, 0x03, 0x7F, 0x41, 0x31, 0xDD, 0xFD, 0xEE, 0xC0, 0x15, 0xBF, 0xEE, 0x88, 0x1F,
+    0x9F, 0x54, 0xA2, 0x00, 0x2A, 0x8B, 0xFC, 0x1F, 0x37, 0x73, 0xEB, 0x02, 0x88, 0x80, 0x2A, 0x41,
+    0x5F, 0xE6, 0x8B, 0x9A, 0xA0, 0x2E, 0xB0, 0x00, 0xC1, 0x46, 0x0B, 0xFC, 0xE2, 0xC1, 0x26, 0x60,
+    0x0C, 0xA0, 0x57, 0x06, 0x09, 0xFD, 0xEB, 0x40, 0xE8, 0x61, 0x6B, 0x9A, 0x4C, 0x2D, 0xFF, 0xD1,
+    0x81, 0xFE, 0xF7, 0xF6, 0x09, 0xA1, 0x1A, 0xE8, 0x70, 0x6F, 0xB1, 0x85, 0x36, 0xF7, 0xBF, 0xB4,
+    0x00, 0x01, 0x96, 0xFB, 0x01, 0x84, 0xFF, 0x77, 0x9C, 0x3E, 0xFE, 0xCB, 0x55, 0x00, 0x55, 0x5B,
+    0xED, 0x03, 0xA0, 0x57, 0xFB, 0xBF, 0xDD, 0xBE, 0x63, 0x11, 0x7B, 0x77, 0x58, 0x00, 0x4A, 0xC3,
+    0x34, 0x82, 0xF3, 0x3F, 0x98, 0x7C, 0x46, 0x22, 0xF5, 0xCC, 0x00, 0x65, 0x42, 0x87, 0x34, 0x92,
+    0x6F, 0xFF, 0x9A, 0x70, 0xB9, 0x0B, 0xB1, 0x9C, 0x21, 0x71, 0x8A, 0x05, 0xFC, 0x2F, 0xE1, 0x7F,
+    0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F,
+    0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17,
+    0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85,
+    0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xF3, 0x87, 0x0B, 0x97, 0x30, 0x01, 0x81, 0x72,
+    0x92, 0x6F, 0xFF, 0xBB, 0x7C, 0xC6, 0x22, 0xF6, 0x2F, 0xCF, 0xFD, 0x82, 0x69, 0x34, 0x82, 0xF3,
+    0x3F, 0xFF, 0xBB, 0xCE, 0x1F, 0x7F, 0x65, 0xAA, 0x80, 0x2A, 0xAD, 0xF6, 0x81, 0xD0, 0x2B, 0xFD,
+    0xD0, 0xF0, 0xED, 0xEF, 0x7F, 0x68, 0x00, 0x03, 0x2D, 0xF6, 0x08, 0x2F, 0xF3, 0xBE, 0x17, 0x1F,
+    0xDE, 0xFC, 0x70, 0x34, 0x40, 0x05, 0x50, 0xE0, 0xDF, 0x6A, 0xFF, 0x34, 0x9C, 0x5F, 0xCE, 0x34,
+    0x0E, 0x87, 0x33, 0x00, 0x54, 0xD2, 0x61, 0x6F, 0xFE, 0x8B, 0x89, 0x2E, 0x3F, 0x58, 0x20, 0x5A,
+    0xC0, 0x03, 0x40, 0xAE, 0x0B, 0x93, 0xED, 0x6F, 0xA8, 0x11, 0xAC, 0x00, 0x25, 0xD1, 0xDF, 0xFB,
+    0xC5, 0xC5, 0x60, 0xA3, 0xFD, 0x60, 0x51, 0x10, 0x05, 0x48, 0x2B, 0xFC, 0x9B, 0xDF, 0xF8, 0x5C,
+    0x50, 0x48, 0xA5, 0xFE, 0xA8, 0x2E, 0xBA, 0x2B, 0xA8, 0x57, 0x23, 0xFF, 0xE6, 0xA3, 0x06, 0x83,
+    0x47, 0xFD, 0xEE, 0xC0, 0x15, 0xBF, 0xE4, 0x5E, 0x1D, 0x25, 0xFB, 0xA0, 0xBD, 0x46, 0x0A, 0x7E,
+    0x30, 0x04, 0x7F, 0x74, 0xF8, 0x8C, 0x45, 0xE7, 0x9F, 0xFB, 0xA1, 0x05, 0xCB, 0xF9, 0xDD, 0x00,
+    0x57, 0x7C, 0x2E, 0x57, 0xA0, 0xB8, 0x8B, 0xCF, 0xF8, 0x2F, 0xBF, 0xF8, 0x5F, 0xC2, 0xFE, 0x17,
+    0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85,
+    0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1,
+    0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8,
+    0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xD6, 0x84, 0x17, 0x2E, 0x60, 0x03, 0x02, 0xE5, 0x78,
+    0xE7, 0xF3, 0x2A, 0x14, 0x3A, 0x1C, 0x18, 0x5D, 0x9F, 0xFD, 0xBE, 0x23, 0x13, 0x7B, 0xEF, 0xF7,
+    0x7E, 0xB0, 0x49, 0x85, 0xBE, 0xCB, 0x55, 0x00, 0x55, 0x5B, 0xF7, 0x78, 0xCB, 0xEF, 0xFF, 0xFF,
+    0xDE, 0x7D, 0x42, 0x0D, 0xF6, 0x80, 0x00, 0x32, 0xDF, 0xB7, 0xBD, 0x8D, 0x4B, 0xB9, 0xF5, 0xB7,
+    0xD8, 0x26, 0x94, 0x40, 0x05, 0x15, 0x87, 0xF6, 0x2E, 0x10, 0x00, 0xFF, 0x7B, 0xFF, 0x68, 0x1D,
+    0x0E, 0x66, 0x00, 0xA9, 0xA4, 0xC2, 0xDB, 0xDF, 0x33, 0x1F, 0x73, 0x8B, 0x04, 0x0B, 0x58, 0x00,
+    0x68, 0x15, 0xCE, 0x78, 0x5C, 0xCC, 0x24, 0x46, 0xB0, 0x00, 0xB3, 0x84, 0x5E, 0x86, 0x12, 0x81,
+    0x44, 0x40, 0x15, 0x20, 0xAF, 0xF3, 0x55, 0xEA, 0x30, 0x1A, 0xA0, 0xBA, 0xE8, 0xA2, 0xE6, 0x00,
+    0x0F, 0x77, 0xF7, 0xBB, 0x00, 0x56, 0xFF, 0xBA, 0xE1, 0x81, 0x03, 0x8F, 0x94, 0x0A, 0x80, 0x47,
+    0x4D, 0x49, 0x4D, 0x01, 0x02, 0x30, 0x00, 0x58, 0x00, 0x10, 0x00, 0x08, 0x04, 0x00, 0x00, 0xFF,
+    0xEF, 0xBF, 0xE7, 0x9F, 0xE7, 0x9F, 0xE7, 0x7F, 0xDF, 0x7B, 0xBE, 0x8B, 0x4A, 0xE4, 0x18, 0xE4,
+    0x18, 0xE4, 0x18, 0xC4, 0x10, 0x82, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x80, 0x0F, 0xBE, 0x05, 0x40, 0x03, 0x7F, 0x41, 0x31, 0xDD, 0xFD, 0xEE, 0xC0, 0x15, 0xBF, 0xEE,
+    0x88, 0x1F, 0x9F, 0x54, 0xA2, 0x00, 0x2A, 0x8B, 0xFC, 0x1F, 0x37, 0x73, 0xEB, 0x02, 0x88, 0x80,
+    0x2A, 0x41, 0x5F, 0xE6, 0x8B, 0x9A, 0xA0, 0x2E, 0xB0, 0x00, 0xC1, 0x46, 0x0B, 0xFC, 0xE2, 0xC1,
+    0x26, 0x60, 0x0C, 0xA0, 0x57, 0x06, 0x09, 0xFD, 0xEB, 0x40, 0xE8, 0x61, 0x6B, 0x9A, 0x4C, 0x2D,
+    0xFF, 0xD1, 0x81, 0xFE, 0xF7, 0xF6, 0x09, 0xA1, 0x1A, 0xE8, 0x70, 0x6F, 0xB1, 0x85, 0x36, 0xF7,
+    0xBF, 0xB4, 0x00, 0x01, 0x96, 0xFB, 0x01, 0x84, 0xFF, 0x77, 0x9C, 0x3E, 0xFE, 0xCB, 0x55, 0x00,
+    0x55, 0x5B, 0xED, 0x03, 0xA0, 0x57, 0xFB, 0xBF, 0xDD, 0xBE, 0x63, 0x11, 0x7B, 0x77, 0x58, 0x00,
+    0x4A, 0xC3, 0x34, 0x82, 0xF3, 0x3F, 0x98, 0x7C, 0x46, 0x22, 0xF5, 0xCC, 0x00, 0x65, 0x42, 0x87,
+    0x34, 0x92, 0x6F, 0xFF, 0x9A, 0x70, 0xB9, 0x0B, 0xB1, 0x9C, 0x21, 0x71, 0x8A, 0x05, 0xFC, 0x2F,
+    0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B,
+    0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2,
+    0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0,
+    0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xF3, 0x87, 0x0B, 0x97, 0x30, 0x01,
+    0x81, 0x72, 0x92, 0x6F, 0xFF, 0xBB, 0x7C, 0xC6, 0x22, 0xF6, 0x2F, 0xCF, 0xFD, 0x82, 0x69, 0x34,
+    0x82, 0xF3, 0x3F, 0xFF, 0xBB, 0xCE, 0x1F, 0x7F, 0x65, 0xAA, 0x80, 0x2A, 0xAD, 0xF6, 0x81, 0xD0,
+    0x2B, 0xFD, 0xD0, 0xF0, 0xED, 0xEF, 0x7F, 0x68, 0x00, 0x03, 0x2D, 0xF6, 0x08, 0x2F, 0xF3, 0xBE,
+    0x17, 0x1F, 0xDE, 0xFC, 0x70, 0x34, 0x40, 0x05, 0x50, 0xE0, 0xDF, 0x6A, 0xFF, 0x34, 0x9C, 0x5F,
+    0xDE, 0xB4, 0x0E, 0x87, 0x33, 0x00, 0x54, 0xD2, 0x61, 0x6F, 0xFE, 0x8B, 0x8B, 0xFF, 0xED, 0xE2,
+    0xC1, 0x02, 0xD6, 0x00, 0x12, 0xE8, 0xFF, 0x02, 0xC5, 0xFE, 0xFD, 0xAC, 0x04, 0x8D, 0x60, 0x01,
+    0x82, 0xFD, 0xAD, 0xFC, 0xF0, 0xB8, 0xFB, 0xF6, 0xF9, 0xCF, 0xAC, 0x0A, 0x22, 0x00, 0xA9, 0x05,
+    0x7E, 0xE9, 0x06, 0x18, 0x17, 0xEE, 0xF1, 0x78, 0xE7, 0xD5, 0x05, 0xD7, 0x45, 0xFB, 0xD0, 0x68,
+    0x03, 0x02, 0xDB, 0xE2, 0x30, 0xF8, 0xCF, 0xDE, 0xEC, 0x01, 0x5B, 0xFB, 0xA4, 0x51, 0x24, 0x3D,
+    0xCF, 0xE6, 0x5F, 0x11, 0x88, 0xBD, 0x1F, 0x8C, 0x01, 0x1F, 0xDA, 0x85, 0x0E, 0x69, 0x14, 0xDF,
+    0xFF, 0x34, 0xE1, 0x72, 0xFE, 0xF7, 0x40, 0x14, 0x86, 0x10, 0xB8, 0xC9, 0x02, 0xEA, 0x2E, 0xBF,
+    0xF8, 0x5C, 0xC5, 0xEC, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2,
+    0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0,
+    0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC,
+    0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0x78, 0x70,
+    0xB9, 0x73, 0x00, 0x18, 0x17, 0x29, 0x26, 0xFF, 0xFB, 0xB7, 0xCC, 0x62, 0x2F, 0x62, 0xFC, 0xFF,
+    0xD8, 0x26, 0x93, 0x48, 0x2F, 0x33, 0xFF, 0xFB, 0xBC, 0xE1, 0xF7, 0xF6, 0x5A, 0xA8, 0x02, 0xAA,
+    0xDF, 0x68, 0x1D, 0x02, 0xBF, 0xDD, 0x0F, 0x0E, 0xDE, 0xF7, 0xF6, 0x80, 0x00, 0x32, 0xDF, 0x60,
+    0x82, 0xFF, 0x3B, 0xE1, 0x71, 0xFD, 0xEF, 0xC7, 0x03, 0x44, 0x00, 0x55, 0x0E, 0x0D, 0xF6, 0xAF,
+    0xF3, 0x49, 0xC5, 0xFD, 0xEB, 0x40, 0xE8, 0x73, 0x30, 0x05, 0x4D, 0x26, 0x16, 0xFF, 0xE8, 0xB8,
+    0xBF, 0xFF, 0xCE, 0x2C, 0x10, 0x2D, 0x60, 0x01, 0xA0, 0x57, 0x05, 0xC6, 0x2F, 0x15, 0x80, 0x91,
+    0xAC, 0x00, 0x25, 0xD4, 0x00, 0x17, 0x73, 0xEB, 0x02, 0x88, 0x80, 0x2A, 0x40, 0x5D, 0x41, 0x82,
+    0x55, 0x05, 0xD7, 0x45, 0x17, 0x30, 0x00, 0x7B, 0xBF, 0xBD, 0xD8, 0x02, 0xB7, 0xEB, 0xB2, 0x00,
+    0x30, 0x81, 0xC7, 0xCA, 0x05, 0x40, 0x47, 0x4D, 0x49, 0x4D, 0x01, 0x02, 0x30, 0x00, 0x58, 0x00,
+    0x10, 0x00, 0x08, 0x04, 0x00, 0x00, 0xDF, 0xEF, 0x9F, 0xE7, 0x7F, 0xDF, 0x5F, 0xDF, 0xF9, 0xB5,
+    0x29, 0x3A, 0xE4, 0x18, 0xE4, 0x18, 0xE4, 0x18, 0xE4, 0x18, 0xC4, 0x10, 0x82, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x3C, 0x01, 0x7F, 0xCE, 0x60, 0x02, 0xB9, 0xE1,
+    0x79, 0xDC, 0x6A, 0x80, 0x15, 0x8B, 0x0B, 0x47, 0xEE, 0xD1, 0x77, 0x00, 0x56, 0x1B, 0x7E, 0x17,
+    0x7D, 0xB6, 0x63, 0x10, 0x00, 0xAC, 0x4D, 0xAC, 0xB8, 0xDC, 0xBB, 0x48, 0x5A, 0xC0, 0x03, 0x96,
+    0xDE, 0x18, 0x8F, 0xFB, 0xDF, 0x23, 0x08, 0x5F, 0x49, 0x02, 0x13, 0x10, 0xB8, 0xF7, 0x3E, 0x95,
+    0xFD, 0xB6, 0x24, 0x2D, 0x79, 0x8B, 0x5F, 0xD6, 0x9F, 0xCD, 0x17, 0x0F, 0x3E, 0x81, 0x05, 0xFD,
+    0xD9, 0x80, 0x19, 0xBF, 0xA8, 0x41, 0x3F, 0x9D, 0xFE, 0xEF, 0xD2, 0x07, 0x20, 0xAF, 0xEE, 0xB7,
+    0x60, 0x0A, 0xD5, 0xFD, 0x60, 0x53, 0x0A, 0x7F, 0x77, 0x99, 0x40, 0x98, 0xC8, 0xA0, 0xBF, 0xD7,
+    0x25, 0xF7, 0xEA, 0x12, 0x28, 0x9C, 0x13, 0x99, 0xFB, 0x98, 0xC8, 0x40, 0xA3, 0xFC, 0x0B, 0xD9,
+    0x60, 0x66, 0x31, 0x28, 0x9E, 0xFC, 0x2E, 0x51, 0x20, 0xBF, 0x84, 0x44, 0x2F, 0xE1, 0x7F, 0x0B,
+    0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2,
+    0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0,
+    0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC,
+    0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xC8, 0x9C, 0x13, 0x98, 0x00, 0xCA, 0x04,
+    0xC4, 0x2E, 0x40, 0x52, 0x91, 0x41, 0x45, 0xD6, 0x00, 0x1A, 0x84, 0x88, 0x52, 0x5D, 0xDF, 0xA4,
+    0x0E, 0x41, 0x5F, 0xAA, 0x51, 0x00, 0x15, 0x45, 0xFA, 0xC0, 0xA6, 0x14, 0xFE, 0xEF, 0xF4, 0x9C,
+    0x30, 0x5F, 0xAC, 0x00, 0x01, 0x95, 0xFA, 0x81, 0xC0, 0x7B, 0xFF, 0xFE, 0xE7, 0xD0, 0x0E, 0x32,
+    0x39, 0x10, 0x02, 0xA6, 0x42, 0x71, 0xA7, 0xF3, 0x49, 0xA3, 0xFD, 0xEF, 0x8D, 0xC6, 0x43, 0x11,
+    0x00, 0x54, 0x48, 0xAE, 0x21, 0x31, 0x33, 0x17, 0x73, 0x89, 0x03, 0x0B, 0x58, 0x00, 0x4B, 0xA2,
+    0xB7, 0x3F, 0xF7, 0xEC, 0xC2, 0x33, 0x22, 0x3D, 0xC8, 0xE0, 0x9F, 0x5A, 0xFF, 0x3C, 0x2E, 0x3E,
+    0xFD, 0xB6, 0x73, 0xE9, 0x01, 0x17, 0x5C, 0x42, 0x9F, 0x53, 0x82, 0x8C, 0x0B, 0xF7, 0x68, 0xB4,
+    0x73, 0xE8, 0x73, 0x30, 0x05, 0x4D, 0x3E, 0xB3, 0x03, 0x08, 0x8C, 0x07, 0x6D, 0x88, 0xC3, 0x63,
+    0x3F, 0x7B, 0xB0, 0x05, 0x6F, 0xEA, 0x70, 0x27, 0x48, 0xF7, 0x3F, 0x99, 0x7C, 0x46, 0x22, 0xD4,
+    0x7E, 0x30, 0x04, 0x7F, 0x68, 0x13, 0x18, 0x94, 0x0F, 0x7F, 0xFC, 0xD3, 0x85, 0xC6, 0xD7, 0xFD,
+    0xEE, 0x80, 0x29, 0x0C, 0x32, 0x18, 0x94, 0x4C, 0x2E, 0xA2, 0xEB, 0xFF, 0x85, 0xFC, 0x2F, 0xE1,
+    0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8,
+    0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE,
+    0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF,
+    0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5D, 0xB0, 0xE1, 0x71, 0xB5, 0x05, 0xFA, 0x62, 0x17,
+    0x2F, 0xEE, 0xDB, 0x30, 0x2F, 0xEE, 0xFD, 0x42, 0x45, 0x13, 0x82, 0x73, 0x3F, 0xFF, 0xBB, 0x4E,
+    0x1B, 0x7F, 0xBA, 0xDD, 0x80, 0x2B, 0x57, 0xF5, 0x81, 0x4C, 0x29, 0xFD, 0xD0, 0xF8, 0xED, 0xAD,
+    0x7F, 0xBB, 0x30, 0x03, 0x37, 0xF5, 0x08, 0x27, 0xF3, 0xBE, 0x17, 0x1F, 0xDE, 0xFF, 0x6D, 0x89,
+    0x31, 0x88, 0x02, 0x73, 0x16, 0xBF, 0xAD, 0x3F, 0x9A, 0x50, 0x3F, 0xDD, 0xA0, 0x2D, 0x60, 0x01,
+    0x2B, 0x8F, 0xF4, 0x5C, 0x5F, 0xFF, 0xF7, 0x6E, 0xD2, 0x17, 0xDC, 0xB6, 0xF3, 0x9E, 0x81, 0x54,
+    0x91, 0x00, 0x2B, 0x12, 0x9E, 0x82, 0x40, 0xDD, 0xC0, 0x14, 0x46, 0x15, 0x94, 0x6E, 0x35, 0x40,
+    0x0A, 0xC5, 0xB2, 0xA7, 0xF9, 0xCC, 0x00, 0x51, 0x71, 0x80, 0x1E, 0x00, 0x60, 0x47, 0x4D, 0x49,
+    0x4D, 0x01, 0x02, 0x30, 0x00, 0x58, 0x00, 0x10, 0x00, 0x08, 0x04, 0x00, 0x00, 0xFF, 0xEF, 0xBF,
+    0xE7, 0x9F, 0xE7, 0x9F, 0xE7, 0x7F, 0xDF, 0x7B, 0xBE, 0x8B, 0x4A, 0xE4, 0x18, 0xE4, 0x18, 0xE4,
+    0x18, 0xC4, 0x10, 0x82, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x0F,
+    0xBE, 0x05, 0x40, 0x03, 0x7F, 0x41, 0x31, 0xDD, 0xFD, 0xEE, 0xC0, 0x15, 0xBF, 0xEE, 0x88, 0x1F,
+    0x9F, 0x54, 0xA2, 0x00, 0x2A, 0x8B, 0xFC, 0x1F, 0x37, 0x73, 0xEB, 0x02, 0x88, 0x80, 0x2A, 0x41,
+    0x5F, 0xE6, 0x8B, 0x9A, 0xA0, 0x2E, 0xB0, 0x00, 0xC1, 0x46, 0x0B, 0xDC, 0xE2, 0xC1, 0x26, 0x60,
+    0x0C, 0xA0, 0x57, 0x39, 0xE2, 0xE3, 0xEF, 0xFD, 0xA0, 0x74, 0x30, 0xB5, 0xCD, 0x26, 0x16, 0xD1,
+    0x79, 0x97, 0x46, 0xDF, 0x60, 0x9A, 0x11, 0xAE, 0x87, 0x06, 0xFD, 0xEF, 0xCB, 0xA9, 0x06, 0xFB,
+    0x40, 0x00, 0x19, 0x6F, 0xDB, 0xDE, 0xD7, 0x65, 0xF5, 0x82, 0x4C, 0x2D, 0xF6, 0x5A, 0xA8, 0x02,
+    0xAA, 0xDF, 0xBB, 0xC6, 0x5C, 0x60, 0x3C, 0xCA, 0x85, 0x0C, 0x70, 0x2E, 0xEB, 0x00, 0x0E, 0xDF,
+    0x11, 0x89, 0xBD, 0xF7, 0xFF, 0x74, 0x2A, 0x1C, 0xD2, 0x0B, 0xCC, 0x00, 0x66, 0x9F, 0x11, 0x88,
+    0xBC, 0x73, 0xFF, 0x74, 0x10, 0xB9, 0x7F, 0x05, 0xF8, 0x17, 0x2B, 0xD0, 0x5F, 0xC2, 0xFE, 0x17,
+    0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85,
+    0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1,
+    0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8,
+    0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0x34, 0x20, 0xB9, 0x73, 0x00, 0x18, 0x17,
+    0x2B, 0xC7, 0x3F, 0x99, 0x50, 0xA1, 0xD0, 0xE0, 0xC2, 0xEC, 0xFF, 0xED, 0xF1, 0x18, 0x9B, 0xDF,
+    0x7F, 0xBB, 0xF5, 0x82, 0x4C, 0x2D, 0xF6, 0x5A, 0xA8, 0x02, 0xAA, 0xDF, 0xBB, 0xC6, 0x5F, 0x7F,
+    0xFF, 0xFE, 0xF3, 0xEA, 0x10, 0x6F, 0xB4, 0x00, 0x01, 0x96, 0xFD, 0xBD, 0xEC, 0x6A, 0x5D, 0xCF,
+    0xAD, 0xBE, 0xC1, 0x34, 0xA2, 0x00, 0x28, 0xAC, 0x3F, 0xB1, 0x70, 0x80, 0x07, 0xFB, 0xDF, 0xFB,
+    0x40, 0xE8, 0x73, 0x30, 0x05, 0x4D, 0x26, 0x16, 0xCE, 0x79, 0x98, 0xFB, 0x9C, 0x58, 0x20, 0x5A,
+    0xC0, 0x03, 0x40, 0xAF, 0xAD, 0xCF, 0xFD, 0xFB, 0x30, 0x89, 0x1A, 0xC0, 0x03, 0x05, 0xFB, 0x5B,
+    0xC6, 0x05, 0xEF, 0xDB, 0xE7, 0x3E, 0xB0, 0x28, 0x88, 0x02, 0xA4, 0x15, 0xFB, 0xA4, 0x18, 0x60,
+    0x49, 0x51, 0x62, 0x0D, 0x50, 0x5D, 0x74, 0x5F, 0xBD, 0x06, 0x80, 0x30, 0x26, 0x28, 0xE1, 0xF1,
+    0x9F, 0xBD, 0xD8, 0x02, 0xB7, 0xF7, 0x48, 0xA2, 0x48, 0x7B, 0x9F, 0xCC, 0xBB, 0xD4, 0x6F, 0x5D,
+    0xF7, 0x75, 0xFF, 0x6A, 0x14, 0x39, 0xA4, 0x53, 0x7F, 0xFC, 0xD3, 0x85, 0xCB, 0xFB, 0xDD, 0x00,
+    0x52, 0x18, 0x42, 0xE3, 0x24, 0x0B, 0xA8, 0xBA, 0xFF, 0xE1, 0x73, 0x17, 0xB0, 0x5F, 0xC2, 0xFE,
+    0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF,
+    0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F,
+    0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B,
+    0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBD, 0xE1, 0xC2, 0xE5, 0xCC, 0x00, 0x60, 0x5C, 0xA4, 0x9B,
+    0xFF, 0xEE, 0xDF, 0x31, 0x88, 0xBD, 0x8B, 0xF3, 0xFF, 0x60, 0x9A, 0x4D, 0x20, 0xBC, 0xCF, 0xFF,
+    0xEE, 0xF3, 0x87, 0xDF, 0xD9, 0x6A, 0xA0, 0x0A, 0xAB, 0x7D, 0xA0, 0x74, 0x0A, 0xFF, 0x74, 0x3C,
+    0x3B, 0x7B, 0xDF, 0xDA, 0x00, 0x00, 0xCB, 0x7D, 0x82, 0x0B, 0xFC, 0xEF, 0x85, 0xC7, 0xF7, 0xBF,
+    0x1C, 0x0D, 0x10, 0x01, 0x54, 0x38, 0x37, 0xDA, 0xBF, 0xCD, 0x27, 0x17, 0xF7, 0xAD, 0x03, 0xA1,
+    0xCC, 0xC0, 0x15, 0x34, 0x98, 0x5B, 0xFF, 0xA2, 0xE2, 0xFF, 0xFF, 0x38, 0xB0, 0x40, 0xB5, 0x80,
+    0x06, 0x81, 0x5C, 0x17, 0x18, 0xBC, 0x56, 0x02, 0x46, 0xB0, 0x00, 0x97, 0x50, 0x00, 0x5D, 0xCF,
+    0xAC, 0x0A, 0x22, 0x00, 0xA9, 0x01, 0x75, 0x06, 0x09, 0x54, 0x17, 0x5D, 0x14, 0x5C, 0xC0, 0x01,
+    0xEE, 0xFE, 0xF7, 0x60, 0x0A, 0xDF, 0xAE, 0xC8, 0x00, 0xC2, 0x07, 0x1F, 0x28, 0x15, 0x00, 0x47,
+    0x4D, 0x49, 0x4D, 0x01, 0x02, 0x30, 0x00, 0x58, 0x00, 0x10, 0x00, 0x08, 0x04, 0x00, 0x00, 0xFF,
+    0xEF, 0xBF, 0xE7, 0x9F, 0xE7, 0x9F, 0xE7, 0x9F, 0xE7, 0x7F, 0xDF, 0x7F, 0xDF, 0x7F, 0xDF, 0x1E,
+    0xD7, 0x97, 0xAD, 0x0D, 0x5B, 0xE4, 0x18, 0x82, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x80, 0x0F, 0xDE, 0x05, 0x40, 0x03, 0x7F, 0x81, 0x31, 0xEE, 0xFE, 0x73, 0x00, 0x15, 0xCF, 0xF7,
+    0x08, 0x1F, 0xBF, 0x97, 0xC4, 0x00, 0x2A, 0xF3, 0xFD, 0x1F, 0x37, 0xB7, 0xF3, 0x02, 0x88, 0x80,
+    0x2A, 0x41, 0x9F, 0xEF, 0x0B, 0x9B, 0x21, 0x75, 0xAA, 0x80, 0x2A, 0xAF, 0x09, 0x18, 0x2F, 0xB7,
+    0xB3, 0x07, 0x99, 0x80, 0x32, 0xE1, 0x9D, 0xEF, 0x8B, 0x8F, 0xDF, 0xFA, 0x82, 0x54, 0xC2, 0xD7,
+    0x35, 0xA0, 0x6B, 0x85, 0xE6, 0x5D, 0x1D, 0x7E, 0x82, 0x8D, 0x66, 0x00, 0x55, 0x92, 0x15, 0xFC,
+    0xE7, 0x97, 0x52, 0x15, 0xFA, 0x80, 0x00, 0x33, 0x5F, 0xCB, 0xDE, 0x2E, 0xCB, 0xF3, 0x07, 0xA0,
+    0x6B, 0xF5, 0x39, 0x90, 0x05, 0x66, 0xBF, 0x9B, 0xBD, 0xD8, 0xC0, 0x7B, 0xB9, 0x0B, 0x9D, 0x52,
+    0x14, 0xEE, 0xB0, 0x00, 0xF2, 0xC2, 0xE3, 0xBC, 0xF7, 0xFF, 0x2E, 0x55, 0x39, 0xB4, 0x27, 0xBA,
+    0x00, 0xC0, 0xB0, 0x80, 0x07, 0xBF, 0xFC, 0xC0, 0x85, 0xCB, 0xFA, 0x2F, 0xF0, 0xBF, 0x85, 0xFC,
+    0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F,
+    0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F,
+    0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17,
+    0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5E, 0xAE, 0x41, 0x72, 0xEE, 0x80, 0x30,
+    0x2C, 0x41, 0x71, 0xEE, 0xE4, 0x2E, 0x75, 0x48, 0x50, 0xBB, 0x05, 0xE7, 0xBC, 0xF7, 0xFB, 0xBF,
+    0x30, 0x7A, 0x06, 0xBF, 0x53, 0x99, 0x00, 0x56, 0x6B, 0xF8, 0x17, 0x1E, 0x7F, 0xFF, 0xFD, 0xDF,
+    0xC8, 0x42, 0xBF, 0x50, 0x00, 0x06, 0x6B, 0xF9, 0x7B, 0xC1, 0xA9, 0x7B, 0x7F, 0x3A, 0xFD, 0x05,
+    0x1A, 0xCC, 0x00, 0xAB, 0x24, 0x2B, 0xF8, 0x2E, 0x10, 0x00, 0xFF, 0xBD, 0xFF, 0xA8, 0x25, 0x4E,
+    0x66, 0x00, 0xA9, 0xAD, 0x03, 0x5B, 0xDF, 0x33, 0x1F, 0x7C, 0xC2, 0x21, 0x6B, 0x00, 0x0D, 0xC3,
+    0x3E, 0xB7, 0x3F, 0xEF, 0xEB, 0x7F, 0x90, 0xBA, 0xD5, 0x40, 0x15, 0x57, 0x84, 0xFE, 0xF5, 0xE3,
+    0x02, 0xEF, 0xE8, 0x2F, 0x7F, 0x98, 0x14, 0x44, 0x01, 0x52, 0x0C, 0xFE, 0xDE, 0x14, 0x30, 0x11,
+    0x70, 0xC1, 0xE3, 0x1B, 0xFC, 0xBE, 0x20, 0x01, 0x57, 0x9F, 0xDE, 0x06, 0xE0, 0x30, 0x1E, 0xF6,
+    0x82, 0x8B, 0x61, 0xC5, 0xFF, 0x39, 0x80, 0x0A, 0xE7, 0xEE, 0x22, 0xCE, 0x91, 0xF6, 0xFF, 0x2E,
+    0x35, 0x39, 0xBC, 0x27, 0xDE, 0xEE, 0xBF, 0xF6, 0x42, 0xE7, 0x35, 0x8B, 0xF3, 0xFF, 0x98, 0x2A,
+    0x9C, 0xDA, 0x13, 0xFD, 0xF7, 0x00, 0x29, 0xD0, 0x36, 0x39, 0xAC, 0xA0, 0x2E, 0x38, 0x10, 0xB9,
+    0x8B, 0xEC, 0x2E, 0x71, 0x80, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE,
+    0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF,
+    0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F,
+    0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B,
+    0x8D, 0xC8, 0x2E, 0x5D, 0xD0, 0x06, 0x05, 0xCA, 0x4F, 0xCF, 0x02, 0x8D, 0xCE, 0xA9, 0x0A, 0x17,
+    0x58, 0x00, 0x74, 0x14, 0x59, 0xB8, 0xA4, 0x7D, 0xDF, 0x98, 0x3D, 0x03, 0x5F, 0xA9, 0xCC, 0x80,
+    0x2B, 0x35, 0xFA, 0x82, 0x5C, 0x33, 0xFE, 0xEF, 0xF1, 0x38, 0x61, 0x5F, 0xA8, 0x00, 0x03, 0x35,
+    0xFA, 0x03, 0x80, 0xFB, 0xFF, 0xFE, 0xDF, 0xC8, 0x1C, 0x68, 0xD6, 0x60, 0x05, 0x59, 0x04, 0xE3,
+    0x9F, 0xEF, 0x13, 0x47, 0xFD, 0xEF, 0x1B, 0x8D, 0x4E, 0x66, 0x00, 0xA9, 0xA9, 0x5C, 0x42, 0x62,
+    0x66, 0x2F, 0x6F, 0x66, 0x0E, 0x16, 0xB0, 0x00, 0xDC, 0x33, 0xA2, 0xE2, 0x18, 0x11, 0x84, 0x6E,
+    0xB5, 0x50, 0x05, 0x55, 0xCB, 0xA6, 0x00, 0x33, 0x08, 0xC0, 0xA2, 0x20, 0x0A, 0x90, 0x17, 0x4C,
+    0x60, 0xB9, 0x7C, 0x40, 0x02, 0xAF, 0x22, 0xE6, 0x00, 0x0F, 0xBB, 0xF9, 0xCC, 0x00, 0x57, 0x3F,
+    0xDC, 0xE1, 0x81, 0x03, 0x8F, 0x94, 0x0A, 0x80, 0x47, 0x4D, 0x49, 0x4D, 0x01, 0x02, 0x30, 0x00,
+    0x58, 0x00, 0x10, 0x00, 0x08, 0x04, 0x00, 0x00, 0xDF, 0xEF, 0x9F, 0xE7, 0x7F, 0xDF, 0x5E, 0xDF,
+    0x56, 0x9D, 0x05, 0x19, 0xE4, 0x18, 0xE4, 0x18, 0xE4, 0x18, 0xC3, 0x10, 0x82, 0x08, 0x41, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x0F, 0xBE, 0x05, 0x40, 0x03, 0x7F,
+    0x41, 0x31, 0xDD, 0xFD, 0x6A, 0x80, 0x15, 0xAF, 0xEE, 0x88, 0x1F, 0x9F, 0x43, 0x99, 0x80, 0x2A,
+    0x69, 0xFC, 0x1F, 0x37, 0x73, 0xE9, 0x01, 0x88, 0x80, 0x2A, 0x21, 0x4F, 0xE6, 0x8B, 0x9A, 0x81,
+    0x22, 0x00, 0x64, 0x10, 0x60, 0xBF, 0xCE, 0x24, 0x0C, 0x5D, 0x60, 0x01, 0x98, 0x53, 0x06, 0x09,
+    0xFD, 0xEA, 0x40, 0xA4, 0x21, 0x6B, 0x89, 0x48, 0x29, 0xFF, 0xD1, 0x81, 0xFE, 0xB5, 0xF5, 0x02,
+    0x3E, 0xC1, 0x7E, 0x86, 0x14, 0xD3, 0x5A, 0xBE, 0xB0, 0x00, 0x06, 0x57, 0xEA, 0x06, 0x13, 0xFD,
+    0x5A, 0x2E, 0xDA, 0xFA, 0xA5, 0x10, 0x01, 0x54, 0x5F, 0xAC, 0x0A, 0x61, 0x4F, 0xEE, 0xFF, 0x74,
+    0xD8, 0x7B, 0xBD, 0xA9, 0xDD, 0x60, 0x01, 0x2B, 0x0C, 0x4A, 0x09, 0xCC, 0xFE, 0x5D, 0xAE, 0xF7,
+    0x7B, 0x4F, 0x30, 0x01, 0x94, 0x09, 0x0C, 0x4A, 0x25, 0xAF, 0xFE, 0x61, 0x82, 0xE4, 0x2E, 0xC6,
+    0x70, 0x85, 0xC6, 0x26, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2,
+    0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0,
+    0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC,
+    0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F,
+    0x0B, 0xCD, 0xD8, 0x2F, 0xE1, 0x73, 0x89, 0x6B, 0xFF, 0xBA, 0x6C, 0x3D, 0xDE, 0xD6, 0x17, 0xCE,
+    0xFD, 0x42, 0x45, 0x12, 0x82, 0x73, 0x3F, 0xFF, 0xAB, 0x45, 0xDB, 0x7F, 0xB9, 0xCC, 0x80, 0x2B,
+    0x35, 0xF5, 0x81, 0x4C, 0x29, 0xFD, 0xD0, 0xF8, 0xE9, 0xAD, 0x7F, 0xBB, 0x30, 0x03, 0x35, 0xF5,
+    0x08, 0x27, 0xF3, 0xBE, 0x17, 0x1F, 0xD6, 0xBF, 0x6D, 0x78, 0x31, 0x88, 0x02, 0x70, 0xF6, 0xAF,
+    0xA5, 0x3F, 0x9A, 0x50, 0x3F, 0xD5, 0x9C, 0x2D, 0x60, 0x01, 0xBB, 0x1D, 0x04, 0x5C, 0x41, 0x72,
+    0xB4, 0x05, 0xF7, 0x0D, 0x9F, 0xFE, 0x05, 0x4B, 0xFD, 0xFB, 0xDF, 0xA4, 0x88, 0x01, 0x76, 0x9F,
+    0xAD, 0x7F, 0x9E, 0x17, 0x1F, 0x7E, 0xDB, 0x16, 0x48, 0x13, 0xB5, 0xDD, 0xB3, 0xF5, 0x38, 0x28,
+    0xC0, 0xBF, 0x76, 0x7B, 0x46, 0xFF, 0x51, 0x98, 0xC4, 0x00, 0x23, 0x13, 0x8A, 0xFA, 0xCC, 0x24,
+    0x03, 0x02, 0xDB, 0x19, 0xC7, 0x17, 0xFC, 0xE6, 0x00, 0x2B, 0x9F, 0x53, 0x81, 0x48, 0xA0, 0xBD,
+    0xCF, 0xE6, 0x18, 0xA0, 0x4E, 0xFC, 0xE7, 0xD0, 0x26, 0x31, 0x28, 0x1E, 0xBC, 0x2F, 0xE1, 0x73,
+    0x90, 0xC4, 0xA2, 0x61, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F,
+    0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B,
+    0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2,
+    0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0,
+    0xBC, 0xDD, 0x82, 0xFE, 0x17, 0x38, 0x96, 0xBF, 0xFB, 0xA6, 0xC3, 0xDD, 0xED, 0x61, 0x7C, 0xEF,
+    0xD4, 0x24, 0x51, 0x28, 0x27, 0x33, 0xFF, 0xFA, 0xB4, 0x5D, 0xB7, 0xFB, 0x9C, 0xC8, 0x02, 0xB3,
+    0x5F, 0x58, 0x14, 0xC2, 0x9F, 0xDD, 0x0F, 0x8E, 0x9A, 0xD7, 0xFB, 0xB3, 0x00, 0x33, 0x5F, 0x50,
+    0x82, 0x7F, 0x3B, 0xE1, 0x71, 0xFD, 0x6B, 0xF6, 0xD7, 0x83, 0x18, 0x80, 0x27, 0x0F, 0x6A, 0xFA,
+    0x53, 0xF9, 0xA5, 0x03, 0xFD, 0x59, 0xC2, 0xD6, 0x00, 0x1B, 0xB1, 0xD0, 0x45, 0xC5, 0xFF, 0xFF,
+    0x76, 0xAD, 0x01, 0x7D, 0xC3, 0x6B, 0x39, 0xE8, 0x15, 0x49, 0x10, 0x02, 0xAF, 0x16, 0xA4, 0xCB,
+    0x92, 0x04, 0xED, 0x64, 0x61, 0x59, 0x46, 0x9F, 0x10, 0x00, 0xAB, 0xD3, 0x2A, 0x7F, 0x9C, 0xC0,
+    0x05, 0x17, 0x18, 0x01, 0xE0, 0x06, 0x47, 0x4D, 0x49, 0x4D, 0x01, 0x02, 0x30, 0x00, 0x58, 0x00,
+    0x10, 0x00, 0x08, 0x04, 0x00, 0x00, 0xFF, 0xF7, 0xFF, 0xEF, 0xBF, 0xE7, 0x9F, 0xE7, 0x9F, 0xE7,
+    0x9F, 0xE7, 0x7F, 0xDF, 0x7F, 0xDF, 0x1E, 0xD7, 0xB8, 0xAD, 0x31, 0x7C, 0xC3, 0x10, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x0F, 0xDE, 0x05, 0x40, 0x03, 0x7F, 0x81, 0x31,
+    0xEE, 0xFD, 0xEE, 0xC0, 0x15, 0xBF, 0xF7, 0x08, 0x1F, 0xBF, 0xA8, 0xC4, 0x00, 0x2B, 0x15, 0xFD,
+    0x1F, 0x37, 0xB7, 0xF5, 0x03, 0x91, 0x00, 0x2A, 0x61, 0xAF, 0xEF, 0x0B, 0x9B, 0x41, 0x76, 0xB3,
+    0x00, 0x2A, 0xCF, 0x0A, 0x18, 0x2F, 0xB3, 0x95, 0x07, 0xA2, 0x00, 0x32, 0xE1, 0xAC, 0xE7, 0x0B,
+    0x8F, 0xDF, 0xFA, 0x8A, 0xD9, 0x02, 0xD7, 0x46, 0xA8, 0xEB, 0xC2, 0x62, 0x5D, 0x3D, 0x7E, 0x86,
+    0xAF, 0x77, 0x00, 0x55, 0xD6, 0x34, 0x11, 0x13, 0x08, 0x97, 0x48, 0x0E, 0x31, 0x10, 0x06, 0x09,
+    0xC4, 0xC2, 0x5E, 0xEF, 0xD4, 0x1C, 0x6E, 0x3A, 0x9C, 0xC8, 0x02, 0xB3, 0x45, 0x71, 0xB8, 0x6B,
+    0xFD, 0xDD, 0xCD, 0x05, 0xD2, 0xCB, 0x1A, 0x77, 0x58, 0x00, 0x74, 0x35, 0x6A, 0x3C, 0x2B, 0x9B,
+    0xFB, 0xB9, 0xD9, 0x28, 0xF1, 0x9E, 0xE7, 0x74, 0x01, 0x5C, 0xDC, 0x8D, 0xD2, 0x8D, 0x37, 0xDF,
+    0xFE, 0xF0, 0x41, 0x72, 0xFE, 0x8B, 0xAF, 0xBE, 0x17, 0x29, 0x40, 0x5F, 0xC2, 0xFE, 0x17, 0xF0,
+    0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC,
+    0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F,
+    0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F,
+    0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0x37, 0x30, 0xB9, 0x77, 0x3B, 0xA0, 0x0A, 0xE6,
+    0x85, 0xCA, 0x6F, 0xBF, 0xEE, 0x68, 0x2E, 0x96, 0x58, 0xD0, 0xBA, 0xC0, 0x03, 0xA1, 0xAB, 0x51,
+    0xE1, 0x5C, 0xDF, 0x77, 0xEA, 0x0F, 0x51, 0xD7, 0xEA, 0x73, 0x20, 0x0A, 0xCD, 0x7E, 0xA2, 0xB7,
+    0x0D, 0x7F, 0xBB, 0xFD, 0xDF, 0xD0, 0x46, 0xBF, 0x51, 0x10, 0x06, 0x6B, 0xF4, 0x30, 0xAF, 0xEF,
+    0xBF, 0xFF, 0xED, 0xFD, 0x01, 0xC6, 0xAF, 0x77, 0x00, 0x55, 0xD4, 0x4E, 0x3A, 0xFE, 0xF1, 0x34,
+    0x7F, 0xDE, 0xF1, 0xB8, 0xD9, 0x28, 0x80, 0x0A, 0xA3, 0x15, 0xC4, 0x26, 0x29, 0x73, 0x30, 0x88,
+    0x5A, 0xC0, 0x02, 0x5D, 0x15, 0xB9, 0xFF, 0x3F, 0x5B, 0xFD, 0x05, 0xDA, 0xCC, 0x00, 0xAB, 0x3C,
+    0x2B, 0xF7, 0xAF, 0xE7, 0x85, 0xC7, 0x9F, 0xA0, 0xC5, 0xFE, 0xA0, 0x72, 0x20, 0x05, 0x4C, 0x35,
+    0xFB, 0x88, 0x57, 0xF3, 0xFF, 0xFD, 0xFD, 0x45, 0xDB, 0x83, 0xA8, 0xC4, 0x00, 0x2B, 0x15, 0xFB,
+    0xC1, 0x5C, 0x75, 0xFD, 0xFE, 0xF3, 0x14, 0x6E, 0x58, 0xBF, 0xDE, 0xEC, 0x01, 0x5B, 0xFD, 0xC4,
+    0x9D, 0xD2, 0x3E, 0xDF, 0xE6, 0x0A, 0xC9, 0x47, 0x84, 0x9F, 0x8C, 0x01, 0x1F, 0xEC, 0x85, 0xD2,
+    0x8D, 0x28, 0xE7, 0xFE, 0xF0, 0x61, 0x71, 0x8C, 0xFF, 0x7D, 0xC0, 0x0A, 0xEF, 0xE4, 0x42, 0xE3,
+    0x38, 0xDF, 0x93, 0x04, 0x2E, 0x62, 0xFB, 0x0B, 0x99, 0xC8, 0x42, 0xFE, 0x17, 0xF0, 0xBF, 0x85,
+    0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1,
+    0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8,
+    0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE,
+    0x17, 0xF0, 0xBF, 0x85, 0xFF, 0xF7, 0x73, 0x0B, 0x97, 0x73, 0xBA, 0x00, 0xAE, 0x68, 0x5C, 0xA6,
+    0xFB, 0xFE, 0xE6, 0x82, 0xE9, 0x65, 0x8D, 0x0B, 0xAC, 0x00, 0x3A, 0x1A, 0xB5, 0x1E, 0x15, 0xCD,
+    0xF7, 0x7E, 0xA0, 0xF5, 0x1D, 0x7E, 0xA7, 0x32, 0x00, 0xAC, 0xD7, 0xEA, 0x2B, 0x70, 0xD7, 0xFB,
+    0xBF, 0xDD, 0xFD, 0x04, 0x6B, 0xF5, 0x11, 0x00, 0x66, 0xBF, 0x43, 0x0A, 0xFE, 0xFB, 0xFF, 0xFE,
+    0xDF, 0xD0, 0x1C, 0x6A, 0xF7, 0x70, 0x05, 0x5D, 0x44, 0xE3, 0xAF, 0xEF, 0x13, 0x47, 0xFD, 0xEF,
+    0x1B, 0x8D, 0x92, 0x88, 0x00, 0xAA, 0x31, 0x5C, 0x42, 0x62, 0x66, 0x2F, 0x67, 0x2A, 0x0E, 0x16,
+    0xB0, 0x00, 0xDC, 0x35, 0x9C, 0xE3, 0xF1, 0x98, 0x4A, 0xED, 0x66, 0x00, 0x55, 0x9C, 0xBA, 0x60,
+    0x03, 0x30, 0x8C, 0x0E, 0x44, 0x00, 0xA9, 0x81, 0x74, 0xC6, 0x0B, 0xA8, 0xC4, 0x00, 0x2B, 0x14,
+    0x2E, 0x60, 0x00, 0xFB, 0xBF, 0x7B, 0xB0, 0x05, 0x6F, 0xFD, 0xCE, 0x18, 0x10, 0x38, 0xF9, 0x40,
+    0xA8, 0x47, 0x4D, 0x49, 0x4D, 0x01, 0x02, 0x30, 0x00, 0x58, 0x00, 0x10, 0x00, 0x08, 0x04, 0x00,
+    0x00, 0xFF, 0xEF, 0xBF, 0xE7, 0x9F, 0xE7, 0x9F, 0xE7, 0x9F, 0xE7, 0x7F, 0xDF, 0x7F, 0xDF, 0x7F,
+    0xDF, 0x1E, 0xD7, 0xB8, 0xAD, 0xE8, 0x39, 0x82, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x80, 0x0F, 0xBE, 0x05, 0x40, 0x03, 0x7F, 0x41, 0x31, 0xDD, 0xFD, 0xEE, 0xC0, 0x15,
+    0xBF, 0xEE, 0x88, 0x1F, 0x9F, 0x97, 0xC4, 0x00, 0x2A, 0xF3, 0xFC, 0x1F, 0x37, 0x73, 0xF3, 0x02,
+    0x88, 0x80, 0x2A, 0x41, 0x9F, 0xE6, 0x8B, 0x9B, 0x21, 0x75, 0xAA, 0x80, 0x2A, 0xAF, 0x09, 0x18,
+    0x2F, 0x73, 0x93, 0x07, 0x99, 0x80, 0x32, 0xE1, 0x9C, 0x18, 0x1F, 0xF7, 0xBF, 0xFA, 0x82, 0x54,
+    0xC2, 0xD7, 0x35, 0xA0, 0x6B, 0xC2, 0x62, 0x5D, 0x3D, 0x7E, 0x82, 0x8F, 0x66, 0x00, 0x55, 0xD2,
+    0x15, 0xFA, 0x30, 0x91, 0x74, 0x80, 0xE3, 0x00, 0x00, 0x60, 0x9C, 0x4C, 0x25, 0xDD, 0xFC, 0xC1,
+    0xC6, 0xE3, 0xA9, 0xCC, 0x80, 0x2B, 0x34, 0x57, 0x1B, 0x86, 0x7F, 0xBB, 0xCC, 0xC8, 0x5C, 0xEA,
+    0x90, 0xA7, 0x75, 0x80, 0x07, 0x41, 0x45, 0x9B, 0xC2, 0x79, 0x9F, 0xBB, 0x95, 0x4C, 0x0A, 0x40,
+    0x0C, 0x14, 0x8C, 0xD6, 0x4F, 0xBF, 0xFD, 0xE0, 0x6A, 0x73, 0x62, 0x70, 0x8B, 0xAC, 0xE0, 0x36,
+    0x39, 0xAC, 0x60, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC,
+    0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F,
+    0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F,
+    0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17,
+    0x9B, 0x95, 0x4E, 0x6F, 0x09, 0xE6, 0x00, 0x33, 0x21, 0x73, 0x9A, 0xC9, 0xF7, 0xE0, 0x52, 0xAA,
+    0x42, 0x85, 0xD6, 0x00, 0x1D, 0x05, 0x14, 0x52, 0x5D, 0xDF, 0xCC, 0x1E, 0x81, 0xAF, 0xD4, 0xE6,
+    0x40, 0x15, 0x9A, 0xFD, 0x41, 0x2E, 0x19, 0xFE, 0xEF, 0xF4, 0x9C, 0x30, 0xAF, 0xD4, 0x00, 0x01,
+    0x9A, 0xFD, 0x01, 0xC0, 0x7B, 0xFF, 0xFE, 0xE7, 0xE4, 0x0E, 0x34, 0x7B, 0x30, 0x02, 0xAE, 0x82,
+    0x71, 0xCF, 0xF3, 0x49, 0xA3, 0xFD, 0xEF, 0x8D, 0xC6, 0xA7, 0x33, 0x00, 0x54, 0xD4, 0xAE, 0x21,
+    0x31, 0x33, 0x17, 0x73, 0x93, 0x07, 0x0B, 0x58, 0x00, 0x4B, 0xA2, 0xB7, 0x3F, 0xF7, 0xEC, 0xC2,
+    0x37, 0x5A, 0xA8, 0x02, 0xAA, 0xF0, 0x9F, 0xD6, 0xBF, 0x9E, 0x17, 0x1F, 0x7E, 0xEF, 0x79, 0xF9,
+    0x81, 0x44, 0x40, 0x15, 0x20, 0xCF, 0xEA, 0x21, 0x43, 0x02, 0xFD, 0xEE, 0xF7, 0x7C, 0xFC, 0xC6,
+    0x20, 0x01, 0x58, 0x9F, 0xD6, 0x06, 0xE0, 0x30, 0x20, 0xB0, 0x8C, 0x04, 0x36, 0x40, 0x09, 0xDF,
+    0xEA, 0x22, 0xCE, 0x91, 0xEE, 0x7F, 0x01, 0x46, 0x7E, 0x30, 0x04, 0x7F, 0x72, 0x17, 0x39, 0xAC,
+    0x5F, 0x7E, 0x17, 0x4F, 0xEF, 0x74, 0x01, 0x48, 0x61, 0xB1, 0xCD, 0x65, 0x01, 0x75, 0x17, 0x5F,
+    0xFC, 0x2E, 0x71, 0x80, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17,
+    0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85,
+    0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1,
+    0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xAF,
+    0x30, 0x01, 0x99, 0x0B, 0x9C, 0xD6, 0x4F, 0xBF, 0xFE, 0x8B, 0xFC, 0x00, 0x3A, 0x0A, 0x2C, 0xDE,
+    0x13, 0xCC, 0xFF, 0xFE, 0xC2, 0xC3, 0xBF, 0xD4, 0xE6, 0x40, 0x15, 0x9A, 0xFD, 0x41, 0x2E, 0x19,
+    0xFE, 0xE8, 0x78, 0x42, 0xE3, 0xFA, 0x80, 0x00, 0x33, 0x5F, 0xA0, 0x84, 0xFF, 0x3B, 0xE1, 0x71,
+    0xFD, 0xEF, 0xF4, 0x14, 0x7B, 0x30, 0x02, 0xAE, 0x90, 0xAF, 0xD6, 0x7F, 0x9A, 0x4E, 0x2F, 0xEF,
+    0x6A, 0x09, 0x53, 0x99, 0x80, 0x2A, 0x6B, 0x40, 0xD7, 0xFF, 0x45, 0xC5, 0xFF, 0xFE, 0x72, 0x60,
+    0xE1, 0x6B, 0x00, 0x0D, 0xC3, 0x38, 0x2E, 0x31, 0x78, 0xAC, 0x06, 0xEB, 0x55, 0x00, 0x55, 0x5C,
+    0xBA, 0x80, 0x02, 0xEE, 0x7E, 0x60, 0x51, 0x10, 0x05, 0x48, 0x0B, 0xA8, 0x30, 0x4C, 0xBE, 0x20,
+    0x01, 0x57, 0x91, 0x73, 0x00, 0x07, 0xBA, 0xC3, 0x20, 0x04, 0xEF, 0xD7, 0x64, 0x00, 0x61, 0x03,
+    0x8F, 0x94, 0x0A, 0x80, 0x47, 0x4D, 0x49, 0x4D, 0x01, 0x02, 0x18, 0x00, 0x58, 0x00, 0x10, 0x00,
+    0x08, 0x04, 0x00, 0x00, 0xFF, 0xF7, 0xDF, 0xEF, 0x9F, 0xE7, 0x9F, 0xE7, 0x7F, 0xDF, 0x5F, 0xDF,
+    0x5A, 0xBE, 0x6E, 0x63, 0xE3, 0x18, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00,
+    0xF0, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0x7D, 0xCE, 0x6B,
+    0xDE, 0x0A, 0x7F, 0x60, 0x08, 0x7F, 0x80, 0xA6, 0xFF, 0x7F, 0xF0, 0xF7, 0x7D, 0xFF, 0x3C, 0x16,
+    0xBE, 0xEC, 0x34, 0x42, 0x01, 0x68, 0x0C, 0x37, 0x2A, 0xC1, 0x45, 0xAA, 0xC1, 0x71, 0xC3, 0x14,
+    0xFC, 0xFD, 0xE0, 0xB3, 0x39, 0x9D, 0x42, 0xFF, 0xAF, 0x05, 0x9F, 0xEB, 0xED, 0x04, 0x05, 0x8D,
+    0x06, 0xD2, 0x35, 0x10, 0x01, 0x7F, 0x3E, 0xD1, 0x40, 0x58, 0xD0, 0xAB, 0x00, 0xB4, 0xFD, 0x08,
+    0xCC, 0x2E, 0x22, 0xF4, 0xFD, 0x7E, 0x22, 0xB4, 0x39, 0xA0, 0xBD, 0xBF, 0xFA, 0xFB, 0x84, 0x92,
+    0x85, 0x06, 0xCE, 0x1E, 0x57, 0xD5, 0xF7, 0xA8, 0xC5, 0x6F, 0x3E, 0xE3, 0xC3, 0x7B, 0xF3, 0x18,
+    0x80, 0x18, 0x82, 0xDB, 0xF4, 0x02, 0x1D, 0xF0, 0x29, 0x84, 0xA5, 0xAD, 0x05, 0x40, 0x03, 0xC0,
+    0x1E, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xF0,
+    0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x7D, 0xDF, 0xE8, 0x04, 0x3B, 0xE0, 0x5B, 0xFB, 0xF3, 0x18,
+    0x80, 0x18, 0x88, 0x5B, 0xEF, 0x51, 0x8A, 0xDE, 0x7D, 0xC0, 0xB5, 0xD7, 0xDC, 0x24, 0x94, 0x28,
+    0x36, 0x70, 0x30, 0x9F, 0xAF, 0xC4, 0x56, 0x87, 0x34, 0xA8, 0x5F, 0xF5, 0xE0, 0xB4, 0xFB, 0xC1,
+    0x66, 0x73, 0x3A, 0x0D, 0xA4, 0x2E, 0x9F, 0xCF, 0xB4, 0x50, 0x16, 0x34, 0x2A, 0xC7, 0xF8, 0x2E,
+    0x9F, 0x68, 0x20, 0x5C, 0xC1, 0x69, 0xF9, 0x11, 0x98, 0xBD, 0xBF, 0xFC, 0xAB, 0x05, 0x16, 0xAB,
+    0x05, 0xC7, 0x18, 0x17, 0xDD, 0x86, 0x88, 0x40, 0x2D, 0x1F, 0xC2, 0xFA, 0x8A, 0x47, 0x0F, 0x77,
+    0xDF, 0xF3, 0xD0, 0x6D, 0xEC, 0x26, 0x10, 0x29, 0x80, 0x03, 0xB9, 0xCD, 0x23, 0x98, 0x01, 0xE0,
+    0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78,
+    0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x00, 0x80, 0x47, 0x4D, 0x49, 0x4D, 0x01, 0x02, 0x30, 0x00, 0x58,
+    0x00, 0x10, 0x00, 0x08, 0x04, 0x00, 0x00, 0xBF, 0xE7, 0xBC, 0xCE, 0xE8, 0x39, 0xE4, 0x18, 0xE4,
+    0x18, 0xE4, 0x18, 0xE4, 0x18, 0xE4, 0x18, 0xC4, 0x10, 0xA3, 0x10, 0x82, 0x08, 0x61, 0x08, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x3C, 0x01, 0x7F, 0xCE, 0x60, 0x02, 0xB9,
+    0xE1, 0x79, 0xD3, 0x62, 0x00, 0x15, 0x6A, 0x0B, 0x47, 0xEA, 0x6D, 0x55, 0x00, 0x55, 0x8F, 0x5E,
+    0x17, 0x7D, 0x1D, 0xDA, 0xCC, 0x00, 0xAB, 0x3C, 0xE8, 0x2A, 0xBF, 0xEE, 0xD4, 0xDC, 0x2D, 0x60,
+    0x01, 0xB9, 0xEB, 0x7D, 0xE1, 0x84, 0xFD, 0xD1, 0x82, 0xFB, 0x64, 0xDF, 0x97, 0x57, 0x7F, 0xB4,
+    0xB3, 0x85, 0xAE, 0xED, 0x4B, 0xFD, 0x98, 0x53, 0x46, 0x07, 0x1A, 0x1C, 0xCC, 0x01, 0x53, 0x41,
+    0x38, 0x98, 0x4F, 0xF5, 0x37, 0x1B, 0x8E, 0xE7, 0x32, 0x00, 0xAC, 0xD9, 0x5C, 0x6E, 0x63, 0x01,
+    0xFE, 0xA3, 0x0A, 0x76, 0xC9, 0x90, 0x01, 0xEC, 0xD2, 0x45, 0xDF, 0xFE, 0x59, 0x4A, 0x23, 0x39,
+    0x0B, 0xEE, 0x4C, 0x22, 0x35, 0x6E, 0x7F, 0xF3, 0x0A, 0x17, 0xF0, 0xB9, 0xD6, 0x02, 0xFE, 0x17,
+    0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85,
+    0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1,
+    0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8,
+    0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x79, 0xB2, 0x85, 0xCB, 0x98, 0x00,
+    0xC0, 0xB9, 0x55, 0xB9, 0xFF, 0xDD, 0x1D, 0xDA, 0xCD, 0x3B, 0x17, 0xEE, 0xCE, 0xCD, 0x67, 0x9D,
+    0x77, 0xFF, 0xFF, 0xA9, 0xBD, 0x8F, 0x5F, 0x21, 0x88, 0x80, 0x2A, 0x25, 0xFA, 0x9B, 0x5C, 0xF5,
+    0xE1, 0xE2, 0xD1, 0xD2, 0xBE, 0x50, 0x00, 0x06, 0x4B, 0xF4, 0x93, 0xA1, 0xB1, 0xFE, 0xB7, 0xF2,
+    0x00, 0xBE, 0xC0, 0xBF, 0x62, 0xE3, 0xFF, 0xFF, 0x7A, 0x41, 0x6D, 0x00, 0x0C, 0xB4, 0xBA, 0x20,
+    0x02, 0xF6, 0xF0, 0x42, 0xFF, 0x1C, 0xEF, 0x05, 0x8B, 0xFD, 0xFB, 0xDF, 0xC4, 0x02, 0xDB, 0x01,
+    0x08, 0x8F, 0xBC, 0x2E, 0x3E, 0xFD, 0x9D, 0xEF, 0xE2, 0x17, 0xD8, 0xFE, 0xDE, 0x77, 0xFE, 0x0B,
+    0x8F, 0xEE, 0x8D, 0x46, 0x18, 0x0A, 0x9E, 0xC5, 0xC3, 0x64, 0xB2, 0x6F, 0xC2, 0xE3, 0xB4, 0xB3,
+    0x59, 0x2D, 0x9F, 0xAD, 0xD8, 0x02, 0xB5, 0xFC, 0x6A, 0x35, 0x9A, 0x97, 0xFF, 0xFE, 0x5D, 0x5E,
+    0xA3, 0x39, 0x3F, 0xA0, 0x01, 0xFF, 0xB9, 0x30, 0x88, 0xD5, 0xF9, 0xFF, 0xCC, 0x28, 0x5C, 0xBF,
+    0xBD, 0xD0, 0x05, 0x77, 0xC2, 0xE5, 0x58, 0x0B, 0xA8, 0xBA, 0xC0, 0x02, 0x17, 0xF0, 0xBF, 0x85,
+    0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1,
+    0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8,
+    0x5F, 0xC2, 0xFE, 0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x7F, 0x0B, 0xF8, 0x5F, 0xC2, 0xFE,
+    0x17, 0xF0, 0xBF, 0x85, 0xFC, 0x2F, 0xE1, 0x75, 0xB2, 0x85, 0xFC, 0x2E, 0x75, 0x6E, 0x7F, 0xF7,
+    0x47, 0x76, 0xB3, 0x4E, 0xC2, 0xFB, 0xB3, 0xB3, 0x59, 0xE7, 0x5D, 0xFF, 0xFF, 0xEA, 0x6F, 0x64,
+    0xDF, 0xEE, 0x73, 0x20, 0x0A, 0xCD, 0xFE, 0xE8, 0xD7, 0x3D, 0x78, 0x78, 0xB4, 0x74, 0xBF, 0xDD,
+    0x0E, 0x66, 0x00, 0xA9, 0xA6, 0xFF, 0x69, 0x3A, 0x1B, 0x1F, 0xE8, 0x0E, 0x36, 0x72, 0x88, 0x80,
+    0x26, 0xEC, 0x27, 0x11, 0x71, 0x80, 0x04, 0x6E, 0x21, 0x6B, 0x00, 0x09, 0x5C, 0x42, 0xC9, 0xFE,
+    0xED, 0x4D, 0xC2, 0xFB, 0x73, 0xD6, 0xFB, 0xD0, 0x0A, 0x92, 0x20, 0x05, 0x23, 0x05, 0x30, 0xFF,
+    0xA9, 0xB5, 0x54, 0x01, 0x56, 0x32, 0xEA, 0x80, 0x0F, 0x4D, 0x88, 0x00, 0x55, 0xA9, 0x93, 0x3F,
+    0xCE, 0x60, 0x02, 0xB9, 0xE1, 0x79, 0x00, 0x78, 0x00, 0x80,
+};
+
+#endif  // SRC_DISPLAY_CLOCKFONT_H
@@ -0,0 +1,61 @@
+#ifndef SRC_DISPLAY_COLORFX_H
+#define SRC_DISPLAY_COLORFX_H
+
+#include <Arduino.h>
+#include <array>
+
+/**
+ * @brief Static colour adjustments, see ColorFx
+ */
+struct ColorFxSettings {
+    uint8_t brightness = 100;  // percent
+    int8_t temperature = 0;    // -100 (cold) .. 100 (warm)
+    bool greyscale = false;
+};
+
+/**
+ * @class ColorFx
+ * @brief RGB565 colour transform built as three per-channel lookup tables
+ *
+ * Brightness, colour temperature and fades to black or white are folded into 32/64/32 entry tables that are rebuilt
+ * only when a setting or the fade step changes. Indexed sources transform their palette once per frame (256
+ * lookups) instead of every pixel. Each rebuild bumps the revision, sources that only redraw part of the screen per
+ * frame compare it to repaint the rest
+ */
+class ColorFx {
+   public:
+    ColorFx();
+
+    auto setSettings(const ColorFxSettings& settings) -> void;
+    auto getSettings() const -> const ColorFxSettings&;
+    auto startFade(uint16_t frames, bool toWhite, bool fadeIn) -> void;
+    auto clearFade() -> void;
+    auto isFading() const -> bool;
+    auto isActive() const -> bool;
+    auto getRevision() const -> uint32_t;
+
+    auto beginFrame() -> void;
+    auto apply(uint16_t color) const -> uint16_t;
+    auto applyPalette(const uint16_t* src, uint16_t* dst, size_t count) const -> void;
+
+   private:
+    static constexpr uint16_t FX_ONE = 256;
+
+    ColorFxSettings m_settings;
+    bool m_dirty = true;
+    uint32_t m_revision = 0;
+
+    uint16_t m_fadeFrames = 0;
+    uint16_t m_fadeStep = 0;
+    bool m_fadeToWhite = false;
+    bool m_fadeIn = false;
+    uint16_t m_fadeAmount = 0;
+
+    std::array<uint16_t, 32> m_lutR{};
+    std::array<uint16_t, 64> m_lutG{};
+    std::array<uint16_t, 32> m_lutB{};
+
+    auto rebuild() -> void;
+};
+
+#endif  // SRC_DISPLAY_COLORFX_H
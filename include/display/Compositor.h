@@ -0,0 +1,58 @@
+#ifndef SRC_DISPLAY_COMPOSITOR_H
+#define SRC_DISPLAY_COMPOSITOR_H
+
+#include <Arduino.h>
+#include <memory>
+#include <vector>
+
+#include "display/Gif.h"
+#include "display/Q565.h"
+
+/**
+ * @brief Placement and frame rate of one animated viewport
+ */
+struct ViewportStats {
+    String path;
+    int16_t xPos = 0;
+    int16_t yPos = 0;
+    int16_t width = 0;
+    int16_t height = 0;
+    bool playing = false;
+    uint32_t frames = 0;
+    float fps = 0.0F;
+};
+
+/**
+ * @class Compositor
+ * @brief Plays several animations at once, each one in its own rectangle of the screen
+ *
+ * Every viewport owns a GIF or Q565 player with its own frame scheduler. update() draws the frames that are due,
+ * the most overdue first, until the loop budget is spent, so a slow animation delays the others instead of starving
+ * the web server
+ */
+class Compositor {
+   public:
+    static constexpr size_t MAX_VIEWPORTS = 4;
+
+    auto add(const String& path, int16_t xPos, int16_t yPos, int16_t width, int16_t height) -> bool;
+    auto clear() -> void;
+    auto update(uint32_t budgetUs) -> void;
+    auto isActive() const -> bool;
+    auto getStats() const -> std::vector<ViewportStats>;
+
+   private:
+    struct Viewport {
+        ViewportStats stats;
+        std::unique_ptr<Gif> gif;
+        std::unique_ptr<Q565> q565;
+        uint32_t windowStartMs = 0;
+        uint32_t windowFrames = 0;
+    };
+
+    std::vector<Viewport> m_viewports;
+
+    static auto isPlaying(const Viewport& viewport) -> bool;
+    static auto nextFrameMs(const Viewport& viewport) -> uint32_t;
+};
+
+#endif  // SRC_DISPLAY_COMPOSITOR_H
@@ -0,0 +1,87 @@
+#ifndef SRC_DISPLAY_DISPLAYCOMMAND_H
+#define SRC_DISPLAY_DISPLAYCOMMAND_H
+
+#include <Arduino.h>
+#include <array>
+#include <atomic>
+
+#include "display/ColorFx.h"
+#include "display/DisplayList.h"
+#include "display/Effects.h"
+#include "display/Transition.h"
+#include "system/SpscRing.h"
+
+enum class DisplayCommandType : uint8_t {
+    PlayGif,
+    StopGif,
+    PlayEffect,
+    Fade,
+    DrawImage,
+    ConsolePrint,
+    Clock,
+    ApplyColorFx,
+    DrawList,
+    SetViewports
+};
+
+enum class DisplayCommandStatus : uint8_t { Unknown, Queued, Done, Failed };
+
+/**
+ * @brief Screen change requested by the web layer, executed later by DisplayManager::update()
+ *
+ * PlayGif uses path and the optional colour settings and fade in, PlayEffect uses effect, Fade uses fadeFrames and
+ * fadeToWhite. DrawImage uses path, the position, transition and durationMs, ConsolePrint uses text, Clock uses
+ * enabled, DrawList uses list and SetViewports the Gif operations of list. ApplyColorFx reloads the configured colour
+ * settings
+ */
+struct DisplayCommand {
+    uint32_t id = 0;
+    DisplayCommandType type = DisplayCommandType::StopGif;
+    String path;
+    String text;
+    EffectType effect = EffectType::Plasma;
+    bool hasFx = false;
+    ColorFxSettings fx;
+    uint16_t fadeFrames = 0;
+    bool fadeToWhite = false;
+    int16_t xPos = 0;
+    int16_t yPos = 0;
+    TransitionType transition = TransitionType::Cut;
+    uint32_t durationMs = 0;
+    bool enabled = false;
+    DisplayList list;
+};
+
+/**
+ * @class DisplayCommandQueue
+ * @brief Single producer, single consumer ring of display commands with the outcome of the last ones
+ *
+ * The commands go through an SpscRing, the producer also owns the id counter and the consumer the results. A result
+ * packs the id and the status in one word, which keeps a status query consistent while the consumer records a newer
+ * result in the same entry
+ */
+class DisplayCommandQueue {
+   public:
+    static constexpr size_t CAPACITY = 8;
+    static constexpr size_t HISTORY = 16;
+
+    auto push(DisplayCommand& command) -> uint32_t;
+    auto pop(DisplayCommand& command) -> bool;
+    auto empty() const -> bool;
+    auto complete(uint32_t commandId, bool success) -> void;
+    auto getStatus(uint32_t commandId) const -> DisplayCommandStatus;
+
+    static auto typeName(DisplayCommandType type) -> const char*;
+    static auto statusName(DisplayCommandStatus status) -> const char*;
+
+   private:
+    static constexpr uint32_t STATUS_BITS = 2;
+    static constexpr uint32_t STATUS_MASK = (1U << STATUS_BITS) - 1;
+
+    SpscRing<DisplayCommand, CAPACITY> m_ring;
+    std::atomic<uint32_t> m_nextId{1};
+    std::atomic<uint32_t> m_lastCompleted{0};
+    std::array<std::atomic<uint32_t>, HISTORY> m_results{};
+};
+
+#endif  // SRC_DISPLAY_DISPLAYCOMMAND_H
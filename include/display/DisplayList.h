@@ -0,0 +1,65 @@
+#ifndef SRC_DISPLAY_DISPLAYLIST_H
+#define SRC_DISPLAY_DISPLAYLIST_H
+
+#include <Arduino.h>
+#include <Arduino_GFX_Library.h>
+#include <vector>
+
+enum class DisplayOpType : uint8_t { Fill, Rect, Line, Text, Image, Gif };
+
+/**
+ * @brief One drawing operation of a display list
+ *
+ * Fill, rect and gif use x, y, w, h; a line goes from (x, y) to (w, h); text and image only use x, y. text holds the
+ * string of a text op and the file path of an image or gif op. A text op with bg equal to color is drawn transparent
+ */
+struct DisplayOp {
+    DisplayOpType type = DisplayOpType::Fill;
+    int16_t xPos = 0;
+    int16_t yPos = 0;
+    int16_t width = 0;
+    int16_t height = 0;
+    uint16_t color = 0;
+    uint16_t bgColor = 0;
+    uint8_t size = 1;
+    String text;
+};
+
+/**
+ * @class DisplayList
+ * @brief Batch of drawing operations executed in one SPI transaction, optionally stored as a named scene
+ *
+ * optimize() rewrites the batch before it is drawn: rectangle outlines and horizontal or vertical lines become fills,
+ * operations entirely covered by a later fill are dropped and consecutive fills of the same colour that share an edge
+ * are merged, so each remaining fill costs one address window and one writeRepeat(). The optimized list can be saved
+ * in a compact binary form and replayed without parsing JSON again
+ */
+class DisplayList {
+   public:
+    static constexpr size_t MAX_OPS = 128;
+    static constexpr size_t MAX_TEXT = 96;
+
+    auto add(const DisplayOp& op) -> bool;
+    auto clear() -> void;
+    auto optimize() -> void;
+    auto draw(Arduino_TFT* tft) const -> void;
+    auto save(const String& path) const -> bool;
+    auto load(const String& path) -> bool;
+
+    auto getOps() const -> const std::vector<DisplayOp>& { return m_ops; }
+    auto getMerged() const -> uint16_t { return m_merged; }
+    auto getCulled() const -> uint16_t { return m_culled; }
+
+    static auto parseType(const String& name, DisplayOpType& type) -> bool;
+
+   private:
+    std::vector<DisplayOp> m_ops;
+    uint16_t m_merged = 0;
+    uint16_t m_culled = 0;
+
+    auto expandOutlines() -> void;
+    auto cullHidden() -> void;
+    auto mergeFills() -> void;
+};
+
+#endif  // SRC_DISPLAY_DISPLAYLIST_H
@@ -2,6 +2,15 @@
 
 #include <Arduino.h>
 #include <Arduino_GFX_Library.h>
+#include <functional>
+#include <vector>
+
+#include "display/ColorFx.h"
+#include "display/Compositor.h"
+#include "display/DisplayCommand.h"
+#include "display/DisplayList.h"
+#include "display/Effects.h"
+#include "display/Transition.h"
 
 // Colors definitions
 static constexpr uint16_t LCD_BLACK = 0x0000;
@@ -14,19 +23,57 @@ static constexpr int ONE_LINE_SPACE = 20;
 static constexpr int TWO_LINES_SPACE = 40;
 static constexpr int THREE_LINES_SPACE = 60;
 
+/**
+ * @brief Decode time counters of one image asset drawn with DisplayManager::drawImage
+ */
+struct ImageDrawStats {
+    String path;
+    uint32_t draws = 0;
+    uint32_t lastUs = 0;
+    uint32_t maxUs = 0;
+    uint32_t totalUs = 0;
+};
+
 class DisplayManager {
    public:
     static void begin();
+    static void applyConfig();
+    static void applyPanelProfile();
+    static void setPanelProfile(uint8_t backlightLevel, int8_t gamma, int8_t contrast);
     static bool isReady();
     static void ensureInit();
     static Arduino_GFX* getGfx();
+    static Arduino_DataBus* getBus();
     static void drawStartup(String currentIP);
+    static void compose(uint16_t background, const std::function<void(Arduino_GFX&)>& draw);
     static void drawTextWrapped(int16_t xPos, int16_t yPos, const String& text, uint8_t textSize, uint16_t fgColor,
                                 uint16_t bgColor, bool clearBg);
     static void drawLoadingBar(float progress, int yPos = 180, int barWidth = 200, int barHeight = 20,
                                uint16_t fgColor = 0x07E0, uint16_t bgColor = 0x39E7);
     static bool playGifFullScreen(const String& path, uint32_t timeMs = 0);
-    static bool stopGif();
-    static void update();
+    static bool stopGif(bool clear = true);
+    static bool addViewport(const String& path, int16_t xPos, int16_t yPos, int16_t width, int16_t height);
+    static std::vector<ViewportStats> getViewportStats();
+    static bool playEffect(EffectType type);
+    static EffectStats getEffectStats();
+    static bool showClock();
+    static bool isClockRunning();
+    static bool drawImage(const String& path, int16_t xPos, int16_t yPos);
+    static bool transitionToImage(const String& path, int16_t xPos, int16_t yPos, TransitionType type,
+                                  uint32_t durationMs);
+    static const std::vector<ImageDrawStats>& getImageStats();
+    static bool drawDisplayList(const DisplayList& list);
+    static bool setScrollRegion(int16_t yPos, int16_t height);
+    static void scrollBy(int16_t lines);
+    static int16_t scrollLineToY(int16_t line);
+    static void resetScroll();
+    static bool consolePrint(const String& text);
+    static ColorFx& getColorFx();
+    static ColorFxSettings getConfiguredColorFx();
+    static void applyColorFxSettings();
+    static uint32_t queueCommand(DisplayCommand& command);
+    static bool hasQueuedCommands();
+    static DisplayCommandStatus getCommandStatus(uint32_t commandId);
+    static void update(uint32_t budgetUs);
     static void clearScreen();
 };
@@ -0,0 +1,97 @@
+#ifndef SRC_DISPLAY_EFFECTS_H
+#define SRC_DISPLAY_EFFECTS_H
+
+#include <Arduino.h>
+#include <Arduino_GFX_Library.h>
+#include <array>
+#include <memory>
+
+enum class EffectType : uint8_t { Plasma, Fire, Starfield, Life };
+
+/**
+ * @brief Name and measured frame rate of the running effect
+ */
+struct EffectStats {
+    String name;
+    bool playing = false;
+    uint32_t frames = 0;
+    float fps = 0.0F;
+};
+
+/**
+ * @class Effects
+ * @brief Procedural full screen animations, no file needed
+ *
+ * Plasma and fire are rendered one line at a time into a line buffer pushed to the panel inside a single address
+ * window, like the GIF line output. Phases and cooling use 16.16 fixed point and every colour comes from a 256 entry
+ * RGB565 LUT built when the effect starts. The starfield only rewrites the pixels of the stars that moved and the Game
+ * of Life only recomputes rows next to a change and only redraws the cells that flipped. Per effect state is allocated
+ * on play() and released on stop()
+ */
+class Effects {
+   public:
+    static constexpr uint8_t EFFECT_COUNT = 4;
+
+    Effects();
+    ~Effects();
+
+    auto play(EffectType type) -> bool;
+    auto update() -> bool;
+    auto stop() -> void;
+    auto isPlaying() const -> bool;
+    auto getStats() const -> EffectStats;
+
+    static auto parseType(const String& name, EffectType& type) -> bool;
+    static auto typeName(EffectType type) -> const char*;
+
+   private:
+    static constexpr size_t LINE_WIDTH = 240;
+    static constexpr size_t LUT_SIZE = 256;
+
+    /**
+     * @brief One star of the starfield, position in world units and depth in 16.16
+     */
+    struct Star {
+        int16_t xPos;
+        int16_t yPos;
+        uint32_t depth;
+        int16_t screenX;
+        int16_t screenY;
+        uint8_t size;
+    };
+
+    Arduino_TFT* m_tft = nullptr;
+    EffectType m_type = EffectType::Plasma;
+    bool m_playing = false;
+
+    std::unique_ptr<uint8_t[]> m_state;
+    std::array<int8_t, LUT_SIZE> m_sine{};
+    std::array<uint16_t, LUT_SIZE> m_palette{};
+    std::array<uint16_t, LINE_WIDTH> m_lineBuf{};
+
+    std::array<uint32_t, 4> m_phase{};
+    uint32_t m_rng = 1;
+    uint32_t m_frameMs = 0;
+    uint32_t m_lastFrameMs = 0;
+    uint32_t m_frames = 0;
+    uint32_t m_generation = 0;
+    uint32_t m_stagnantGenerations = 0;
+    uint32_t m_windowStartMs = 0;
+    uint32_t m_windowFrames = 0;
+    float m_fps = 0.0F;
+
+    auto nextRandom() -> uint32_t;
+    auto buildSine() -> void;
+    auto buildPalette() -> void;
+
+    auto renderPlasma(uint32_t elapsedMs) -> void;
+    auto renderFire() -> void;
+    auto renderStarfield(uint32_t elapsedMs) -> void;
+    auto renderLife() -> void;
+
+    auto resetStar(Star& star, bool anyDepth) -> void;
+    auto seedLife() -> void;
+    auto drawLifeRun(uint8_t row, uint8_t firstCol, uint8_t endCol, const uint8_t* cells) -> void;
+};
+
+#endif  // SRC_DISPLAY_EFFECTS_H
@@ -3,24 +3,45 @@
 
 #include <Arduino.h>
 #include <AnimatedGIF.h>
+#include <Arduino_GFX_Library.h>
 #include <LittleFS.h>
 #include <array>
 
+struct GifFileHandle;
+
+/**
+ * @class Gif
+ * @brief GIF player drawing into its own viewport of the panel
+ *
+ * Players are independent objects (frame scheduler, disposal state, offsets, viewport) but share one AnimatedGIF
+ * decoder, its ~24 KiB of tables do not fit twice in the ESP8266 heap. When another player takes the decoder, the
+ * file offset of the next frame is saved and the file is reopened at that offset on the next frame
+ */
 class Gif {
    public:
+    static constexpr size_t HEADER_SIZE = 13;
+    // AnimatedGIF refuses wider canvases (MAX_WIDTH), larger ones are centred and clipped to the viewport
+    static constexpr uint16_t MAX_CANVAS = 480;
+
     Gif();
     ~Gif();
 
     auto begin() -> bool;
     auto playOne(const String& path) -> bool;
-    auto update() -> void;
+    auto update() -> bool;
     auto playAllFromLittleFS() -> bool;
     auto stop() -> void;
     auto isPlaying() const -> bool;
     auto setLoopEnabled(bool enabled) -> void;
+    auto setViewport(int16_t xPos, int16_t yPos, int16_t width, int16_t height) -> void;
+    auto nextFrameMs() const -> uint32_t;
+
+    static auto checkHeader(const uint8_t* data, size_t len, String& error) -> bool;
 
    private:
     AnimatedGIF* m_gif;
+    GifFileHandle* m_fileHandle = nullptr;
+    int32_t m_resumePos = 0;
     volatile bool m_playRequested;
     volatile bool m_playing;
     volatile bool m_loopEnabled;
@@ -31,15 +52,35 @@ class Gif {
     uint32_t m_lastFrameMs;
     uint32_t m_startMs;
     int m_frameCount;
+    uint32_t m_decodeUsTotal = 0;
 
     static constexpr size_t LINEBUF_MAX = 240;
 
     std::array<uint16_t, LINEBUF_MAX> m_lineBuf;
     bool m_inFrameWrite = false;
 
+    static constexpr size_t PALETTE_SIZE = 256;
+
+    std::array<uint16_t, PALETTE_SIZE> m_fxPalette{};
+    bool m_fxFrame = false;
+    uint32_t m_fxRevision = 0;
+    bool m_partialFrames = false;
+    bool m_repaint = false;
+    int m_frameIndex = 0;
+
     int16_t m_offsetX = 0;
     int16_t m_offsetY = 0;
-    bool m_centered = false;
+
+    // Rectangle given to setViewport(), kept apart from the one playOne() resolved it to (zero size: whole screen)
+    int16_t m_requestX = 0;
+    int16_t m_requestY = 0;
+    int16_t m_requestW = 0;
+    int16_t m_requestH = 0;
+
+    int16_t m_viewX = 0;
+    int16_t m_viewY = 0;
+    int16_t m_viewW = 0;
+    int16_t m_viewH = 0;
 
     String m_currentPath;
 
@@ -60,13 +101,20 @@ class Gif {
     int16_t m_curH = 0;
     uint16_t m_curBg = 0;
 
-    static Gif* s_instance;
+    auto logStats() -> void;
+    auto openDecoder(int32_t resumePos) -> bool;
+    auto closeDecoder() -> void;
+    auto suspend() -> void;
+    auto prepareColorFx() -> bool;
 
     static auto gifOpenFile(const char* fname, int32_t* pSize) -> void*;
     static auto gifCloseFile(void* pHandle) -> void;
     static auto gifReadFile(GIFFILE* pFile, uint8_t* pBuf, int32_t iLen) -> int32_t;
     static auto gifSeekFile(GIFFILE* pFile, int32_t iPosition) -> int32_t;
     static auto gifDraw(GIFDRAW* pDraw) -> void;
+
+    auto drawLine(GIFDRAW* pDraw, Arduino_TFT* tft, const uint16_t* palette565, int xPos, int yPos, int viewLeft,
+                  int viewRight) -> void;
 };
 
 #endif  // SRC_DISPLAY_GIF_H
@@ -0,0 +1,98 @@
+#ifndef SRC_DISPLAY_IMAGEASSET_H
+#define SRC_DISPLAY_IMAGEASSET_H
+
+#include <Arduino.h>
+#include <Arduino_GFX_Library.h>
+#include <LittleFS.h>
+#include <memory>
+
+class LzssStream;
+
+/**
+ * @class ImageAsset
+ * @brief Streaming decoder for compressed still images (.gmi)
+ *
+ * Files are produced by scripts/image_encode.py: RGB565 or 8/4 bit palette pixels compressed with a heatshrink style
+ * LZSS. Decoding keeps only the LZSS window (256 to 1024 bytes), the palette and one row, rows are pushed to the
+ * panel inside a single address window as soon as they are inflated
+ */
+class ImageAsset {
+   public:
+    /**
+     * @brief Byte source the decoder pulls compressed data from
+     */
+    class Source {
+       public:
+        virtual ~Source() = default;
+        virtual auto read(uint8_t* dst, size_t len) -> size_t = 0;
+    };
+
+    /**
+     * @brief Source reading from an open LittleFS file
+     */
+    class FileSource : public Source {
+       public:
+        explicit FileSource(File& file) : m_file(file) {}
+        auto read(uint8_t* dst, size_t len) -> size_t override { return m_file.read(dst, len); }
+
+       private:
+        File& m_file;
+    };
+
+    /**
+     * @brief Source reading from an asset stored in flash (PROGMEM)
+     */
+    class ProgmemSource : public Source {
+       public:
+        ProgmemSource(const uint8_t* data, size_t size) : m_data(data), m_size(size) {}
+        auto read(uint8_t* dst, size_t len) -> size_t override {
+            const size_t count = (len < m_size - m_pos) ? len : m_size - m_pos;
+
+            memcpy_P(dst, m_data + m_pos, count);
+            m_pos += count;
+
+            return count;
+        }
+
+       private:
+        const uint8_t* m_data;
+        size_t m_size;
+        size_t m_pos = 0;
+    };
+
+    /**
+     * @brief Pull decoder returning one full width RGB565 row per call
+     *
+     * Used when the rows have to be combined with another source before reaching the panel (transitions)
+     */
+    class RowDecoder {
+       public:
+        explicit RowDecoder(Source& source);
+        ~RowDecoder();
+
+        auto open() -> bool;
+        auto nextRow() -> const uint16_t*;
+        auto width() const -> uint16_t { return m_width; }
+        auto height() const -> uint16_t { return m_height; }
+
+       private:
+        Source& m_source;
+        std::unique_ptr<uint8_t[]> m_block;
+        std::unique_ptr<LzssStream> m_stream;
+        uint16_t* m_palette = nullptr;
+        uint16_t* m_line = nullptr;
+        uint8_t* m_raw = nullptr;
+        size_t m_rowBytes = 0;
+        uint16_t m_paletteCount = 0;
+        uint16_t m_width = 0;
+        uint16_t m_height = 0;
+        uint16_t m_row = 0;
+        uint8_t m_format = 0;
+    };
+
+    static auto isImagePath(const String& path) -> bool;
+    static auto drawFile(Arduino_TFT* tft, const String& path, int16_t xPos, int16_t yPos) -> bool;
+    static auto draw(Arduino_TFT* tft, Source& source, int16_t xPos, int16_t yPos) -> bool;
+};
+
+#endif  // SRC_DISPLAY_IMAGEASSET_H
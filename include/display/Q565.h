@@ -0,0 +1,92 @@
+#ifndef SRC_DISPLAY_Q565_H
+#define SRC_DISPLAY_Q565_H
+
+#include <Arduino.h>
+#include <Arduino_GFX_Library.h>
+#include <LittleFS.h>
+#include <array>
+
+/**
+ * @class Q565
+ * @brief Player for Q565 animations (QOI-like RGB565 codec with dirty rectangles)
+ *
+ * Files are produced by scripts/q565_encode.py. Decoding keeps a 64 entry colour index and a small read buffer,
+ * pixels are streamed to the panel through the same writeAddrWindow/writePixels line output as the GIF player
+ */
+class Q565 {
+   public:
+    static constexpr size_t HEADER_SIZE = 16;
+
+    Q565();
+    ~Q565();
+
+    auto playOne(const String& path) -> bool;
+    auto update() -> bool;
+    auto stop() -> void;
+    auto isPlaying() const -> bool;
+    auto setLoopEnabled(bool enabled) -> void;
+    auto setViewport(int16_t xPos, int16_t yPos, int16_t width, int16_t height) -> void;
+    auto nextFrameMs() const -> uint32_t;
+
+    static auto isQ565Path(const String& path) -> bool;
+    static auto checkHeader(const uint8_t* data, size_t len, String& error) -> bool;
+
+   private:
+    static constexpr size_t LINEBUF_MAX = 240;
+    static constexpr size_t READBUF_SIZE = 256;
+    static constexpr size_t INDEX_SIZE = 64;
+
+    File m_file;
+    Arduino_TFT* m_tft = nullptr;
+    String m_currentPath;
+
+    bool m_playing = false;
+    bool m_loopEnabled = false;
+    bool m_stopRequested = false;
+
+    uint16_t m_width = 0;
+    uint16_t m_height = 0;
+    uint16_t m_frameTotal = 0;
+    uint16_t m_frameIndex = 0;
+    int16_t m_offsetX = 0;
+    int16_t m_offsetY = 0;
+    int16_t m_viewX = 0;
+    int16_t m_viewY = 0;
+    int16_t m_viewW = 0;
+    int16_t m_viewH = 0;
+
+    uint32_t m_targetMs = 0;
+    uint32_t m_lastFrameMs = 0;
+    uint32_t m_frameCount = 0;
+    uint32_t m_decodeUsTotal = 0;
+
+    std::array<uint8_t, READBUF_SIZE> m_readBuf{};
+    size_t m_readPos = 0;
+    size_t m_readLen = 0;
+    bool m_readError = false;
+
+    std::array<uint16_t, INDEX_SIZE> m_index{};
+    std::array<uint16_t, LINEBUF_MAX> m_lineBuf{};
+    size_t m_lineLen = 0;
+
+    int16_t m_rectX = 0;
+    int16_t m_rectY = 0;
+    uint16_t m_rectW = 0;
+    uint16_t m_rectH = 0;
+    uint16_t m_col = 0;
+    uint16_t m_row = 0;
+    bool m_winOpen = false;
+    bool m_winRowOnly = false;
+
+    auto readByte() -> uint8_t;
+    auto readU16() -> uint16_t;
+    auto readHeader() -> bool;
+    auto rewind() -> bool;
+    auto decodeFrame(uint16_t& delayMs) -> bool;
+    auto emit(uint16_t pixel, uint32_t count) -> void;
+    auto skip(uint32_t count) -> void;
+    auto flushLine() -> void;
+    auto logStats() -> void;
+};
+
+#endif  // SRC_DISPLAY_Q565_H
@@ -0,0 +1,37 @@
+#ifndef SRC_DISPLAY_SCROLLCONSOLE_H
+#define SRC_DISPLAY_SCROLLCONSOLE_H
+
+#include <Arduino.h>
+#include <Arduino_GFX_Library.h>
+
+/**
+ * @class ScrollConsole
+ * @brief Text console scrolled by the ST7789 hardware (see DisplayManager::setScrollRegion)
+ *
+ * The region height is a multiple of the line height, so every new line is drawn in a single band of the frame
+ * memory and nothing else is redrawn when the console scrolls
+ */
+class ScrollConsole {
+   public:
+    auto begin(Arduino_GFX* gfx, int16_t yPos, int16_t height, uint8_t textSize = 1, uint16_t fgColor = 0xFFFF,
+               uint16_t bgColor = 0x0000) -> bool;
+    auto println(const String& text) -> void;
+    auto end() -> void;
+    auto isActive() const -> bool;
+
+   private:
+    static constexpr int16_t CHAR_W = 6;
+    static constexpr int16_t CHAR_H = 8;
+    static constexpr int16_t LINE_SPACING = 2;
+
+    Arduino_GFX* m_gfx = nullptr;
+    bool m_active = false;
+    uint8_t m_textSize = 1;
+    uint16_t m_fgColor = 0xFFFF;
+    uint16_t m_bgColor = 0x0000;
+    int16_t m_lineHeight = 0;
+    uint16_t m_lines = 0;
+    uint16_t m_used = 0;
+};
+
+#endif  // SRC_DISPLAY_SCROLLCONSOLE_H
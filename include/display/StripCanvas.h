@@ -0,0 +1,40 @@
+#ifndef SRC_DISPLAY_STRIPCANVAS_H
+#define SRC_DISPLAY_STRIPCANVAS_H
+
+#include <Arduino.h>
+#include <Arduino_GFX_Library.h>
+#include <functional>
+
+/**
+ * @brief Default band height, 240 x 24 RGB565 is 11.25 KiB of heap while composing
+ */
+static constexpr int16_t STRIP_BAND_HEIGHT = 24;
+
+/**
+ * @class StripCanvas
+ * @brief Offscreen canvas covering the whole screen through one band of rows at a time
+ *
+ * compose() replays the same drawing callback once per band: primitives are clipped to the current band in RAM,
+ * then the band is flushed inside one address window. The screen is built top to bottom with every pixel sent once,
+ * without the partial redraws and overdraw of drawing primitives straight to the panel
+ */
+class StripCanvas : public Arduino_GFX {
+   public:
+    StripCanvas(int16_t width, int16_t height, int16_t bandHeight = STRIP_BAND_HEIGHT);
+    ~StripCanvas() override;
+
+    bool begin(int32_t speed = GFX_NOT_DEFINED) override;
+    void writePixelPreclipped(int16_t xPos, int16_t yPos, uint16_t color) override;
+    void writeFillRectPreclipped(int16_t xPos, int16_t yPos, int16_t width, int16_t height, uint16_t color) override;
+
+    auto compose(Arduino_TFT* tft, uint16_t background, const std::function<void(Arduino_GFX&)>& draw) -> void;
+    auto intersectsBand(int16_t yPos, int16_t height) const -> bool;
+
+   private:
+    uint16_t* m_band = nullptr;
+    int16_t m_bandHeight;
+    int16_t m_bandY = 0;
+    int16_t m_bandRows = 0;
+};
+
+#endif  // SRC_DISPLAY_STRIPCANVAS_H
@@ -0,0 +1,81 @@
+#ifndef SRC_DISPLAY_TRANSITION_H
+#define SRC_DISPLAY_TRANSITION_H
+
+#include <Arduino.h>
+#include <Arduino_GFX_Library.h>
+#include <LittleFS.h>
+#include <memory>
+
+#include "display/ImageAsset.h"
+
+enum class TransitionType : uint8_t { Cut, Crossfade, Wipe, Dissolve };
+
+/**
+ * @brief Full width screen lines produced top to bottom, one transition input
+ */
+class LineSource {
+   public:
+    virtual ~LineSource() = default;
+    virtual auto rewind() -> bool = 0;
+    virtual auto readLine(uint16_t* line, uint16_t width) -> bool = 0;
+};
+
+/**
+ * @brief Screen filled with one colour
+ */
+class SolidLineSource : public LineSource {
+   public:
+    explicit SolidLineSource(uint16_t color) : m_color(color) {}
+
+    auto rewind() -> bool override { return true; }
+    auto readLine(uint16_t* line, uint16_t width) -> bool override;
+
+   private:
+    uint16_t m_color;
+};
+
+/**
+ * @brief Compressed image (.gmi) placed on a solid background, decoded again on every rewind
+ */
+class ImageLineSource : public LineSource {
+   public:
+    ImageLineSource(const String& path, int16_t xPos, int16_t yPos, uint16_t background);
+    ~ImageLineSource() override;
+
+    auto rewind() -> bool override;
+    auto readLine(uint16_t* line, uint16_t width) -> bool override;
+
+   private:
+    String m_path;
+    int16_t m_xPos;
+    int16_t m_yPos;
+    uint16_t m_background;
+
+    File m_file;
+    ImageAsset::FileSource m_source;
+    std::unique_ptr<ImageAsset::RowDecoder> m_decoder;
+    int16_t m_screenRow = 0;
+    int16_t m_decodedRow = -1;
+    const uint16_t* m_row = nullptr;
+};
+
+/**
+ * @class Transition
+ * @brief Animated change between two line sources without any framebuffer
+ *
+ * Each transition frame is built line by line: one line is pulled from both sources, mixed by a Blend565 kernel in
+ * place and pushed to the panel, so the whole screen goes out inside one address window with two line buffers of RAM.
+ * The progress follows the elapsed time, slow sources get fewer frames instead of a longer transition
+ */
+class Transition {
+   public:
+    static auto parseType(const String& name) -> TransitionType;
+    static auto run(Arduino_TFT* tft, LineSource& from, LineSource& to, TransitionType type, uint32_t durationMs)
+        -> bool;
+
+   private:
+    static auto renderFrame(Arduino_TFT* tft, LineSource& from, LineSource& to, TransitionType type,
+                            uint16_t progress, uint16_t* fromLine, uint16_t* toLine) -> bool;
+};
+
+#endif  // SRC_DISPLAY_TRANSITION_H
@@ -0,0 +1,60 @@
+#ifndef SYSTEM_SCHEDULER_H
+#define SYSTEM_SCHEDULER_H
+
+#include <Arduino.h>
+
+/**
+ * @brief Body of a scheduled task, called with the time it may use before a more urgent task is due
+ */
+using SchedulerTaskFn = void (*)(uint32_t budgetUs);
+
+/**
+ * @brief Settings and runtime accounting of one scheduled task
+ */
+struct SchedulerTaskStats {
+    const char* name = "";
+    uint8_t priority = 0;
+    uint32_t periodUs = 0;
+    uint32_t deadlineUs = 0;
+    uint32_t budgetUs = 0;
+    uint32_t runs = 0;
+    uint64_t totalUs = 0;
+    uint32_t maxUs = 0;
+    uint32_t overruns = 0;
+    uint32_t missed = 0;
+    uint32_t maxLatencyUs = 0;
+    float load = 0.0F;
+};
+
+/**
+ * @brief Whole loop accounting of the scheduler
+ */
+struct SchedulerStats {
+    uint32_t passes = 0;
+    float busy = 0.0F;
+    uint32_t maxPassUs = 0;
+};
+
+/**
+ * @class Scheduler
+ * @brief Cooperative time sliced scheduler run from loop()
+ *
+ * Each pass runs the due task with the highest priority, the one released first among equals. A task is released
+ * every periodUs (0 means whenever the loop is free) and is late once it starts more than deadlineUs after its
+ * release. The slice given to a task is its budget, shortened so that it returns before a higher priority task is
+ * due: the tasks check the budget between steps, so a long HTTP request or stream burst cannot delay a frame by more
+ * than one step. Runtime, worst case, overruns, missed deadlines and the share of CPU of every task are kept
+ */
+class Scheduler {
+   public:
+    static constexpr size_t MAX_TASKS = 8;
+
+    static bool add(const char* name, uint8_t priority, uint32_t periodUs, uint32_t deadlineUs, uint32_t budgetUs,
+                    SchedulerTaskFn task);
+    static void run();
+    static size_t getTaskCount();
+    static SchedulerTaskStats getTaskStats(size_t index);
+    static SchedulerStats getStats();
+};
+
+#endif  // SYSTEM_SCHEDULER_H
@@ -0,0 +1,101 @@
+#ifndef SYSTEM_SPSCRING_H
+#define SYSTEM_SPSCRING_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+/**
+ * @class SpscRing
+ * @brief Fixed size single producer, single consumer ring
+ *
+ * The producer owns the head, the consumer the tail. Each side only stores its own index and loads the other one
+ * (release/acquire), so neither has to wait and a slot is never read while it is written. The indexes run freely
+ * and wrap at 2^32, which a power of two capacity divides. Plain C++ without the Arduino core, tested on the host
+ * (test/test_spsc_ring)
+ *
+ * @tparam T Element type, copied in and moved out
+ * @tparam N Capacity, a power of two
+ */
+template <typename T, size_t N>
+class SpscRing {
+    static_assert(N > 0 && (N & (N - 1)) == 0, "SpscRing capacity must be a power of two");
+
+   public:
+    static constexpr size_t CAPACITY = N;
+
+    /**
+     * @brief Whether push() would fail, producer side
+     */
+    auto full() const -> bool {
+        return m_head.load(std::memory_order_relaxed) - m_tail.load(std::memory_order_acquire) >= N;
+    }
+
+    /**
+     * @brief Whether pop() would fail, consumer side
+     */
+    auto empty() const -> bool {
+        return m_tail.load(std::memory_order_relaxed) == m_head.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Append an element, producer side
+     *
+     * @param value Element, copied into the ring
+     * @return false if the ring is full
+     */
+    auto push(const T& value) -> bool { return emplace(value); }
+
+    /**
+     * @brief Append an element, producer side
+     *
+     * @param value Element, moved into the ring only if there is room
+     * @return false if the ring is full
+     */
+    auto push(T&& value) -> bool { return emplace(std::move(value)); }
+
+    /**
+     * @brief Take the oldest element, consumer side
+     *
+     * The slot is moved from, so resources held by the element (a String buffer) are released right away
+     *
+     * @param value Receives the element
+     * @return false if the ring is empty
+     */
+    auto pop(T& value) -> bool {
+        const uint32_t tail = m_tail.load(std::memory_order_relaxed);
+
+        if (tail == m_head.load(std::memory_order_acquire)) {
+            return false;
+        }
+
+        value = std::move(m_slots[tail % N]);
+        m_slots[tail % N] = T();
+        m_tail.store(tail + 1, std::memory_order_release);
+
+        return true;
+    }
+
+   private:
+    template <typename U>
+    auto emplace(U&& value) -> bool {
+        const uint32_t head = m_head.load(std::memory_order_relaxed);
+
+        if (head - m_tail.load(std::memory_order_acquire) >= N) {
+            return false;
+        }
+
+        m_slots[head % N] = std::forward<U>(value);
+        m_head.store(head + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    std::array<T, N> m_slots{};
+    std::atomic<uint32_t> m_head{0};
+    std::atomic<uint32_t> m_tail{0};
+};
+
+#endif  // SYSTEM_SPSCRING_H
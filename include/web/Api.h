@@ -7,10 +7,42 @@ void registerApiEndpoints(Webserver* webserver);
 void handleOtaUpload(Webserver* webserver, int mode);
 void handleOtaFinished(Webserver* webserver);
 void handleReboot(Webserver* webserver);
+void handleLegacyUpdatePage(Webserver* webserver);
 
 void handleGifUpload(Webserver* webserver);
+void handleUploadCreate(Webserver* webserver);
+void handleUploadStatus(Webserver* webserver);
+void handleUploadRange(Webserver* webserver);
+void handleUploadFinish(Webserver* webserver);
+void handleUploadCancel(Webserver* webserver);
+void handleFsManifest(Webserver* webserver);
+void handleFsDelete(Webserver* webserver);
 void handleListGifs(Webserver* webserver);
 void handlePlayGif(Webserver* webserver);
 void handleStopGif(Webserver* webserver);
+void handleFadeGif(Webserver* webserver);
+void handleGetCommandStatus(Webserver* webserver);
+void handleListEffects(Webserver* webserver);
+void handleGetViewports(Webserver* webserver);
+void handleSetViewports(Webserver* webserver);
+void handleGetColorFx(Webserver* webserver);
+void handleSetColorFx(Webserver* webserver);
+void handleGetPanelProfile(Webserver* webserver);
+void handleSetPanelProfile(Webserver* webserver);
+
+void handleListImages(Webserver* webserver);
+void handleDrawImage(Webserver* webserver);
+
+void handleConsolePrint(Webserver* webserver);
+
+void handleDrawList(Webserver* webserver);
+void handleListScenes(Webserver* webserver);
+void handlePlayScene(Webserver* webserver);
+void handleDeleteScene(Webserver* webserver);
+
+void handleGetStreamStats(Webserver* webserver);
+void handleGetSchedulerStats(Webserver* webserver);
+void handleGetClock(Webserver* webserver);
+void handleSetClock(Webserver* webserver);
 
 #endif  // API_H
@@ -0,0 +1,20 @@
+#ifndef WEB_CONTENT_RANGE_H
+#define WEB_CONTENT_RANGE_H
+
+#include <cstddef>
+
+/**
+ * @brief Byte range of an upload chunk, read from a Content-Range request header
+ *
+ * Only the complete form is accepted, "bytes first-last/size" with decimal numbers and first <= last < size. Plain
+ * C++ without the Arduino core, tested on the host (test/test_content_range)
+ */
+struct ContentRange {
+    size_t start = 0;  // offset of the first byte
+    size_t end = 0;    // offset after the last byte
+    size_t total = 0;  // size of the whole upload
+
+    static auto parse(const char* value, ContentRange& range) -> bool;
+};
+
+#endif  // WEB_CONTENT_RANGE_H
@@ -0,0 +1,32 @@
+#ifndef WEB_FILE_MD5_H
+#define WEB_FILE_MD5_H
+
+#include <Arduino.h>
+#include <FS.h>
+#include <MD5Builder.h>
+
+/**
+ * @class FileMd5
+ * @brief MD5 of a LittleFS file computed in time slices, so hashing a large file does not hold the main loop
+ *
+ * begin() opens the file, each step() hashes until its budget is spent and tells whether the digest is ready. The
+ * open file and the MD5 state carry the progress from one call to the next, the caller goes on with other work in
+ * between
+ */
+class FileMd5 {
+   public:
+    auto begin(const String& path) -> bool;
+    auto step(uint32_t budgetUs) -> bool;
+    auto getPath() const -> const String&;
+    auto getDigest() const -> const String&;
+
+    static auto of(const String& path) -> String;
+
+   private:
+    String m_path;
+    String m_digest;
+    File m_file;
+    MD5Builder m_hash;
+};
+
+#endif  // WEB_FILE_MD5_H
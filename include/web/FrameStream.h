@@ -0,0 +1,49 @@
+#ifndef FRAME_STREAM_H
+#define FRAME_STREAM_H
+
+#include <Arduino.h>
+
+/**
+ * @brief Frame stream header size, keeps the pixel data 32 bit aligned in the lwIP receive buffer
+ */
+static constexpr size_t FRAME_STREAM_HEADER_SIZE = 14;
+
+/**
+ * @brief Pixel formats of a frame stream packet
+ */
+enum class FrameStreamFormat : uint8_t { Raw565, Rle565, Indexed8, Rle8, Palette };
+
+/**
+ * @brief Counters of the remote frame stream
+ */
+struct FrameStreamStats {
+    uint16_t port = 0;
+    bool active = false;
+    uint32_t packets = 0;
+    uint32_t frames = 0;
+    uint32_t bytes = 0;
+    uint32_t dropped = 0;
+    uint32_t errors = 0;
+    float fps = 0.0F;
+    uint32_t lastLatencyUs = 0;
+    uint32_t maxLatencyUs = 0;
+};
+
+/**
+ * @class FrameStream
+ * @brief Remote display over UDP: dirty rectangles of pixels pushed by a host (see scripts/frame_sender.py)
+ *
+ * Every datagram is one rectangle: a 14 byte little endian header (magic "GF", format, flags, frame id, x, y, w, h)
+ * followed by its pixels. The lwIP receive callback only queues the pbuf, update() then streams the payload from the
+ * pbuf to the SPI bus inside one address window: raw big endian RGB565 goes to writeBytes() as is and RLE runs to
+ * writeRepeat(), without any intermediate copy. Indexed pixels are looked up in a 256 colour palette sent beforehand.
+ * The packet flagged as end of frame is acknowledged to the sender with the frame latency measured on the device
+ */
+class FrameStream {
+   public:
+    static bool begin(uint16_t port);
+    static void update(uint32_t budgetUs);
+    static FrameStreamStats getStats();
+};
+
+#endif  // FRAME_STREAM_H
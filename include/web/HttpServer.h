@@ -0,0 +1,129 @@
+#ifndef WEB_HTTP_SERVER_H
+#define WEB_HTTP_SERVER_H
+
+#include <Arduino.h>
+#include <ESP8266WebServer.h>
+#include <FS.h>
+#include <array>
+#include <functional>
+#include <utility>
+#include <vector>
+
+struct tcp_pcb;
+struct pbuf;
+
+/**
+ * @class HttpServer
+ * @brief Event driven HTTP/1.1 server on the lwIP raw TCP API
+ *
+ * The lwIP callbacks only accept connections and queue the received pbufs. handleClient() then parses every open
+ * connection incrementally within a small time budget, streams multipart uploads to the upload handler in
+ * HTTP_UPLOAD_BUFLEN chunks and pushes responses as far as the TCP send buffer allows, so a large file or a slow client
+ * never holds the main loop. Bytes are acknowledged to the peer only once parsed, which throttles fast senders.
+ * Handlers use the same calls as with ESP8266WebServer: arg(), header(), upload(), sendHeader(), setContentLength(),
+ * send(), send_P() and streamFile(). A body of unknown length is produced piece by piece with sendChunked() as the
+ * connection drains, so its size does not matter
+ */
+class HttpServer {
+   public:
+    using THandlerFunction = std::function<void()>;
+    using TBodyFunction = std::function<void(Print& out)>;
+    using TChunkFunction = std::function<bool(Print& out)>;
+
+    static constexpr size_t MAX_CONNECTIONS = 4;
+    static constexpr size_t MAX_LINE = 512;
+    static constexpr size_t MAX_BODY = 16384;
+    static constexpr size_t MAX_BODIES = MAX_BODY;
+    static constexpr size_t TX_CHUNK = 1460;
+    static constexpr size_t CHUNK_TARGET = 512;
+    static constexpr uint32_t IDLE_TIMEOUT_MS = 5000;
+    static constexpr uint32_t BUDGET_US = 8000;
+
+    explicit HttpServer(uint16_t port);
+    ~HttpServer();
+    HttpServer(const HttpServer&) = delete;
+    auto operator=(const HttpServer&) -> HttpServer& = delete;
+
+    auto begin() -> void;
+    auto handleClient(uint32_t budgetUs = BUDGET_US) -> void;
+
+    auto on(const String& uri, THandlerFunction handler) -> void;
+    auto on(const String& uri, HTTPMethod method, THandlerFunction handler) -> void;
+    auto on(const String& uri, HTTPMethod method, THandlerFunction handler, THandlerFunction uploadHandler) -> void;
+    auto onNotFound(THandlerFunction handler) -> void;
+
+    auto uri() const -> String;
+    auto method() const -> HTTPMethod;
+    auto arg(const String& name) const -> String;
+    auto hasArg(const String& name) const -> bool;
+    auto body() const -> const String&;
+    auto contentType() const -> const String&;
+    auto collectHeader(const String& name) -> void;
+    auto header(const String& name) const -> String;
+    auto upload() -> HTTPUpload& { return m_upload; }
+
+    auto sendHeader(const String& name, const String& value, bool first = false) -> void;
+    auto setContentLength(size_t length) -> void;
+    auto send(int code, const char* contentType, const String& content) -> void;
+    auto send(int code, const String& contentType, const String& content) -> void;
+    auto send(int code, const char* contentType, size_t length, const TBodyFunction& body) -> void;
+    auto sendChunked(int code, const char* contentType, TChunkFunction producer) -> void;
+    auto streamFile(File& file, const String& contentType) -> size_t;
+    auto send_P(int code, const char* contentType, const uint8_t* content, size_t length) -> void;
+
+    auto getConnectionCount() const -> size_t;
+
+   private:
+    struct Route {
+        String uri;
+        HTTPMethod method;
+        THandlerFunction handler;
+        THandlerFunction upload;
+    };
+    struct Connection;
+
+    uint16_t m_port;
+    tcp_pcb* m_listener = nullptr;
+    std::vector<Route> m_routes;
+    std::vector<String> m_collected;
+    THandlerFunction m_notFound;
+    std::array<Connection*, MAX_CONNECTIONS> m_connections{};
+    size_t m_next = 0;
+    Connection* m_current = nullptr;
+    Connection* m_uploadOwner = nullptr;
+    HTTPUpload m_upload;
+    std::array<uint8_t, TX_CHUNK> m_chunk{};
+
+    static auto onAccept(void* arg, tcp_pcb* pcb, int8_t err) -> int8_t;
+    static auto onReceive(void* arg, tcp_pcb* pcb, pbuf* buf, int8_t err) -> int8_t;
+    static auto onError(void* arg, int8_t err) -> void;
+
+    auto service(Connection& conn, uint32_t startUs, uint32_t budgetUs) -> void;
+    auto readLine(Connection& conn) -> bool;
+    auto handleLine(Connection& conn) -> void;
+    auto handleHeader(Connection& conn, const String& name, const String& value) -> void;
+    auto beginBody(Connection& conn) -> void;
+    auto readBody(Connection& conn) -> bool;
+    auto readMultipart(Connection& conn) -> bool;
+    auto beginPart(Connection& conn) -> bool;
+    auto emitPart(Connection& conn, const uint8_t* data, size_t len) -> void;
+    auto endPart(Connection& conn) -> void;
+    auto abortUpload(Connection& conn) -> void;
+    auto callUpload(Connection& conn, HTTPUploadStatus status) -> void;
+    auto completeBody(Connection& conn) -> void;
+    auto dispatch(Connection& conn) -> void;
+    auto reject(Connection& conn, int code) -> void;
+    auto sendUnavailable(Connection& conn) -> void;
+    auto bufferedBodies() const -> size_t;
+    auto buildHead(Connection& conn, int code, const String& contentType, size_t length) const -> String;
+    auto pump(Connection& conn) -> bool;
+    auto nextChunk(Connection& conn) -> void;
+    auto finishResponse(Connection& conn) -> void;
+    auto close(size_t slot) -> void;
+
+    static auto parseArgs(Connection& conn, const String& query) -> void;
+    static auto urlDecode(const String& text) -> String;
+    static auto reasonPhrase(int code) -> const char*;
+};
+
+#endif  // WEB_HTTP_SERVER_H
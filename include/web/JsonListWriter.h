@@ -0,0 +1,126 @@
+#ifndef WEB_JSON_LIST_WRITER_H
+#define WEB_JSON_LIST_WRITER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+/**
+ * @class JsonListWriter
+ * @brief Framing of a streamed list {<head members>, "<key>": [items], "next": cursor}, written piece by piece
+ *
+ * The caller serialises the head and the items, the writer adds everything around them: the head object reopened
+ * after its members, the list member, the commas, the limit and the "next" cursor (the cursor of the last item sent
+ * when the limit cut the list, null once it is complete). Out is anything with print(const char*) and print(char),
+ * an Arduino Print in the firmware. Plain C++ without the Arduino core, tested on the host (test/test_json_list)
+ */
+class JsonListWriter {
+   public:
+    /**
+     * @param head Head object serialised as JSON, anything else counts as an empty object
+     * @param key Name of the list member
+     * @param limit Maximum number of items, SIZE_MAX for all
+     */
+    JsonListWriter(const char* head, const char* key, size_t limit) : m_key(key), m_limit(limit) {
+        const size_t length = head != nullptr ? strlen(head) : 0;
+
+        if (length >= 2 && head[0] == '{' && head[length - 1] == '}') {
+            m_head.assign(head, length - 1);  // reopen the object after its members
+        } else {
+            m_head = "{";
+        }
+    }
+
+    /**
+     * @brief Write the head members and open the list
+     */
+    template <typename Out>
+    auto writeHead(Out& out) -> void {
+        out.print(m_head.c_str());
+        out.print(m_head.length() > 1 ? ",\"" : "\"");
+        out.print(m_key.c_str());
+        out.print("\":[");
+    }
+
+    /**
+     * @brief Make room for the next item: false once the limit is reached, otherwise the separator is written and
+     * the caller serialises the item
+     *
+     * @param cursor Value that resumes the list after this item
+     */
+    template <typename Out>
+    auto beginItem(Out& out, const char* cursor) -> bool {
+        if (m_count >= m_limit) {
+            return false;
+        }
+        if (m_count > 0) {
+            out.print(',');
+        }
+
+        m_cursor = cursor != nullptr ? cursor : "";
+        m_count++;
+
+        return true;
+    }
+
+    /**
+     * @brief Close the list and the object
+     *
+     * @param cut Whether items were left over, "next" is then the cursor of the last item written
+     */
+    template <typename Out>
+    auto writeEnd(Out& out, bool cut) -> void {
+        out.print("],\"next\":");
+
+        if (cut) {
+            writeString(out, m_cursor);
+        } else {
+            out.print("null");
+        }
+
+        out.print('}');
+    }
+
+    /**
+     * @brief Number of items written
+     */
+    auto count() const -> size_t { return m_count; }
+
+   private:
+    /**
+     * @brief Write a JSON string, quotes, backslashes and control characters escaped, UTF-8 kept as is
+     */
+    template <typename Out>
+    static auto writeString(Out& out, const std::string& value) -> void {
+        static constexpr const char* HEX_DIGITS = "0123456789abcdef";
+        static constexpr uint8_t FIRST_PRINTABLE = 0x20;
+
+        out.print('"');
+
+        for (const char character : value) {
+            const auto code = static_cast<uint8_t>(character);
+
+            if (character == '"' || character == '\\') {
+                out.print('\\');
+                out.print(character);
+            } else if (code < FIRST_PRINTABLE) {
+                out.print("\\u00");
+                out.print(HEX_DIGITS[code >> 4]);
+                out.print(HEX_DIGITS[code & 0x0F]);
+            } else {
+                out.print(character);
+            }
+        }
+
+        out.print('"');
+    }
+
+    std::string m_head;
+    std::string m_key;
+    std::string m_cursor;
+    size_t m_limit;
+    size_t m_count = 0;
+};
+
+#endif  // WEB_JSON_LIST_WRITER_H
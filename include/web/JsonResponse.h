@@ -0,0 +1,29 @@
+#ifndef WEB_JSON_RESPONSE_H
+#define WEB_JSON_RESPONSE_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <functional>
+
+#include "web/Webserver.h"
+
+/**
+ * @brief Outcome of one call of a list producer: an item, nothing ready yet (called again on the next main loop
+ * pass, for work spread over several calls) or the end of the list
+ */
+enum class JsonListStep : uint8_t { Item, Pending, End };
+
+/**
+ * @brief Produces the items of a streamed JSON list one at a time
+ *
+ * @param item Empty document to fill with the next item
+ * @param cursor Set to the value that resumes the list after this item
+ * @return Item when item was filled, Pending to be called again later, End once there is no item left
+ */
+using JsonListNextFn = std::function<JsonListStep(JsonDocument& item, String& cursor)>;
+
+auto readJsonBody(Webserver* webserver, JsonDocument& doc) -> DeserializationError;
+void sendJson(Webserver* webserver, int code, const JsonDocument& doc);
+void sendJsonList(Webserver* webserver, const JsonDocument& head, const char* key, size_t limit, JsonListNextFn next);
+
+#endif  // WEB_JSON_RESPONSE_H
@@ -0,0 +1,96 @@
+#ifndef WEB_OTA_STREAM_H
+#define WEB_OTA_STREAM_H
+
+#include <Arduino.h>
+#include <array>
+#include <bearssl/bearssl_hash.h>
+
+enum class OtaFormat : uint8_t { Unknown, Raw, Gzip, Delta };
+
+/**
+ * @class OtaStream
+ * @brief Feeds an uploaded firmware or file system image to Updater, whatever form it was sent in
+ *
+ * The format is recognised from the first bytes:
+ * - a plain image is written as is
+ * - a gzip image (firmware only) is written as is too, eboot inflates it while installing it on reboot
+ * - a delta (firmware only, made by scripts/ota_delta.py) is applied against the running sketch as it arrives
+ *
+ * The bytes handed to Updater are hashed with SHA-256, end() refuses the image when they do not match the digest
+ * given to begin(). For a delta that is the digest of the rebuilt firmware, for the others the one of the uploaded
+ * file.
+ *
+ * Delta layout, little endian, header of DELTA_HEADER_SIZE bytes:
+ *
+ *     magic "GDLT" | version u8 | 3 reserved | source size u32 | target size u32 | source MD5 (16 bytes)
+ *
+ * then operations until target size bytes were produced:
+ *
+ *     0x00 COPY | zigzag varint source offset change | varint length   copies from the running sketch
+ *     0x01 DATA | varint length | bytes                                 new bytes
+ *
+ * The source offset of a COPY is relative to the end of the previous COPY, so runs of the old image that only moved
+ * a little cost a few bytes
+ */
+class OtaStream {
+   public:
+    static constexpr size_t DELTA_HEADER_SIZE = 32;
+    static constexpr size_t SHA256_SIZE = 32;
+
+    auto begin(int mode, const String& sha256 = String()) -> bool;
+    auto write(const uint8_t* data, size_t len) -> bool;
+    auto end() -> bool;
+    auto abort() -> void;
+
+    auto getFormat() const -> OtaFormat;
+    auto getReceived() const -> size_t;
+    auto getWritten() const -> size_t;
+    auto getElapsedMs() const -> uint32_t;
+    auto getError() const -> const String&;
+
+    static auto formatName(OtaFormat format) -> const char*;
+    static auto available(int mode) -> size_t;
+    static auto discard() -> void;
+
+   private:
+    enum class DeltaState : uint8_t { Header, Op, Varint, Data };
+
+    static constexpr size_t COPY_BUFFER = 256;
+
+    int m_mode = 0;
+    OtaFormat m_format = OtaFormat::Unknown;
+    size_t m_received = 0;
+    size_t m_written = 0;
+    uint32_t m_startMs = 0;
+    uint32_t m_elapsedMs = 0;
+    bool m_failed = false;
+    String m_error;
+
+    br_sha256_context m_sha{};
+    std::array<uint8_t, SHA256_SIZE> m_expected{};
+    bool m_verify = false;
+
+    std::array<uint8_t, DELTA_HEADER_SIZE> m_header{};
+    DeltaState m_state = DeltaState::Header;
+    size_t m_headerFill = 0;
+    uint8_t m_op = 0;
+    uint8_t m_varintIndex = 0;
+    uint8_t m_varintShift = 0;
+    uint32_t m_varint = 0;
+    int32_t m_copyChange = 0;
+    size_t m_remaining = 0;
+    size_t m_sourcePos = 0;
+    size_t m_sourceSize = 0;
+    size_t m_targetSize = 0;
+
+    auto detect(const uint8_t* data, size_t len) -> bool;
+    auto emit(const uint8_t* data, size_t len) -> bool;
+    auto writeDelta(const uint8_t* data, size_t len) -> bool;
+    auto checkDeltaHeader() -> bool;
+    auto takeVarint(uint8_t byte) -> bool;
+    auto endVarint() -> bool;
+    auto copySource() -> bool;
+    auto fail(const String& error) -> bool;
+};
+
+#endif  // WEB_OTA_STREAM_H
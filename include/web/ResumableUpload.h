@@ -0,0 +1,69 @@
+#ifndef WEB_RESUMABLE_UPLOAD_H
+#define WEB_RESUMABLE_UPLOAD_H
+
+#include <Arduino.h>
+
+#include "web/UploadWriter.h"
+
+enum class UploadTarget : uint8_t { File, Firmware, Filesystem };
+
+/**
+ * @class ResumableUpload
+ * @brief Upload sent as numbered ranges, which survives a dropped connection
+ *
+ * A session is created for a target and a size, the client then sends the file in ranges starting at the committed
+ * offset and finalises it with the MD5 of the whole file. After an interruption the client asks the offset again and
+ * carries on from there instead of starting over.
+ *
+ * A file is written to path + UploadWriter::TEMP_SUFFIX, each range is committed to LittleFS before it is
+ * acknowledged and the session is saved in SESSION_PATH, so it also resumes after a reboot. The file replaces path
+ * once its MD5 matches. Firmware and file system images go through Updater, whose state does not survive a reboot:
+ * those sessions resume across connections only, and Updater checks the MD5 before the image is activated.
+ *
+ * One session at a time, a new one replaces the previous
+ */
+class ResumableUpload {
+   public:
+    static constexpr const char* SESSION_PATH = "/upload.json";
+
+    auto create(UploadTarget target, const String& path, size_t size, size_t headerSize = 0,
+                UploadWriter::THeaderCheck check = nullptr) -> bool;
+    auto write(const String& uploadId, size_t start, const uint8_t* data, size_t len) -> bool;
+    auto finish(const String& uploadId, const String& md5) -> bool;
+    auto cancel(const String& uploadId) -> bool;
+
+    auto isActive() -> bool;
+    auto getId() const -> const String&;
+    auto getTarget() const -> UploadTarget;
+    auto getPath() const -> const String&;
+    auto getSize() const -> size_t;
+    auto getOffset() const -> size_t;
+    auto getFailure() const -> UploadFailure;
+    auto getError() const -> const String&;
+
+   private:
+    bool m_restored = false;
+    bool m_active = false;
+    UploadTarget m_target = UploadTarget::File;
+    String m_id;
+    String m_path;
+    size_t m_size = 0;
+    size_t m_offset = 0;
+    size_t m_headerSize = 0;
+    UploadWriter::THeaderCheck m_check;
+    UploadFailure m_failure = UploadFailure::None;
+    String m_error;
+
+    auto restore() -> void;
+    auto save() const -> bool;
+    auto tempPath() const -> String;
+    auto session(const String& uploadId) -> bool;
+    auto beginUpdate() -> bool;
+    auto writeFile(const uint8_t* data, size_t len) -> bool;
+    auto finishFile(const String& md5) -> bool;
+    auto finishUpdate(const String& md5) -> bool;
+    auto clear() -> void;
+    auto fail(UploadFailure failure, const String& error) -> bool;
+};
+
+#endif  // WEB_RESUMABLE_UPLOAD_H
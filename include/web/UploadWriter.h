@@ -0,0 +1,77 @@
+#ifndef WEB_UPLOAD_WRITER_H
+#define WEB_UPLOAD_WRITER_H
+
+#include <Arduino.h>
+#include <FS.h>
+#include <functional>
+#include <memory>
+
+/**
+ * @brief Why an upload was refused or failed
+ */
+enum class UploadFailure : uint8_t { None, NoSpace, Rejected, WriteFailed, NoSession, OutOfRange, BadChecksum };
+
+/**
+ * @brief Outcome of an upload written through UploadWriter
+ */
+struct UploadStats {
+    size_t bytes = 0;
+    uint32_t elapsedMs = 0;
+    uint32_t writes = 0;
+    uint32_t sectorsUsed = 0;
+    float kbps = 0.0F;
+};
+
+/**
+ * @class UploadWriter
+ * @brief Writes an upload to LittleFS in whole flash sectors
+ *
+ * The upload handler receives about 2 KiB per call, in pieces that do not line up with the flash. Each piece
+ * written as is leaves a partial page that the file system reads back and programs again on the next write. The
+ * writer stages the data in a sector sized buffer and writes it once full, so every write but the last one covers an
+ * aligned 4 KiB span of the file. The expected size is checked against the free space before anything is written
+ *
+ * The first bytes can be handed to a header check before they reach the flash, a file of the wrong kind is then
+ * refused after one chunk instead of once written. The upload goes to path + TEMP_SUFFIX and is renamed over path
+ * once complete, so a failed upload leaves the previous file in place and no reader sees a partial one
+ */
+class UploadWriter {
+   public:
+    static constexpr size_t BUFFER_SIZE = 4096;
+    static constexpr size_t SECTOR_SIZE = 4096;
+    static constexpr const char* TEMP_SUFFIX = ".part";
+
+    using THeaderCheck = std::function<bool(const uint8_t* head, size_t len, String& error)>;
+
+    auto begin(const String& path, size_t expectedSize = 0, size_t headerSize = 0, THeaderCheck check = nullptr)
+        -> bool;
+    auto write(const uint8_t* data, size_t len) -> bool;
+    auto finish() -> bool;
+    auto abort() -> void;
+    auto isOpen() const -> bool;
+    auto getPath() const -> const String&;
+    auto getStats() const -> UploadStats;
+    auto getFailure() const -> UploadFailure;
+    auto getError() const -> const String&;
+
+   private:
+    File m_file;
+    String m_path;
+    String m_tempPath;
+    THeaderCheck m_check;
+    size_t m_headerSize = 0;
+    UploadFailure m_failure = UploadFailure::None;
+    String m_error;
+    std::unique_ptr<uint8_t[]> m_buffer;
+    size_t m_fill = 0;
+    size_t m_usedBefore = 0;
+    uint32_t m_startMs = 0;
+    UploadStats m_stats;
+
+    auto checkHeader(bool complete) -> bool;
+    auto fail(UploadFailure failure, const String& error) -> bool;
+    auto flush() -> bool;
+    auto release() -> void;
+};
+
+#endif  // WEB_UPLOAD_WRITER_H
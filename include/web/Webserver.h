@@ -2,40 +2,72 @@
 #define WEB_SERVER_H
 
 #include <Arduino.h>
-#include <ESP8266WebServer.h>
 #include <LittleFS.h>
 #include <functional>
 
+#include "web/HttpServer.h"
+
 /**
  * @brief HTTP status code 200
  */
 static int constexpr HTTP_CODE_OK = 200;
 
+/**
+ * @brief HTTP status code 202
+ */
+static int constexpr HTTP_CODE_ACCEPTED = 202;
+
+/**
+ * @brief HTTP status code 304
+ */
+static int constexpr HTTP_CODE_NOT_MODIFIED = 304;
+
+/**
+ * @brief HTTP status code 400
+ */
+static int constexpr HTTP_CODE_BAD_REQUEST = 400;
+
 /**
  * @brief HTTP status code 404
  */
 static int constexpr HTTP_CODE_NOT_FOUND = 404;
 
+/**
+ * @brief HTTP status code 413
+ */
+static int constexpr HTTP_CODE_PAYLOAD_TOO_LARGE = 413;
+
+/**
+ * @brief HTTP status code 416
+ */
+static int constexpr HTTP_CODE_RANGE_NOT_SATISFIABLE = 416;
+
 /**
  * @brief HTTP status code 500
  */
 static int constexpr HTTP_CODE_INTERNAL_ERROR = 500;
 
+/**
+ * @brief HTTP status code 503
+ */
+static int constexpr HTTP_CODE_SERVICE_UNAVAILABLE = 503;
+
 class Webserver {
    public:
     explicit Webserver(uint16_t port = 80);
     static auto beginFS(bool formatIfFailed = false) -> bool;
     void begin();
-    void handleClient();
+    void handleClient(uint32_t budgetUs = HttpServer::BUDGET_US);
     void on(const String& uri, HTTPMethod method, std::function<void()> handler);
     void on(const String& uri, std::function<void()> handler);
     void serveStatic(const String& uri, const String& path, const String& contentType = String(),
                      int cacheSeconds = 86400, bool tryGzip = true);
+    void serveBundle();
     void onNotFound(std::function<void()> handler);
-    ESP8266WebServer& raw();
+    HttpServer& raw();
 
    private:
-    ESP8266WebServer _server;
+    HttpServer _server;
     static String guessContentType(const String& path);
 };
 
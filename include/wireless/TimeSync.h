@@ -0,0 +1,18 @@
+#ifndef TIME_SYNC_H
+#define TIME_SYNC_H
+
+#include <Arduino.h>
+#include <time.h>
+
+/**
+ * @class TimeSync
+ * @brief SNTP client of the ESP8266 core, keeps the system clock (time()) synchronised in the background
+ */
+class TimeSync {
+   public:
+    static void begin(const char* server, const char* timezone);
+    static bool isSynced();
+    static bool getLocalTime(struct tm& out);
+};
+
+#endif  // TIME_SYNC_H
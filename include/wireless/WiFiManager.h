@@ -10,6 +10,7 @@ class WiFiManager {
     void begin();
     bool startStationMode();
     bool startAccessPointMode();
+    void update();
     bool isApMode() const;
     IPAddress getIP() const;
 
@@ -19,6 +20,7 @@ class WiFiManager {
     const char* _apSsid;
     const char* _apPass;
     bool _apMode = false;
+    bool _connected = false;
 };
 
 #endif  // WIFI_MANAGER_H
@@ -1,6 +1,18 @@
+#include <algorithm>
+#include <cstring>
 #include <ctime>
 #include "Logger.h"
 
+/**
+ * @brief Size of the buffer holding log output until the UART can take it
+ */
+static constexpr size_t LOG_BUFFER_SIZE = 1024;
+
+static char s_buffer[LOG_BUFFER_SIZE];
+static size_t s_head = 0;
+static size_t s_count = 0;
+static bool s_buffered = false;
+
 /**
  * @brief Logs a message with a specified log level
  *
@@ -10,20 +22,21 @@
  */
 void Logger::log(LogLevel level, const char* message, const char* className) {
     printTime();
-    Serial.print("(");
-    Serial.print(levelToString(level));
-    Serial.print(")");
-    Serial.print("::");
+    write("(");
+    write(levelToString(level));
+    write(")");
+    write("::");
 
     if (className != nullptr && className[0] != '\0') {
-        Serial.print(className);
+        write(className);
     } else {
-        Serial.print("Global");
+        write("Global");
     }
 
-    Serial.print(": ");
+    write(": ");
 
-    Serial.println(message);
+    write(message);
+    write("\r\n");
 }
 
 /**
@@ -58,6 +71,77 @@ void Logger::warn(const char* message, const char* className) { log(LOG_WARN, me
  */
 void Logger::error(const char* message, const char* className) { log(LOG_ERROR, message, className); }
 
+/**
+ * @brief Queue the output instead of writing it to the serial port directly
+ *
+ * The UART only holds 128 bytes, a log line written while it is full blocks until enough of it is sent. Buffered
+ * output is sent by flush() as the UART frees up; a line that does not fit in the buffer still waits for it to drain
+ * so nothing is lost
+ *
+ * @param buffered true to queue the output, false to drain it and write directly again
+ */
+void Logger::setBuffered(bool buffered) {
+    if (!buffered) {
+        drain();
+    }
+
+    s_buffered = buffered;
+}
+
+/**
+ * @brief Send as much buffered output as the UART accepts without waiting
+ */
+void Logger::flush() {
+    size_t room = static_cast<size_t>(std::max(0, Serial.availableForWrite()));
+
+    while (s_count > 0 && room > 0) {
+        size_t tail = (s_head + LOG_BUFFER_SIZE - s_count) % LOG_BUFFER_SIZE;
+        size_t chunk = std::min({room, s_count, LOG_BUFFER_SIZE - tail});
+
+        Serial.write(reinterpret_cast<const uint8_t*>(s_buffer + tail), chunk);
+        s_count -= chunk;
+        room -= chunk;
+    }
+}
+
+/**
+ * @brief Send all buffered output, waiting for the UART
+ */
+void Logger::drain() {
+    while (s_count > 0) {
+        size_t tail = (s_head + LOG_BUFFER_SIZE - s_count) % LOG_BUFFER_SIZE;
+        size_t chunk = std::min(s_count, LOG_BUFFER_SIZE - tail);
+
+        Serial.write(reinterpret_cast<const uint8_t*>(s_buffer + tail), chunk);
+        s_count -= chunk;
+    }
+}
+
+/**
+ * @brief Write text to the serial port or to the buffer
+ *
+ * @param text Null terminated text
+ */
+void Logger::write(const char* text) {
+    size_t len = strlen(text);
+
+    if (!s_buffered || len > LOG_BUFFER_SIZE) {
+        drain();
+        Serial.print(text);
+        return;
+    }
+
+    if (len > LOG_BUFFER_SIZE - s_count) {
+        drain();
+    }
+
+    for (size_t i = 0; i < len; ++i) {
+        s_buffer[s_head] = text[i];
+        s_head = (s_head + 1) % LOG_BUFFER_SIZE;
+    }
+    s_count += len;
+}
+
 /**
  * @brief Print the current local time in [HH:MM:SS]
  */
@@ -66,7 +150,7 @@ void Logger::printTime() {
     std::time_t t = std::time(nullptr);
     std::tm* now = std::localtime(&t);
     snprintf(buffer, sizeof(buffer), "[%02d:%02d:%02d]", now->tm_hour, now->tm_min, now->tm_sec);
-    Serial.print(buffer);
+    write(buffer);
 }
 
 /**
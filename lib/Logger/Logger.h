@@ -12,8 +12,12 @@ class Logger {
     static void info(const char* message, const char* className = nullptr);
     static void warn(const char* message, const char* className = nullptr);
     static void error(const char* message, const char* className = nullptr);
+    static void setBuffered(bool buffered);
+    static void flush();
 
    private:
+    static void write(const char* text);
+    static void drain();
     static void printTime();
     static const char* levelToString(LogLevel level);
 };
@@ -0,0 +1,215 @@
+#!/usr/bin/env python3
+"""
+Compare the cost of the control API in JSON and in MessagePack on a device
+
+Sends the same requests over one kept alive connection, first as JSON then as MessagePack (Content-Type and Accept
+set to application/msgpack), checks that both encodings decode to the same answer and prints the latency and the
+bytes of each. The default requests read the colour settings and write them back unchanged, so the screen is not
+touched; --play adds a GIF play command
+
+Usage:
+
+    python3 scripts/api_bench.py 192.168.1.42
+    python3 scripts/api_bench.py 192.168.1.42 --count 500 --play geek.gif
+
+No dependency, the MessagePack codec below covers the types the API uses
+"""
+
+import argparse
+import http.client
+import json
+import statistics
+import struct
+import sys
+import time
+
+MSGPACK = "application/msgpack"
+
+
+def pack(value):
+    """Encode nil, bool, int, float, str, list and dict"""
+    if value is None:
+        return b"\xc0"
+    if value is True:
+        return b"\xc3"
+    if value is False:
+        return b"\xc2"
+    if isinstance(value, int):
+        if 0 <= value < 0x80:
+            return bytes([value])
+        if -32 <= value < 0:
+            return struct.pack("b", value)
+        if value >= 0:
+            return b"\xcf" + struct.pack(">Q", value) if value > 0xFFFFFFFF else b"\xce" + struct.pack(">I", value)
+        return b"\xd3" + struct.pack(">q", value)
+    if isinstance(value, float):
+        return b"\xcb" + struct.pack(">d", value)
+    if isinstance(value, str):
+        data = value.encode("utf-8")
+        if len(data) < 32:
+            return bytes([0xA0 | len(data)]) + data
+        return b"\xda" + struct.pack(">H", len(data)) + data
+    if isinstance(value, list):
+        head = bytes([0x90 | len(value)]) if len(value) < 16 else b"\xdc" + struct.pack(">H", len(value))
+        return head + b"".join(pack(item) for item in value)
+    if isinstance(value, dict):
+        head = bytes([0x80 | len(value)]) if len(value) < 16 else b"\xde" + struct.pack(">H", len(value))
+        return head + b"".join(pack(k) + pack(v) for k, v in value.items())
+    raise TypeError(f"cannot pack {type(value).__name__}")
+
+
+def unpack(data, pos=0):
+    """Decode one value, returns it and the position after it"""
+    tag = data[pos]
+    pos += 1
+
+    if tag < 0x80:
+        return tag, pos
+    if tag >= 0xE0:
+        return tag - 0x100, pos
+    if 0xA0 <= tag <= 0xBF:
+        end = pos + (tag & 0x1F)
+        return data[pos:end].decode("utf-8"), end
+    if 0x90 <= tag <= 0x9F or 0x80 <= tag <= 0x8F:
+        return unpack_container(data, pos, tag & 0x0F, tag < 0x90)
+
+    fixed = {
+        0xC0: (0, None),
+        0xC2: (0, False),
+        0xC3: (0, True),
+        0xCA: (4, ">f"),
+        0xCB: (8, ">d"),
+        0xCC: (1, ">B"),
+        0xCD: (2, ">H"),
+        0xCE: (4, ">I"),
+        0xCF: (8, ">Q"),
+        0xD0: (1, ">b"),
+        0xD1: (2, ">h"),
+        0xD2: (4, ">i"),
+        0xD3: (8, ">q"),
+    }
+    if tag in fixed:
+        size, fmt = fixed[tag]
+        if size == 0:
+            return fmt, pos
+        return struct.unpack(fmt, data[pos : pos + size])[0], pos + size
+
+    lengths = {0xD9: ">B", 0xDA: ">H", 0xDB: ">I", 0xDC: ">H", 0xDD: ">I", 0xDE: ">H", 0xDF: ">I"}
+    if tag in lengths:
+        fmt = lengths[tag]
+        size = struct.calcsize(fmt)
+        count = struct.unpack(fmt, data[pos : pos + size])[0]
+        pos += size
+        if tag <= 0xDB:
+            return data[pos : pos + count].decode("utf-8"), pos + count
+        return unpack_container(data, pos, count, tag >= 0xDE)
+
+    raise ValueError(f"unsupported MessagePack tag 0x{tag:02x}")
+
+
+def unpack_container(data, pos, count, is_map):
+    if is_map:
+        result = {}
+        for _ in range(count):
+            key, pos = unpack(data, pos)
+            result[key], pos = unpack(data, pos)
+        return result, pos
+
+    result = []
+    for _ in range(count):
+        item, pos = unpack(data, pos)
+        result.append(item)
+    return result, pos
+
+
+def request(conn, method, path, body, msgpack):
+    """One request, returns the decoded answer, the latency in ms and the bytes sent and received in the bodies"""
+    headers = {"Accept": MSGPACK if msgpack else "application/json"}
+    payload = None
+
+    if body is not None:
+        payload = pack(body) if msgpack else json.dumps(body, separators=(",", ":")).encode()
+        headers["Content-Type"] = MSGPACK if msgpack else "application/json"
+
+    start = time.perf_counter()
+    conn.request(method, path, body=payload, headers=headers)
+    response = conn.getresponse()
+    data = response.read()
+    elapsed = (time.perf_counter() - start) * 1000
+
+    if response.status >= 400:
+        raise SystemExit(f"{method} {path}: HTTP {response.status} {data[:200]!r}")
+
+    content_type = response.getheader("Content-Type", "")
+    if msgpack and content_type != MSGPACK:
+        raise SystemExit(f"{method} {path}: expected {MSGPACK}, got {content_type}")
+
+    decoded = unpack(data)[0] if msgpack else json.loads(data)
+
+    return decoded, elapsed, len(payload or b""), len(data)
+
+
+def bench(host, port, cases, count, msgpack):
+    conn = http.client.HTTPConnection(host, port, timeout=10)
+    results = {}
+
+    for name, method, path, body in cases:
+        request(conn, method, path, body, msgpack)  # warm up
+        times = []
+        for _ in range(count):
+            answer, elapsed, sent, received = request(conn, method, path, body, msgpack)
+            times.append(elapsed)
+        results[name] = (answer, times, sent, received)
+
+    conn.close()
+
+    return results
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compare JSON and MessagePack on the control API")
+    parser.add_argument("host", help="device address")
+    parser.add_argument("--port", type=int, default=80)
+    parser.add_argument("--count", type=int, default=200, help="requests per case and encoding")
+    parser.add_argument("--play", help="also benchmark /api/v1/gif/play with this GIF")
+    args = parser.parse_args()
+
+    conn = http.client.HTTPConnection(args.host, args.port, timeout=10)
+    fx = request(conn, "GET", "/api/v1/display/fx", None, False)[0]
+    conn.close()
+
+    cases = [
+        ("get fx", "GET", "/api/v1/display/fx", None),
+        ("set fx", "POST", "/api/v1/display/fx", fx),
+    ]
+    if args.play:
+        cases.append(("play gif", "POST", "/api/v1/gif/play", {"name": args.play}))
+
+    as_json = bench(args.host, args.port, cases, args.count, False)
+    as_msgpack = bench(args.host, args.port, cases, args.count, True)
+
+    print(f"{'case':<10} {'encoding':<8} {'mean ms':>8} {'p50 ms':>8} {'p95 ms':>8} {'sent B':>7} {'recv B':>7}")
+    failed = False
+
+    for name, _, _, _ in cases:
+        for label, results in (("json", as_json), ("msgpack", as_msgpack)):
+            _, times, sent, received = results[name]
+            times = sorted(times)
+            p95 = times[int(len(times) * 0.95) - 1]
+            print(
+                f"{name:<10} {label:<8} {statistics.mean(times):8.2f} {statistics.median(times):8.2f} {p95:8.2f} "
+                f"{sent:7d} {received:7d}"
+            )
+
+        # command ids differ between runs, everything else must decode the same
+        left = {k: v for k, v in as_json[name][0].items() if k != "id"}
+        right = {k: v for k, v in as_msgpack[name][0].items() if k != "id"}
+        if left != right:
+            print(f"{name}: answers differ: {left} != {right}", file=sys.stderr)
+            failed = True
+
+    sys.exit(1 if failed else 0)
+
+
+if __name__ == "__main__":
+    main()
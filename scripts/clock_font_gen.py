@@ -0,0 +1,170 @@
+#!/usr/bin/env python3
+"""
+Generate include/display/ClockFont.h, the digit sprites of the clock face
+
+Each glyph (0-9, ':' and '-') is a seven segment style sprite drawn at 4x and downsampled for anti-aliasing, then
+encoded as a 4 bit palette GMI asset (see image_encode.py) and stored in flash. The clock decodes a glyph with the
+regular ImageAsset decoder only when that digit changes
+
+Usage:
+
+    python3 scripts/clock_font_gen.py
+    python3 scripts/clock_font_gen.py --color FFB040 --ghost 201810
+
+Requires Pillow (pip install pillow)
+"""
+
+import argparse
+import os
+import sys
+
+try:
+    from PIL import Image, ImageDraw
+except ImportError:
+    print("Pillow is required: pip install pillow", file=sys.stderr)
+    sys.exit(1)
+
+sys.path.insert(0, os.path.dirname(__file__))
+from image_encode import encode_image  # noqa: E402
+
+DIGIT_W = 48
+DIGIT_H = 88
+COLON_W = 24
+SUPERSAMPLE = 4
+GLYPHS = "0123456789:-"
+DEFAULT_OUTPUT = os.path.normpath(os.path.join(os.path.dirname(__file__), "..", "include", "display", "ClockFont.h"))
+
+# Lit segments per digit, segment order a (top) b c d e f g (middle), clockwise from the top
+SEGMENTS = {
+    "0": "abcdef",
+    "1": "bc",
+    "2": "abdeg",
+    "3": "abcdg",
+    "4": "bcfg",
+    "5": "acdfg",
+    "6": "acdefg",
+    "7": "abc",
+    "8": "abcdefg",
+    "9": "abcdfg",
+    "-": "g",
+}
+
+
+def parse_colour(value):
+    return tuple(int(value[i : i + 2], 16) for i in (0, 2, 4))
+
+
+def segment_polygons(width, height):
+    """Hexagonal segments inside a width x height box"""
+    thick = width * 18 // 100
+    half = thick // 2
+    gap = max(1, thick // 6)
+    left = half
+    right = width - half - 1
+    top = half
+    mid = height // 2
+    bottom = height - half - 1
+
+    def horizontal(y):
+        x0, x1 = left + gap, right - gap
+        return [(x0, y), (x0 + half, y - half), (x1 - half, y - half), (x1, y), (x1 - half, y + half), (x0 + half, y + half)]
+
+    def vertical(x, y0, y1):
+        y0, y1 = y0 + gap, y1 - gap
+        return [(x, y0), (x + half, y0 + half), (x + half, y1 - half), (x, y1), (x - half, y1 - half), (x - half, y0 + half)]
+
+    return {
+        "a": horizontal(top),
+        "b": vertical(right, top, mid),
+        "c": vertical(right, mid, bottom),
+        "d": horizontal(bottom),
+        "e": vertical(left, mid, bottom),
+        "f": vertical(left, top, mid),
+        "g": horizontal(mid),
+    }
+
+
+def render_glyph(char, colour, ghost, bg):
+    width = COLON_W if char == ":" else DIGIT_W
+    big = Image.new("RGB", (width * SUPERSAMPLE, DIGIT_H * SUPERSAMPLE), bg)
+    draw = ImageDraw.Draw(big)
+
+    if char == ":":
+        radius = width * SUPERSAMPLE // 5
+        cx = width * SUPERSAMPLE // 2
+        for cy in (DIGIT_H * SUPERSAMPLE * 3 // 10, DIGIT_H * SUPERSAMPLE * 7 // 10):
+            draw.ellipse((cx - radius, cy - radius, cx + radius, cy + radius), fill=colour)
+    else:
+        # 2 pixel margin on each side so neighbouring digits do not touch
+        margin = 2 * SUPERSAMPLE
+        polygons = segment_polygons(width * SUPERSAMPLE - 2 * margin, DIGIT_H * SUPERSAMPLE - 2 * margin)
+        for name, points in polygons.items():
+            shifted = [(x + margin, y + margin) for x, y in points]
+            draw.polygon(shifted, fill=colour if name in SEGMENTS[char] else ghost)
+
+    return big.resize((width, DIGIT_H), Image.Resampling.LANCZOS)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate the flash resident clock digit sprites")
+    parser.add_argument("-o", "--output", default=DEFAULT_OUTPUT, help="generated header path")
+    parser.add_argument("--color", default="E0F0FF", help="lit segment colour as RRGGBB hex")
+    parser.add_argument("--ghost", default="181C24", help="unlit segment colour as RRGGBB hex")
+    parser.add_argument("--bg", default="000000", help="background colour as RRGGBB hex")
+    args = parser.parse_args()
+
+    colour = parse_colour(args.color)
+    ghost = parse_colour(args.ghost)
+    bg = parse_colour(args.bg)
+
+    data = bytearray()
+    offsets = []
+
+    for char in GLYPHS:
+        offsets.append(len(data))
+        gmi, _, _ = encode_image(render_glyph(char, colour, ghost, bg), "pal4", 8, 4, f"glyph '{char}'")
+        data += gmi
+
+    offsets.append(len(data))
+
+    lines = [
+        "// Generated by scripts/clock_font_gen.py, do not edit",
+        f"// Colours: {args.color} lit, {args.ghost} unlit, {args.bg} background",
+        "#ifndef SRC_DISPLAY_CLOCKFONT_H",
+        "#define SRC_DISPLAY_CLOCKFONT_H",
+        "",
+        "#include <Arduino.h>",
+        "#include <array>",
+        "",
+        f"static constexpr uint16_t CLOCK_DIGIT_W = {DIGIT_W};",
+        f"static constexpr uint16_t CLOCK_DIGIT_H = {DIGIT_H};",
+        f"static constexpr uint16_t CLOCK_COLON_W = {COLON_W};",
+        f"static constexpr uint8_t CLOCK_GLYPH_COUNT = {len(GLYPHS)};",
+        "",
+        "// Glyph order: 0-9, ':', '-'",
+        f"static constexpr uint8_t CLOCK_GLYPH_COLON = {GLYPHS.index(':')};",
+        f"static constexpr uint8_t CLOCK_GLYPH_DASH = {GLYPHS.index('-')};",
+        "",
+        "// Byte offset of each glyph in CLOCK_GLYPH_DATA, the last entry is the total size",
+        f"static constexpr std::array<uint16_t, {len(offsets)}> CLOCK_GLYPH_OFFSETS = {{"
+        + ", ".join(str(o) for o in offsets)
+        + "};",
+        "",
+        "// One 4 bit palette GMI asset per glyph",
+        f"static const uint8_t CLOCK_GLYPH_DATA[{len(data)}] PROGMEM __attribute__((aligned(4))) = {{",
+    ]
+
+    for i in range(0, len(data), 16):
+        lines.append("    " + ", ".join(f"0x{b:02X}" for b in data[i : i + 16]) + ",")
+
+    lines += ["};", "", "#endif  // SRC_DISPLAY_CLOCKFONT_H", ""]
+
+    with open(args.output, "w") as f:
+        f.write("\n".join(lines))
+
+    raw = (DIGIT_W * 11 + COLON_W) * DIGIT_H * 2
+    print(f"{args.output}: {len(GLYPHS)} glyphs, {len(data)} bytes of flash ({raw} bytes as RGB565)")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,145 @@
+#!/usr/bin/env python3
+"""
+Loopback test of the remote frame stream without a device
+
+A reference receiver bound on 127.0.0.1 decodes the datagrams the way src/web/FrameStream.cpp does (address window,
+raw / RLE / indexed pixels, palette updates) into a framebuffer and acknowledges every frame. The sender side is the
+encoder of frame_sender.py; after each acknowledged frame the framebuffer must equal the source frame
+
+Usage:
+
+    python3 scripts/frame_loopback.py
+    python3 scripts/frame_loopback.py --frames 200 --palette
+    python3 scripts/frame_loopback.py --payload 512        # smaller datagrams, more bands per span
+
+Prints the throughput of the encoder and the traffic per frame, exits with 1 on the first mismatch
+"""
+
+import argparse
+import array
+import os
+import socket
+import struct
+import sys
+import threading
+import time
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+
+import frame_sender as fs  # noqa: E402
+
+
+class Receiver(threading.Thread):
+    """Reference decoder of the frame stream"""
+
+    def __init__(self):
+        super().__init__(daemon=True)
+        self.sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        self.sock.setsockopt(socket.SOL_SOCKET, socket.SO_RCVBUF, 1 << 22)
+        self.sock.bind(("127.0.0.1", 0))
+        self.port = self.sock.getsockname()[1]
+        self.fb = array.array("H", [0] * (fs.WIDTH * fs.HEIGHT))
+        self.palette = [0] * 256
+        self.errors = 0
+        self.frame_start = None
+
+    def draw(self, fmt, x, y, w, h, payload):
+        pixels = []
+        if fmt == fs.RAW565:
+            pixels = [(payload[i] << 8) | payload[i + 1] for i in range(0, len(payload) - 1, 2)]
+        elif fmt == fs.INDEXED8:
+            pixels = [self.palette[i] for i in payload]
+        elif fmt in (fs.RLE565, fs.RLE8):
+            step = 3 if fmt == fs.RLE565 else 2
+            for i in range(0, len(payload) - step + 1, step):
+                if fmt == fs.RLE565:
+                    color = (payload[i + 1] << 8) | payload[i + 2]
+                else:
+                    color = self.palette[payload[i + 1]]
+                pixels += [color] * (payload[i] + 1)
+        if len(pixels) != w * h:
+            return False
+        for row in range(h):
+            start = (y + row) * fs.WIDTH + x
+            self.fb[start : start + w] = array.array("H", pixels[row * w : (row + 1) * w])
+        return True
+
+    def run(self):
+        while True:
+            data, addr = self.sock.recvfrom(2048)
+            if self.frame_start is None:
+                self.frame_start = time.perf_counter()
+            if len(data) < fs.HEADER_SIZE:
+                self.errors += 1
+                continue
+            magic, fmt, flags, frame, x, y, w, h = struct.unpack(fs.HEADER, data[: fs.HEADER_SIZE])
+            payload = data[fs.HEADER_SIZE :]
+            if magic != fs.MAGIC or fmt > fs.PALETTE:
+                self.errors += 1
+                continue
+            if fmt == fs.PALETTE:
+                if x + w > 256 or len(payload) < 2 * w:
+                    self.errors += 1
+                    continue
+                for i in range(w):
+                    self.palette[x + i] = (payload[2 * i] << 8) | payload[2 * i + 1]
+            elif w == 0 or h == 0 or x + w > fs.WIDTH or y + h > fs.HEIGHT or not self.draw(fmt, x, y, w, h, payload):
+                self.errors += 1
+            if flags & fs.FLAG_END:
+                latency_us = int((time.perf_counter() - self.frame_start) * 1e6)
+                self.frame_start = None
+                self.sock.sendto(struct.pack(fs.ACK, fs.ACK_MAGIC, frame, latency_us, 0), addr)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Check the frame stream encoder against a reference receiver")
+    parser.add_argument("--frames", type=int, default=120, help="number of test pattern frames")
+    parser.add_argument("--palette", action="store_true", help="send frames as palette indexes")
+    parser.add_argument("--payload", type=int, default=fs.MAX_PAYLOAD, help="maximum payload per datagram")
+    args = parser.parse_args()
+
+    receiver = Receiver()
+    receiver.start()
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.settimeout(2.0)
+    target = ("127.0.0.1", receiver.port)
+
+    prev = None
+    palette = None
+    datagrams = 0
+    total_bytes = 0
+    formats = {}
+    start = time.perf_counter()
+
+    for n, pixels in enumerate(fs.dashboard_frames(args.frames)):
+        packets, palette = fs.encode_frame(n, pixels, prev, args.palette, palette, args.payload)
+        prev = pixels
+        if not packets:
+            continue
+
+        for packet in packets:
+            fmt = packet[2]
+            formats[fmt] = formats.get(fmt, 0) + 1
+            sock.sendto(packet, target)
+            datagrams += 1
+            total_bytes += len(packet)
+
+        data, _ = sock.recvfrom(64)
+        magic, frame, _, _ = struct.unpack(fs.ACK, data[: fs.ACK_SIZE])
+        if magic != fs.ACK_MAGIC or frame != n & 0xFFFF:
+            print(f"frame {n}: bad acknowledgement", file=sys.stderr)
+            sys.exit(1)
+        if receiver.errors or receiver.fb != pixels:
+            diff = sum(1 for a, b in zip(receiver.fb, pixels) if a != b)
+            print(f"frame {n}: {diff} pixels differ, {receiver.errors} bad datagrams", file=sys.stderr)
+            sys.exit(1)
+
+    elapsed = time.perf_counter() - start
+    names = {fs.RAW565: "raw565", fs.RLE565: "rle565", fs.INDEXED8: "indexed8", fs.RLE8: "rle8", fs.PALETTE: "palette"}
+    usage = ", ".join(f"{names[f]} {c}" for f, c in sorted(formats.items()))
+    print(f"{args.frames} frames OK in {elapsed:.2f} s ({args.frames / elapsed:.1f} fps host side)")
+    print(f"{datagrams} datagrams ({usage}), {total_bytes / args.frames / 1024:.1f} KiB/frame")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,337 @@
+#!/usr/bin/env python3
+"""
+Drive the display as a remote screen: render frames on the host and push the dirty rectangles over UDP
+
+Packet layout (little endian header, 14 bytes):
+
+    magic "GF" | format u8 | flags u8 | frame u16 | x u16 | y u16 | w u16 | h u16 | payload
+
+    format 0 raw565   : w * h big endian RGB565
+    format 1 rle565   : runs of (count - 1) u8 | RGB565 big endian
+    format 2 indexed8 : w * h palette indexes
+    format 3 rle8     : runs of (count - 1) u8 | palette index
+    format 4 palette  : x is the first palette index, w the number of entries, then w big endian RGB565
+
+    flags bit 0 marks the last packet of a frame, the device answers it with
+    "GA" | frame u16 | latency us u32 | dropped datagrams u32
+
+Each frame is diffed against the previous one in 16x16 tiles, the dirty tiles are merged into horizontal spans and
+split in row bands that fit one datagram. Every band uses the smallest of the raw and RLE encodings; with --palette
+frames of at most 256 colours are sent as indexes, new colours being appended to the palette of the device
+
+Usage:
+
+    python3 scripts/frame_sender.py 192.168.1.42                     # animated dashboard test pattern
+    python3 scripts/frame_sender.py 192.168.1.42 --frames 600 --fps 30
+    python3 scripts/frame_sender.py 192.168.1.42 --image anim.gif    # needs Pillow
+    python3 scripts/frame_sender.py 192.168.1.42 --palette
+
+See scripts/frame_loopback.py to check the encoder against a reference receiver without a device
+"""
+
+import argparse
+import array
+import math
+import socket
+import struct
+import sys
+import time
+
+HEADER = "<HBBHHHHH"
+HEADER_SIZE = struct.calcsize(HEADER)
+ACK = "<HHII"
+ACK_SIZE = struct.calcsize(ACK)
+MAGIC = 0x4647
+ACK_MAGIC = 0x4147
+FLAG_END = 0x01
+
+RAW565 = 0
+RLE565 = 1
+INDEXED8 = 2
+RLE8 = 3
+PALETTE = 4
+
+WIDTH = 240
+HEIGHT = 240
+TILE = 16
+DEFAULT_PORT = 4210
+# Stay below the Ethernet MTU, the device does not reassemble IP fragments
+MAX_PAYLOAD = 1400
+
+
+def rgb_to_565(r, g, b):
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+
+
+def pack_565(pixels):
+    """Big endian RGB565, the byte order of the panel"""
+    data = array.array("H", pixels)
+    if sys.byteorder == "little":
+        data.byteswap()
+    return data.tobytes()
+
+
+def rle_encode(values, wide):
+    """Runs of at most 256 equal values: (count - 1) then the value on 1 or 2 bytes"""
+    out = bytearray()
+    i = 0
+    count = len(values)
+    while i < count:
+        value = values[i]
+        run = 1
+        while i + run < count and run < 256 and values[i + run] == value:
+            run += 1
+        if wide:
+            out += bytes((run - 1, value >> 8, value & 0xFF))
+        else:
+            out += bytes((run - 1, value))
+        i += run
+    return bytes(out)
+
+
+def header(fmt, flags, frame, x, y, w, h):
+    return struct.pack(HEADER, MAGIC, fmt, flags, frame & 0xFFFF, x, y, w, h)
+
+
+def dirty_spans(pixels, prev, width=WIDTH, height=HEIGHT):
+    """Rectangles (x, y, w, h) covering the tiles that changed, merged along each tile row"""
+    if prev is None:
+        return [(0, 0, width, height)]
+
+    spans = []
+    for ty in range(0, height, TILE):
+        th = min(TILE, height - ty)
+        start = None
+        for tx in range(0, width + TILE, TILE):
+            dirty = False
+            if tx < width:
+                tw = min(TILE, width - tx)
+                for y in range(ty, ty + th):
+                    row = y * width
+                    if pixels[row + tx : row + tx + tw] != prev[row + tx : row + tx + tw]:
+                        dirty = True
+                        break
+            if dirty and start is None:
+                start = tx
+            elif not dirty and start is not None:
+                spans.append((start, ty, min(tx, width) - start, th))
+                start = None
+    return spans
+
+
+def encode_row(pixels, indexes, width, x, y, w):
+    """Encodings of one row of a span: {format: bytes}"""
+    row = pixels[y * width + x : y * width + x + w]
+    if indexes is None:
+        return {RAW565: pack_565(row), RLE565: rle_encode(row, True)}
+    idx = indexes[y * width + x : y * width + x + w]
+    return {INDEXED8: bytes(idx), RLE8: rle_encode(idx, False)}
+
+
+def encode_span(pixels, indexes, width, span, max_payload=MAX_PAYLOAD):
+    """Split a span in row bands that fit a datagram, each with its smallest encoding: [(fmt, x, y, w, h, payload)]"""
+    x, y, w, h = span
+    bands = []
+    rows = [encode_row(pixels, indexes, width, x, y + r, w) for r in range(h)]
+    r = 0
+    while r < h:
+        best = None
+        for fmt in rows[r]:
+            size = 0
+            count = 0
+            while r + count < h and size + len(rows[r + count][fmt]) <= max_payload:
+                size += len(rows[r + count][fmt])
+                count += 1
+            # A single row always fits, 240 pixels are at most 720 bytes
+            count = max(count, 1)
+            # Prefer the encoding covering more rows, then the smaller one
+            score = (count, -sum(len(rows[r + i][fmt]) for i in range(count)))
+            if best is None or score > best[0]:
+                best = (score, fmt, count)
+        _, fmt, count = best
+        payload = b"".join(rows[r + i][fmt] for i in range(count))
+        bands.append((fmt, x, y + r, w, count, payload))
+        r += count
+    return bands
+
+
+def build_palette(pixels, previous=None):
+    """
+    Palette and index bytes if the frame has at most 256 colours, else (None, None)
+
+    The colours of the previous palette keep their index so that only new colours have to be sent, they take the free
+    entries. When the palette is full it is rebuilt from the colours of this frame
+    """
+    palette = list(previous or [])
+    colors = {color: index for index, color in enumerate(palette)}
+    for p in set(pixels):
+        if p not in colors:
+            if len(palette) == 256:
+                return build_palette(pixels) if previous else (None, None)
+            colors[p] = len(palette)
+            palette.append(p)
+    return palette, bytes(colors[p] for p in pixels)
+
+
+def encode_frame(frame, pixels, prev, use_palette=False, sent_palette=None, max_payload=MAX_PAYLOAD):
+    """
+    Datagrams of one frame, the last one flagged as end of frame
+
+    Returns (packets, palette known by the device); an unchanged frame gives no packet
+    """
+    indexes = None
+    palette = sent_palette
+    packets = []
+
+    if use_palette:
+        new_palette, indexes = build_palette(pixels, sent_palette)
+        if new_palette is not None and new_palette != sent_palette:
+            # The panel keeps colours, not indexes, so the dirty rectangles stay valid across a palette change
+            known = sent_palette or []
+            first = len(known) if new_palette[: len(known)] == known else 0
+            palette = new_palette
+            entries = palette[first:]
+            packets.append(header(PALETTE, 0, frame, first, 0, len(entries), 1) + pack_565(entries))
+
+    bands = []
+    for span in dirty_spans(pixels, prev):
+        bands += encode_span(pixels, indexes, WIDTH, span, max_payload)
+
+    if not bands:
+        return [], palette
+
+    for i, (fmt, x, y, w, h, payload) in enumerate(bands):
+        flags = FLAG_END if i == len(bands) - 1 else 0
+        packets.append(header(fmt, flags, frame, x, y, w, h) + payload)
+    return packets, palette
+
+
+def fill(pixels, x, y, w, h, color, width=WIDTH):
+    x0, y0 = max(x, 0), max(y, 0)
+    x1, y1 = min(x + w, width), min(y + h, len(pixels) // width)
+    if x1 <= x0:
+        return
+    line = array.array("H", [color] * (x1 - x0))
+    for row in range(y0, y1):
+        pixels[row * width + x0 : row * width + x1] = line
+
+
+def dashboard_frames(count):
+    """Animated test pattern: static background, scrolling gradient, bouncing box, bar graph and an orbiting marker"""
+    background = array.array("H", [0] * (WIDTH * HEIGHT))
+    for y in range(HEIGHT):
+        fill(background, 0, y, WIDTH, 1, rgb_to_565(0, y // 4, 40 + y // 3))
+    fill(background, 8, 8, WIDTH - 16, 2, 0xFFFF)
+
+    for n in range(count):
+        pixels = array.array("H", background)
+        bx = int(100 + 90 * math.sin(n / 17.0))
+        by = int(60 + 40 * math.cos(n / 11.0))
+        fill(pixels, bx, by, 24, 24, rgb_to_565(255, 160, 0))
+        for b in range(8):
+            level = int(40 + 35 * math.sin(n / 9.0 + b))
+            fill(pixels, 16 + b * 26, 230 - level, 20, level, rgb_to_565(40, 200, 80))
+        mx = int(WIDTH / 2 + 60 * math.cos(n / 8.0))
+        my = int(120 + 30 * math.sin(n / 8.0))
+        fill(pixels, mx - 3, my - 3, 6, 6, 0xFFFF)
+        # Scrolling gradient strip, no run to compress
+        shades = ((x + 3 * n) % 32 for x in range(WIDTH))
+        strip = array.array("H", (rgb_to_565(8 * s, 0, 255 - 8 * s) for s in shades))
+        for y in range(20, 36):
+            pixels[y * WIDTH : (y + 1) * WIDTH] = strip
+        yield pixels
+
+
+def image_frames(paths, count):
+    try:
+        from PIL import Image, ImageSequence
+    except ImportError:
+        print("Pillow is required for --image: pip install pillow", file=sys.stderr)
+        sys.exit(1)
+
+    frames = []
+    for path in paths:
+        with Image.open(path) as img:
+            for frame in ImageSequence.Iterator(img):
+                rgb = frame.convert("RGB").resize((WIDTH, HEIGHT))
+                frames.append(array.array("H", (rgb_to_565(*p) for p in rgb.getdata())))
+    for n in range(count):
+        yield frames[n % len(frames)]
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Stream frames to the display over UDP")
+    parser.add_argument("host", help="device address")
+    parser.add_argument("--port", type=int, default=DEFAULT_PORT, help="stream_port of config.json")
+    parser.add_argument("--frames", type=int, default=300, help="number of frames to send")
+    parser.add_argument("--fps", type=float, default=0, help="frame rate cap, 0 to send as fast as acknowledged")
+    parser.add_argument("--image", nargs="+", help="stream these images or animated GIFs instead of the test pattern")
+    parser.add_argument("--palette", action="store_true", help="send frames of up to 256 colours as indexes")
+    parser.add_argument("--timeout", type=float, default=0.5, help="seconds to wait for a frame acknowledgement")
+    args = parser.parse_args()
+
+    source = image_frames(args.image, args.frames) if args.image else dashboard_frames(args.frames)
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.settimeout(args.timeout)
+    target = (args.host, args.port)
+
+    prev = None
+    palette = None
+    sent = 0
+    acked = 0
+    lost = 0
+    dropped = 0
+    total_bytes = 0
+    rtts = []
+    latencies = []
+    start = time.perf_counter()
+
+    for n, pixels in enumerate(source):
+        frame_start = time.perf_counter()
+        packets, palette = encode_frame(n, pixels, prev, args.palette, palette)
+        prev = pixels
+        if not packets:
+            continue
+
+        for packet in packets:
+            sock.sendto(packet, target)
+            total_bytes += len(packet)
+        sent += 1
+
+        # Waiting for the acknowledgement paces the sender to what the device can draw
+        while True:
+            try:
+                data, _ = sock.recvfrom(64)
+            except socket.timeout:
+                # Part of the frame may be missing on the device, resend everything with the next one
+                lost += 1
+                prev = None
+                palette = None
+                break
+            if len(data) < ACK_SIZE:
+                continue
+            magic, ack_frame, latency_us, dropped = struct.unpack(ACK, data[:ACK_SIZE])
+            if magic == ACK_MAGIC and ack_frame == n & 0xFFFF:
+                acked += 1
+                rtts.append(time.perf_counter() - frame_start)
+                latencies.append(latency_us)
+                break
+
+        if args.fps > 0:
+            delay = frame_start + 1.0 / args.fps - time.perf_counter()
+            if delay > 0:
+                time.sleep(delay)
+
+    elapsed = time.perf_counter() - start
+    print(f"{sent} frames sent, {acked} acknowledged, {lost} lost, {dropped} datagrams dropped by the device")
+    print(f"{acked / elapsed:.1f} fps, {total_bytes / max(sent, 1) / 1024:.1f} KiB/frame")
+    if rtts:
+        rtts.sort()
+        latencies.sort()
+        p95 = rtts[len(rtts) * 95 // 100]
+        print(f"round trip   avg {1000 * sum(rtts) / len(rtts):.1f} ms, p95 {1000 * p95:.1f} ms")
+        print(f"device draw  avg {sum(latencies) / len(latencies) / 1000:.1f} ms, max {latencies[-1] / 1000:.1f} ms")
+
+
+if __name__ == "__main__":
+    main()
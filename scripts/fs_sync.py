@@ -0,0 +1,123 @@
+#!/usr/bin/env python3
+"""
+Sync a local directory to the device file system, file by file, instead of flashing a whole LittleFS image
+
+The device lists its files with their size and MD5 (GET /api/v1/fs/manifest), only the files missing or different
+on the device are sent, each through the resumable upload API (see upload_resume.py): the device writes it next to
+the old one and swaps them once the MD5 matched, so an interrupted sync never leaves a half written file. Files the
+device has and the directory does not are kept, unless --delete is given; even then GIFs, images, scenes and the
+configuration are left alone (--keep)
+
+Usage:
+
+    python3 scripts/fs_sync.py 192.168.1.42
+    python3 scripts/fs_sync.py 192.168.1.42 data --delete --dry-run
+"""
+
+import argparse
+import hashlib
+import os
+import sys
+import urllib.parse
+
+from upload_resume import call, send
+
+KEEP = ("/gif/", "/img/", "/scenes/", "/config.json")
+
+
+def local_files(root):
+    """Device path to local path of every file under root"""
+    files = {}
+
+    for directory, _, names in os.walk(root):
+        for name in names:
+            local = os.path.join(directory, name)
+            path = "/" + os.path.relpath(local, root).replace(os.sep, "/")
+            files[path] = local
+
+    return files
+
+
+def file_digest(local):
+    """(size, md5) of a local file, as the device manifest reports them"""
+    md5 = hashlib.md5()
+    size = 0
+
+    with open(local, "rb") as f:
+        for block in iter(lambda: f.read(65536), b""):
+            md5.update(block)
+            size += len(block)
+
+    return size, md5.hexdigest()
+
+
+def device_files(host, port):
+    """Device path to (size, md5) of every file on the device"""
+    status, answer = call(host, port, "GET", "/api/v1/fs/manifest")
+    if status != 200:
+        raise SystemExit(f"manifest: HTTP {status} {answer.get('message', '')}")
+
+    print(f"device: {answer.get('used', 0)} of {answer.get('total', 0)} bytes used")
+
+    return {entry["path"]: (entry["size"], entry["md5"]) for entry in answer["files"]}
+
+
+def plan(local, remote, delete=False, keep=KEEP):
+    """What to send and delete so the device matches the directory
+
+    local and remote map device paths to (size, md5). Returns the paths to send (missing or different on the device),
+    the paths to delete (on the device only, when delete is set and no keep prefix matches) and the number unchanged
+    """
+    send_paths = [path for path in sorted(local) if remote.get(path) != local[path]]
+    delete_paths = []
+
+    if delete:
+        delete_paths = [path for path in sorted(set(remote) - set(local)) if not path.startswith(tuple(keep))]
+
+    return send_paths, delete_paths, len(local) - len(send_paths)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Sync a directory to the device file system")
+    parser.add_argument("host", help="device address")
+    parser.add_argument("dir", nargs="?", default="data", help="local directory mirrored at the root of LittleFS")
+    parser.add_argument("--port", type=int, default=80)
+    parser.add_argument("--delete", action="store_true", help="delete device files missing from the directory")
+    parser.add_argument("--keep", action="append", help="device path prefix never deleted, replaces the defaults")
+    parser.add_argument("--dry-run", action="store_true", help="only print what would change")
+    args = parser.parse_args()
+
+    if not os.path.isdir(args.dir):
+        raise SystemExit(f"{args.dir} is not a directory")
+
+    local = local_files(args.dir)
+    remote = device_files(args.host, args.port)
+    keep = tuple(args.keep) if args.keep else KEEP
+    digests = {path: file_digest(local_path) for path, local_path in local.items()}
+    send_paths, delete_paths, unchanged = plan(digests, remote, args.delete, keep)
+    sent = 0
+
+    for path in send_paths:
+        with open(local[path], "rb") as f:
+            data = f.read()
+
+        print(f"{'update' if path in remote else 'add'} {path} ({len(data)} bytes)")
+        if not args.dry_run:
+            send(args.host, args.port, {"target": "file", "path": path}, data, quiet=True)
+        sent += len(data)
+
+    for path in delete_paths:
+        print(f"delete {path}")
+        if args.dry_run:
+            continue
+
+        status, answer = call(args.host, args.port, "DELETE", "/api/v1/fs/file?path=" + urllib.parse.quote(path))
+        if status != 200:
+            print(f"delete {path}: HTTP {status} {answer.get('message', '')}", file=sys.stderr)
+
+    total = sum(os.path.getsize(local_path) for local_path in local.values())
+    print(f"{unchanged} unchanged, {sent} of {total} bytes sent, {len(delete_paths)} deleted")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,254 @@
+#!/usr/bin/env python3
+"""
+Encode an image into a compressed GMI asset for DisplayManager::drawImage
+
+Pixels are stored as RGB565, or as 8/4 bit indexes into an RGB565 palette,
+then compressed with a small-window LZSS using the heatshrink bitstream
+layout, so the device can decode row by row with a few hundred bytes of
+window instead of inflating the whole image in RAM
+
+File layout (little endian):
+
+    header  : "GMIM" | version u8 | format u8 | width u16 | height u16 | palette u16
+              | window_bits u8 | lookahead_bits u8 | reserved u16
+    palette : palette * u16 RGB565
+    data    : LZSS bitstream of height rows of row_bytes each
+              (RGB565 little endian, one byte per index, or two 4 bit indexes per byte high nibble first)
+
+LZSS bitstream (MSB first): 1 + 8 bits literal byte,
+0 + window_bits (distance - 1) + lookahead_bits (length - 1) back reference
+
+Usage:
+
+    python3 scripts/image_encode.py logo.png -o data/img/logo.gmi
+    python3 scripts/image_encode.py icon.png --format pal4 --window 8
+
+Requires Pillow (pip install pillow)
+"""
+
+import argparse
+import os
+import struct
+import sys
+
+try:
+    from PIL import Image
+except ImportError:
+    print("Pillow is required: pip install pillow", file=sys.stderr)
+    sys.exit(1)
+
+MAGIC = b"GMIM"
+VERSION = 1
+FORMATS = {"rgb565": 0, "pal8": 1, "pal4": 2}
+MAX_SIZE = 240
+MAX_CHAIN = 48
+
+
+def rgb_to_565(r, g, b):
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+
+
+class BitWriter:
+    def __init__(self):
+        self.out = bytearray()
+        self.acc = 0
+        self.count = 0
+
+    def write(self, value, bits):
+        for shift in range(bits - 1, -1, -1):
+            self.acc = (self.acc << 1) | ((value >> shift) & 1)
+            self.count += 1
+            if self.count == 8:
+                self.out.append(self.acc)
+                self.acc = 0
+                self.count = 0
+
+    def finish(self):
+        if self.count:
+            self.out.append(self.acc << (8 - self.count))
+            self.acc = 0
+            self.count = 0
+        return bytes(self.out)
+
+
+def lzss_compress(data, window_bits, lookahead_bits):
+    window = 1 << window_bits
+    max_len = 1 << lookahead_bits
+    backref_bits = 1 + window_bits + lookahead_bits
+    writer = BitWriter()
+    chains = {}
+    i = 0
+    n = len(data)
+
+    def insert(pos):
+        if pos + 1 < n:
+            key = data[pos] | (data[pos + 1] << 8)
+            chain = chains.setdefault(key, [])
+            chain.append(pos)
+            if len(chain) > MAX_CHAIN:
+                del chain[0]
+
+    while i < n:
+        best_len = 0
+        best_dist = 0
+
+        if i + 1 < n:
+            key = data[i] | (data[i + 1] << 8)
+            for cand in reversed(chains.get(key, ())):
+                dist = i - cand
+                if dist > window:
+                    break
+                length = 0
+                limit = min(max_len, n - i)
+                while length < limit and data[cand + length] == data[i + length]:
+                    length += 1
+                if length > best_len:
+                    best_len = length
+                    best_dist = dist
+                    if length == limit:
+                        break
+
+        if best_len * 9 > backref_bits:
+            writer.write(0, 1)
+            writer.write(best_dist - 1, window_bits)
+            writer.write(best_len - 1, lookahead_bits)
+            for k in range(best_len):
+                insert(i + k)
+            i += best_len
+        else:
+            writer.write(1, 1)
+            writer.write(data[i], 8)
+            insert(i)
+            i += 1
+
+    return writer.finish()
+
+
+def lzss_decompress(stream, size, window_bits, lookahead_bits):
+    """Reference decoder, mirrors src/display/ImageAsset.cpp"""
+    window = bytearray(1 << window_bits)
+    mask = (1 << window_bits) - 1
+    head = 0
+    out = bytearray()
+    bitpos = 0
+
+    def read(bits):
+        nonlocal bitpos
+        value = 0
+        for _ in range(bits):
+            byte = stream[bitpos >> 3]
+            value = (value << 1) | ((byte >> (7 - (bitpos & 7))) & 1)
+            bitpos += 1
+        return value
+
+    while len(out) < size:
+        if read(1):
+            b = read(8)
+            window[head & mask] = b
+            head += 1
+            out.append(b)
+        else:
+            dist = read(window_bits) + 1
+            length = read(lookahead_bits) + 1
+            for _ in range(length):
+                b = window[(head - dist) & mask]
+                window[head & mask] = b
+                head += 1
+                out.append(b)
+
+    return bytes(out[:size])
+
+
+def quantize(img, fmt):
+    """Return (format_name, palette565, row_bytes, raw_rows)"""
+    width, height = img.size
+    rgb = img.convert("RGB")
+    colours = rgb.getcolors(maxcolors=257)
+
+    if fmt == "auto":
+        if colours is not None and len(colours) <= 16:
+            fmt = "pal4"
+        elif colours is not None and len(colours) <= 256:
+            fmt = "pal8"
+        else:
+            fmt = "rgb565"
+
+    if fmt == "rgb565":
+        data = rgb.tobytes()
+        raw = bytearray()
+        for i in range(0, len(data), 3):
+            raw += struct.pack("<H", rgb_to_565(data[i], data[i + 1], data[i + 2]))
+        return fmt, [], width * 2, bytes(raw)
+
+    max_colours = 16 if fmt == "pal4" else 256
+    pal_img = rgb.quantize(colors=max_colours, method=Image.Quantize.MEDIANCUT, dither=Image.Dither.NONE)
+    pal = pal_img.getpalette()[: max_colours * 3]
+    indexes = pal_img.tobytes()
+    used = max(indexes) + 1
+    palette = [rgb_to_565(pal[i * 3], pal[i * 3 + 1], pal[i * 3 + 2]) for i in range(used)]
+
+    if fmt == "pal8":
+        return fmt, palette, width, indexes
+
+    row_bytes = (width + 1) // 2
+    raw = bytearray()
+    for y in range(height):
+        row = indexes[y * width : (y + 1) * width]
+        for x in range(0, width, 2):
+            hi = row[x]
+            lo = row[x + 1] if x + 1 < width else 0
+            raw.append((hi << 4) | lo)
+    return fmt, palette, row_bytes, bytes(raw)
+
+
+def encode(path, fmt, window_bits, lookahead_bits):
+    return encode_image(Image.open(path), fmt, window_bits, lookahead_bits, path)
+
+
+def encode_image(img, fmt, window_bits, lookahead_bits, name="image"):
+    """Encode a Pillow image, returns (gmi bytes, format name, raw size)"""
+    width, height = img.size
+
+    if width > MAX_SIZE or height > MAX_SIZE:
+        raise ValueError(f"{name}: {width}x{height} is larger than the {MAX_SIZE}x{MAX_SIZE} panel")
+
+    fmt, palette, row_bytes, raw = quantize(img, fmt)
+    stream = lzss_compress(raw, window_bits, lookahead_bits)
+
+    if lzss_decompress(stream, len(raw), window_bits, lookahead_bits) != raw:
+        raise RuntimeError(f"{name}: round-trip mismatch")
+
+    out = bytearray(MAGIC)
+    out += struct.pack("<BBHHHBBH", VERSION, FORMATS[fmt], width, height, len(palette), window_bits, lookahead_bits, 0)
+    for colour in palette:
+        out += struct.pack("<H", colour)
+    out += stream
+
+    return bytes(out), fmt, len(raw)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Encode images into compressed GMI assets")
+    parser.add_argument("input", help="source image (png, bmp, gif first frame, ...)")
+    parser.add_argument("-o", "--output", help="output .gmi file")
+    parser.add_argument("--format", choices=["auto", "rgb565", "pal8", "pal4"], default="auto")
+    parser.add_argument("--window", type=int, default=9, help="LZSS window size in bits (8-10)")
+    parser.add_argument("--lookahead", type=int, default=4, help="LZSS match length in bits (3-6)")
+    args = parser.parse_args()
+
+    if not 8 <= args.window <= 10:
+        parser.error("--window must be between 8 and 10")
+    if not 3 <= args.lookahead <= 6:
+        parser.error("--lookahead must be between 3 and 6")
+
+    data, fmt, raw_size = encode(args.input, args.format, args.window, args.lookahead)
+    out_path = args.output or os.path.splitext(args.input)[0] + ".gmi"
+
+    with open(out_path, "wb") as f:
+        f.write(data)
+
+    print(f"{args.input} -> {out_path} ({fmt}, {raw_size} raw bytes, {len(data)} bytes)")
+
+
+if __name__ == "__main__":
+    main()
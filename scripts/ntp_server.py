@@ -0,0 +1,100 @@
+#!/usr/bin/env python3
+"""
+Minimal SNTP server answering with the host clock, to test the clock face without internet access
+
+Point the device to it with "ntp_server": "<host ip>" in config.json. An offset can be added to the time served to
+check the minute, hour and day rollovers without waiting for them
+
+Usage:
+
+    sudo python3 scripts/ntp_server.py                      # port 123 needs root
+    sudo python3 scripts/ntp_server.py --offset -3540       # serve the time of 59 minutes ago
+    python3 scripts/ntp_server.py --port 1123 --at "2026-12-31 23:59:30"
+
+No dependency outside the standard library
+"""
+
+import argparse
+import datetime
+import socket
+import struct
+import time
+
+# Seconds between the NTP era (1900-01-01) and the Unix epoch (1970-01-01)
+NTP_DELTA = 2208988800
+NTP_PACKET = "!BBbbII4sIIIIIIII"
+NTP_PACKET_SIZE = struct.calcsize(NTP_PACKET)
+
+LEAP_NONE = 0
+VERSION = 4
+MODE_CLIENT = 3
+MODE_SERVER = 4
+STRATUM = 2
+
+
+def to_ntp(timestamp):
+    """Split a Unix timestamp into NTP seconds and 2^-32 fractions"""
+    seconds = int(timestamp) + NTP_DELTA
+    fraction = int((timestamp - int(timestamp)) * (1 << 32))
+    return seconds & 0xFFFFFFFF, fraction & 0xFFFFFFFF
+
+
+def build_reply(request, now):
+    fields = struct.unpack(NTP_PACKET, request[:NTP_PACKET_SIZE])
+    version = (fields[0] >> 3) & 0x07
+    transmit_seconds, transmit_fraction = fields[13], fields[14]
+    receive = to_ntp(now)
+    transmit = to_ntp(now)
+
+    return struct.pack(
+        NTP_PACKET,
+        (LEAP_NONE << 6) | ((version or VERSION) << 3) | MODE_SERVER,
+        STRATUM,
+        6,  # poll interval, 2^6 s
+        -20,  # precision, about 1 us
+        0,  # root delay
+        0,  # root dispersion
+        b"LOCL",
+        receive[0],  # reference timestamp
+        receive[1],
+        transmit_seconds,  # originate timestamp, echoed from the request
+        transmit_fraction,
+        receive[0],
+        receive[1],
+        transmit[0],
+        transmit[1],
+    )
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Serve the host time over SNTP")
+    parser.add_argument("--bind", default="0.0.0.0", help="address to listen on")
+    parser.add_argument("--port", type=int, default=123, help="UDP port")
+    parser.add_argument("--offset", type=float, default=0.0, help="seconds added to the host time")
+    parser.add_argument("--at", help='serve this UTC time at startup instead of now ("YYYY-MM-DD HH:MM:SS")')
+    args = parser.parse_args()
+
+    offset = args.offset
+    if args.at:
+        start = datetime.datetime.strptime(args.at, "%Y-%m-%d %H:%M:%S").replace(tzinfo=datetime.timezone.utc)
+        offset += start.timestamp() - time.time()
+
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+    sock.bind((args.bind, args.port))
+    print(f"SNTP server on {args.bind}:{args.port}, offset {offset:+.0f} s")
+
+    while True:
+        request, addr = sock.recvfrom(512)
+        now = time.time() + offset
+
+        if len(request) < NTP_PACKET_SIZE or (request[0] & 0x07) != MODE_CLIENT:
+            continue
+
+        sock.sendto(build_reply(request, now), addr)
+        served = datetime.datetime.fromtimestamp(now, datetime.timezone.utc).strftime("%Y-%m-%d %H:%M:%S")
+        print(f"{addr[0]}:{addr[1]} <- {served} UTC")
+
+
+if __name__ == "__main__":
+    main()
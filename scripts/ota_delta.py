@@ -0,0 +1,226 @@
+#!/usr/bin/env python3
+"""
+Prepare a firmware for a faster OTA update: a gzip image and a delta against the firmware running on the device
+
+The gzip image (firmware.bin.gz) is installed as is, eboot inflates it on reboot. The delta (firmware.delta) only
+carries what changed since the base firmware, the device rebuilds the new image from its running sketch while it
+arrives. The device refuses a delta made against another base (its MD5 is in the header), so --base must be the
+firmware.bin flashed last
+
+Delta layout, little endian (see include/web/OtaStream.h):
+
+    magic "GDLT" | version u8 | 3 reserved | source size u32 | target size u32 | source MD5 (16 bytes)
+    0x00 COPY | zigzag varint source offset change | varint length
+    0x01 DATA | varint length | bytes
+
+The delta is checked by rebuilding the new firmware from it before it is written. Upload the smallest file to
+/api/v1/ota/fw with the printed SHA-256, it is checked against the image the device writes:
+
+    python3 scripts/ota_delta.py .pio/build/esp12e/firmware.bin --base previous/firmware.bin
+    curl -F "firmware=@firmware.delta" "http://192.168.1.42/api/v1/ota/fw?sha256=<printed digest>"
+"""
+
+import argparse
+import gzip
+import hashlib
+import os
+import struct
+import sys
+
+MAGIC = b"GDLT"
+VERSION = 1
+OP_COPY = 0x00
+OP_DATA = 0x01
+BLOCK = 8  # bytes hashed to find a match anywhere in the base
+MIN_MATCH = 12  # shorter matches found through the index cost more than the bytes they save
+MIN_CONTINUATION = 4  # a match where the base continues is cheap, see encode()
+COMPARE_STEP = 64
+
+
+def varint(value):
+    out = bytearray()
+    while True:
+        byte = value & 0x7F
+        value >>= 7
+        if value:
+            out.append(byte | 0x80)
+        else:
+            out.append(byte)
+            return bytes(out)
+
+
+def zigzag(value):
+    return (value << 1) if value >= 0 else ((-value << 1) - 1)
+
+
+def match_length(old, old_pos, new, new_pos):
+    """Number of equal bytes from old[old_pos] and new[new_pos]"""
+    limit = min(len(old) - old_pos, len(new) - new_pos)
+    length = 0
+
+    while length + COMPARE_STEP <= limit:
+        end = length + COMPARE_STEP
+        if old[old_pos + length : old_pos + end] != new[new_pos + length : new_pos + end]:
+            break
+        length = end
+
+    while length < limit and old[old_pos + length] == new[new_pos + length]:
+        length += 1
+
+    return length
+
+
+def encode(old, new):
+    """Delta operations rebuilding new from old, greedy: the longest match wins, else the byte is sent as data
+
+    Code moved by a small amount mostly differs in relative addresses, so after a few new bytes the base often
+    continues where it left off, shifted by the same amount: that position is always tried first, a copy from it
+    costs three bytes
+    """
+    index = {}
+    for pos in range(len(old) - BLOCK, -1, -1):
+        index[old[pos : pos + BLOCK]] = pos
+
+    ops = bytearray()
+    literal = bytearray()
+    source = 0  # end of the previous copy in old
+    pos = 0
+
+    def flush_literal():
+        if literal:
+            ops.append(OP_DATA)
+            ops.extend(varint(len(literal)))
+            ops.extend(literal)
+            literal.clear()
+
+    while pos < len(new):
+        best_at, best_len = 0, 0
+
+        continuation = source + len(literal)
+        if continuation < len(old):
+            length = match_length(old, continuation, new, pos)
+            if length >= MIN_CONTINUATION:
+                best_at, best_len = continuation, length
+
+        candidate = index.get(bytes(new[pos : pos + BLOCK]))
+        if candidate is not None and candidate != continuation:
+            length = match_length(old, candidate, new, pos)
+            if length >= MIN_MATCH and length > best_len + 4:
+                best_at, best_len = candidate, length
+
+        if best_len == 0:
+            literal.append(new[pos])
+            pos += 1
+            continue
+
+        flush_literal()
+        ops.append(OP_COPY)
+        ops.extend(varint(zigzag(best_at - source)))
+        ops.extend(varint(best_len))
+        source = best_at + best_len
+        pos += best_len
+
+    flush_literal()
+
+    header = MAGIC + bytes([VERSION, 0, 0, 0]) + struct.pack("<II", len(old), len(new)) + hashlib.md5(old).digest()
+
+    return header + bytes(ops)
+
+
+def read_varint(data, pos):
+    value, shift = 0, 0
+    while True:
+        byte = data[pos]
+        pos += 1
+        value |= (byte & 0x7F) << shift
+        shift += 7
+        if not byte & 0x80:
+            return value, pos
+
+
+def apply(old, delta):
+    """Reference decoder, what the device does with the running sketch as old"""
+    if delta[:4] != MAGIC or delta[4] != VERSION:
+        raise ValueError("not a delta")
+
+    source_size, target_size = struct.unpack("<II", delta[8:16])
+    if source_size != len(old) or delta[16:32] != hashlib.md5(old).digest():
+        raise ValueError("delta made against another base")
+
+    out = bytearray()
+    source = 0
+    pos = 32
+
+    while pos < len(delta):
+        op = delta[pos]
+        pos += 1
+        if op == OP_COPY:
+            change, pos = read_varint(delta, pos)
+            length, pos = read_varint(delta, pos)
+            source += (change >> 1) ^ -(change & 1)
+            out += old[source : source + length]
+            source += length
+        elif op == OP_DATA:
+            length, pos = read_varint(delta, pos)
+            out += delta[pos : pos + length]
+            pos += length
+        else:
+            raise ValueError(f"unknown operation {op}")
+
+    if len(out) != target_size:
+        raise ValueError("delta does not rebuild the whole firmware")
+
+    return bytes(out)
+
+
+def write(path, data):
+    with open(path, "wb") as f:
+        f.write(data)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Build gzip and delta OTA images")
+    parser.add_argument("firmware", help="new firmware.bin")
+    parser.add_argument("--base", help="firmware.bin running on the device, builds a delta against it")
+    parser.add_argument("--output", help="output directory, next to the firmware by default")
+    args = parser.parse_args()
+
+    with open(args.firmware, "rb") as f:
+        new = f.read()
+
+    out_dir = args.output or os.path.dirname(os.path.abspath(args.firmware))
+    os.makedirs(out_dir, exist_ok=True)
+    name = os.path.splitext(os.path.basename(args.firmware))[0]
+
+    packed = gzip.compress(new, compresslevel=9, mtime=0)
+    gz_path = os.path.join(out_dir, name + ".bin.gz")
+    write(gz_path, packed)
+
+    # file, size, digest of what the device writes
+    images = [
+        (args.firmware, len(new), hashlib.sha256(new).hexdigest()),
+        (gz_path, len(packed), hashlib.sha256(packed).hexdigest()),
+    ]
+
+    if args.base:
+        with open(args.base, "rb") as f:
+            old = f.read()
+
+        delta = encode(old, new)
+        if apply(old, delta) != new:
+            sys.exit("[ota_delta] the delta does not rebuild the firmware, not written")
+
+        delta_path = os.path.join(out_dir, name + ".delta")
+        write(delta_path, delta)
+        images.append((delta_path, len(delta), hashlib.sha256(new).hexdigest()))
+
+    for path, size, digest in images:
+        ratio = size / len(new) * 100
+        print(f"{path}: {size} bytes ({ratio:.1f} %), sha256={digest}")
+
+    smallest = min(images, key=lambda image: image[1])
+    print(f"Smallest: {smallest[0]}, {len(new) / smallest[1]:.1f}x less to transfer")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,336 @@
+#!/usr/bin/env python3
+"""
+Encode an animated GIF into a Q565 animation for the GeekMagic firmware
+
+Q565 is a QOI-like, byte oriented codec working directly on RGB565 pixels
+Each frame only stores the dirty rectangle that changed since the previous
+frame, and unchanged pixels inside that rectangle are skipped
+
+File layout (little endian):
+
+    header  : "Q565" | version u8 | flags u8 | width u16 | height u16 | frames u16 | reserved u32
+    frame   : payload u32 | delay_ms u16 | x u16 | y u16 | w u16 | h u16 | ops[payload]
+
+Ops (state is reset at the beginning of every frame):
+
+    00iiiiii            INDEX   pixel = index[i]
+    01rrggbb            DIFF    r/g/b delta in -2..1 (bias 2)
+    10gggggg rrrrbbbb   LUMA    g delta in -32..31, r/b delta relative to g/2 in -8..7
+    11rrrrrr            RUN     repeat previous pixel 1..60 times (0xC0..0xFB)
+    0xFC n              SKIP8   leave n+1 pixels untouched (1..256)
+    0xFD n16            SKIP16  leave n+1 pixels untouched (1..65536)
+    0xFE p16            RGB565  literal pixel
+
+Usage:
+
+    python3 scripts/q565_encode.py data/gif/geek.gif -o data/gif/geek.q565
+    python3 scripts/q565_encode.py --compare data/gif/*.gif
+
+Requires Pillow (pip install pillow)
+"""
+
+import argparse
+import os
+import struct
+import sys
+import time
+
+try:
+    from PIL import Image
+except ImportError:
+    print("Pillow is required: pip install pillow", file=sys.stderr)
+    sys.exit(1)
+
+MAGIC = b"Q565"
+VERSION = 1
+FLAG_LOOP = 0x01
+MAX_SIZE = 240
+
+OP_INDEX = 0x00
+OP_DIFF = 0x40
+OP_LUMA = 0x80
+OP_RUN = 0xC0
+OP_SKIP8 = 0xFC
+OP_SKIP16 = 0xFD
+OP_RGB565 = 0xFE
+
+RUN_MAX = 60
+# a skip reopens the address window (~11 command bytes), shorter unchanged spans are cheaper to resend
+SKIP_MIN = 8
+
+
+def rgb_to_565(r, g, b):
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+
+
+def split565(p):
+    return (p >> 11) & 0x1F, (p >> 5) & 0x3F, p & 0x1F
+
+
+def hash565(p):
+    r, g, b = split565(p)
+    return (r * 3 + g * 5 + b * 7) & 63
+
+
+def wrap(v, bits):
+    """Wrap a channel delta into the signed range of a channel of the given width"""
+    half = 1 << (bits - 1)
+    return ((v + half) & ((1 << bits) - 1)) - half
+
+
+def encode_rect(pixels, prev, width, rect):
+    """Encode the dirty rectangle of one frame into Q565 ops"""
+    x0, y0, w, h = rect
+    out = bytearray()
+    index = [0] * 64
+    px_prev = 0
+    run = 0
+    skip = 0
+
+    def flush_run():
+        nonlocal run
+        while run > 0:
+            n = min(run, RUN_MAX)
+            out.append(OP_RUN | (n - 1))
+            run -= n
+
+    def flush_skip():
+        nonlocal skip
+        while skip > 0:
+            n = min(skip, 65536)
+            if n <= 256:
+                out.append(OP_SKIP8)
+                out.append(n - 1)
+            else:
+                out.append(OP_SKIP16)
+                out.extend(struct.pack("<H", n - 1))
+            skip -= n
+
+    stream = [y * width + x for y in range(y0, y0 + h) for x in range(x0, x0 + w)]
+    total = len(stream)
+    i = 0
+
+    while i < total:
+        pos = stream[i]
+
+        if prev is not None and pixels[pos] == prev[pos]:
+            j = i
+            while j < total and pixels[stream[j]] == prev[stream[j]]:
+                j += 1
+            if j - i >= SKIP_MIN:
+                flush_run()
+                skip += j - i
+                i = j
+                continue
+
+        flush_skip()
+        px = pixels[pos]
+
+        if px == px_prev:
+            run += 1
+            i += 1
+            continue
+
+        flush_run()
+        h6 = hash565(px)
+
+        if index[h6] == px:
+            out.append(OP_INDEX | h6)
+        else:
+            index[h6] = px
+            r, g, b = split565(px)
+            pr, pg, pb = split565(px_prev)
+            dr = wrap(r - pr, 5)
+            dg = wrap(g - pg, 6)
+            db = wrap(b - pb, 5)
+            dgh = dg >> 1
+            dr_dg = dr - dgh
+            db_dg = db - dgh
+
+            if -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+                out.append(OP_DIFF | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2))
+            elif -32 <= dg <= 31 and -8 <= dr_dg <= 7 and -8 <= db_dg <= 7:
+                out.append(OP_LUMA | (dg + 32))
+                out.append(((dr_dg + 8) << 4) | (db_dg + 8))
+            else:
+                out.append(OP_RGB565)
+                out += struct.pack("<H", px)
+
+        px_prev = px
+        i += 1
+
+    flush_run()
+    flush_skip()
+
+    return bytes(out)
+
+
+def decode_rect(ops, canvas, width, rect):
+    """Reference decoder, mirrors src/display/Q565.cpp, used to verify the encoder output"""
+    x0, y0, w, h = rect
+    index = [0] * 64
+    px = 0
+    total = w * h
+    n = 0
+    i = 0
+
+    def put(count, value):
+        nonlocal n
+        for _ in range(count):
+            canvas[(y0 + n // w) * width + x0 + n % w] = value
+            n += 1
+
+    while n < total:
+        op = ops[i]
+        i += 1
+        if op == OP_SKIP8:
+            n += ops[i] + 1
+            i += 1
+            continue
+        if op == OP_SKIP16:
+            n += struct.unpack_from("<H", ops, i)[0] + 1
+            i += 2
+            continue
+        if op == OP_RGB565:
+            px = struct.unpack_from("<H", ops, i)[0]
+            i += 2
+        elif op >= OP_RUN:
+            put((op & 0x3F) + 1, px)
+            continue
+        elif op >= OP_LUMA:
+            nxt = ops[i]
+            i += 1
+            dg = (op & 0x3F) - 32
+            dgh = dg >> 1
+            r, g, b = split565(px)
+            r = (r + dgh + (nxt >> 4) - 8) & 0x1F
+            g = (g + dg) & 0x3F
+            b = (b + dgh + (nxt & 0x0F) - 8) & 0x1F
+            px = (r << 11) | (g << 5) | b
+        elif op >= OP_DIFF:
+            r, g, b = split565(px)
+            r = (r + ((op >> 4) & 3) - 2) & 0x1F
+            g = (g + ((op >> 2) & 3) - 2) & 0x3F
+            b = (b + (op & 3) - 2) & 0x1F
+            px = (r << 11) | (g << 5) | b
+        else:
+            px = index[op]
+            put(1, px)
+            continue
+
+        index[hash565(px)] = px
+        put(1, px)
+
+    return i
+
+
+def load_frames(path):
+    """Return (width, height, loop, [(pixels565, delay_ms)]) with fully composited frames"""
+    im = Image.open(path)
+    width, height = im.size
+    loop = "loop" in im.info
+    frames = []
+
+    for n in range(getattr(im, "n_frames", 1)):
+        im.seek(n)
+        rgb = im.convert("RGB")
+        data = rgb.tobytes()
+        pixels = [rgb_to_565(data[i], data[i + 1], data[i + 2]) for i in range(0, len(data), 3)]
+        frames.append((pixels, int(im.info.get("duration", 100))))
+
+    return width, height, loop, frames
+
+
+def dirty_rect(pixels, prev, width, height):
+    if prev is None:
+        return 0, 0, width, height
+
+    xs = []
+    ys = []
+    for y in range(height):
+        row = y * width
+        for x in range(width):
+            if pixels[row + x] != prev[row + x]:
+                xs.append(x)
+                ys.append(y)
+
+    if not xs:
+        return 0, 0, 0, 0
+
+    return min(xs), min(ys), max(xs) - min(xs) + 1, max(ys) - min(ys) + 1
+
+
+def encode(path, verify=True):
+    width, height, loop, frames = load_frames(path)
+
+    if width > MAX_SIZE or height > MAX_SIZE:
+        raise ValueError(f"{path}: {width}x{height} is larger than the {MAX_SIZE}x{MAX_SIZE} panel")
+
+    out = bytearray(MAGIC)
+    out += struct.pack("<BBHHHI", VERSION, FLAG_LOOP if loop else 0, width, height, len(frames), 0)
+
+    prev = None
+    canvas = [0] * (width * height)
+
+    for pixels, delay in frames:
+        rect = dirty_rect(pixels, prev, width, height)
+        ops = encode_rect(pixels, prev, width, rect) if rect[2] and rect[3] else b""
+        out += struct.pack("<IHHHHH", len(ops), min(delay, 0xFFFF), *rect)
+        out += ops
+
+        if verify and ops:
+            used = decode_rect(ops, canvas, width, rect)
+            if used != len(ops) or canvas != pixels:
+                raise RuntimeError(f"{path}: round-trip mismatch")
+
+        prev = pixels
+
+    return bytes(out), len(frames)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Encode GIF animations into Q565")
+    parser.add_argument("inputs", nargs="+", help="GIF files to encode")
+    parser.add_argument("-o", "--output", help="output file (single input only)")
+    parser.add_argument("--compare", action="store_true", help="print size and host decode time against GIF")
+    parser.add_argument("--no-verify", action="store_true", help="skip the round-trip decode check")
+    args = parser.parse_args()
+
+    if args.output and len(args.inputs) != 1:
+        parser.error("--output can only be used with a single input")
+
+    for path in args.inputs:
+        data, frame_count = encode(path, verify=not args.no_verify)
+        gif_size = os.path.getsize(path)
+
+        if args.compare:
+            start = time.perf_counter()
+            load_frames(path)
+            gif_ms = (time.perf_counter() - start) * 1000.0
+
+            start = time.perf_counter()
+            width, height = struct.unpack_from("<HH", data, 6)
+            canvas = [0] * (width * height)
+            pos = 16
+            for _ in range(frame_count):
+                size, _, x, y, w, h = struct.unpack_from("<IHHHHH", data, pos)
+                pos += 14
+                if size:
+                    decode_rect(data[pos : pos + size], canvas, width, (x, y, w, h))
+                pos += size
+            q565_ms = (time.perf_counter() - start) * 1000.0
+
+            print(
+                f"{path}: gif {gif_size} B, q565 {len(data)} B ({len(data) * 100.0 / gif_size:.1f}%), "
+                f"{frame_count} frames, host decode gif {gif_ms:.0f} ms / q565 {q565_ms:.0f} ms"
+            )
+
+        if args.output or not args.compare:
+            out_path = args.output or os.path.splitext(path)[0] + ".q565"
+            with open(out_path, "wb") as f:
+                f.write(data)
+            print(f"{path} -> {out_path} ({len(data)} bytes, {frame_count} frames)")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,117 @@
+#!/usr/bin/env python3
+"""
+Generate include/display/BootSplash.h, the boot splash pushed right after the panel init
+
+The splash is a rectangle of raw RGB565 pixels on a solid background colour, stored big endian and upright. The
+firmware sets the panel rotation (MADCTL) before streaming it from flash as is, in one RAMWR, centred on the screen,
+so the same image is right for every rotation: the compiled default at boot, then the one of config.json if it
+differs
+
+Usage:
+
+    python3 scripts/splash_gen.py                   # default artwork
+    python3 scripts/splash_gen.py logo.png --bg 102040
+
+Requires Pillow (pip install pillow)
+"""
+
+import argparse
+import os
+import sys
+
+try:
+    from PIL import Image, ImageDraw
+except ImportError:
+    print("Pillow is required: pip install pillow", file=sys.stderr)
+    sys.exit(1)
+
+PANEL_SIZE = 240
+DEFAULT_SIZE = 128
+DEFAULT_OUTPUT = os.path.normpath(os.path.join(os.path.dirname(__file__), "..", "include", "display", "BootSplash.h"))
+
+def rgb_to_565(r, g, b):
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+
+
+def default_artwork(size, bg):
+    """Isometric cube"""
+    img = Image.new("RGB", (size, size), bg)
+    draw = ImageDraw.Draw(img)
+
+    cx = size // 2
+    edge = size * 44 // 100
+    half = edge * 866 // 1000
+    top = size // 2 - edge
+    mid = top + edge // 2
+    low = mid + edge
+    bottom = top + edge * 2
+
+    top_face = [(cx, top), (cx + half, mid), (cx, mid + edge // 2), (cx - half, mid)]
+    left_face = [(cx - half, mid), (cx, mid + edge // 2), (cx, bottom), (cx - half, low)]
+    right_face = [(cx + half, mid), (cx, mid + edge // 2), (cx, bottom), (cx + half, low)]
+
+    draw.polygon(top_face, fill=(90, 200, 255))
+    draw.polygon(left_face, fill=(30, 110, 200))
+    draw.polygon(right_face, fill=(30, 110, 200))
+
+    outline = (235, 245, 255)
+    draw.line(top_face + [top_face[0]], fill=outline, width=2)
+    draw.line([left_face[0], left_face[3], left_face[2], left_face[1]], fill=outline, width=2)
+    draw.line([right_face[0], right_face[3], right_face[2]], fill=outline, width=2)
+
+    return img
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate the flash resident boot splash header")
+    parser.add_argument("image", nargs="?", help="splash image (default: built-in cube artwork)")
+    parser.add_argument("-o", "--output", default=DEFAULT_OUTPUT, help="generated header path")
+    parser.add_argument("--bg", default="000000", help="background colour as RRGGBB hex")
+    args = parser.parse_args()
+
+    bg = tuple(int(args.bg[i : i + 2], 16) for i in (0, 2, 4))
+
+    if args.image:
+        img = Image.open(args.image).convert("RGB")
+    else:
+        img = default_artwork(DEFAULT_SIZE, bg)
+
+    if img.width > PANEL_SIZE or img.height > PANEL_SIZE:
+        parser.error(f"splash is {img.width}x{img.height}, the panel is {PANEL_SIZE}x{PANEL_SIZE}")
+
+    pixels = img.tobytes()
+
+    data = bytearray()
+    for i in range(0, len(pixels), 3):
+        value = rgb_to_565(pixels[i], pixels[i + 1], pixels[i + 2])
+        data += bytes((value >> 8, value & 0xFF))
+
+    lines = [
+        "// Generated by scripts/splash_gen.py, do not edit",
+        f"// Source: {os.path.basename(args.image) if args.image else 'built-in artwork'}",
+        "#ifndef SRC_DISPLAY_BOOTSPLASH_H",
+        "#define SRC_DISPLAY_BOOTSPLASH_H",
+        "",
+        "#include <Arduino.h>",
+        "",
+        f"static constexpr uint16_t BOOT_SPLASH_BG = 0x{rgb_to_565(*bg):04X};",
+        f"static constexpr uint16_t BOOT_SPLASH_W = {img.width};",
+        f"static constexpr uint16_t BOOT_SPLASH_H = {img.height};",
+        "",
+        "// RGB565 big endian, upright: the panel rotation is applied by MADCTL when it is drawn",
+        f"static const uint8_t BOOT_SPLASH_DATA[{len(data)}] PROGMEM __attribute__((aligned(4))) = {{",
+    ]
+
+    for i in range(0, len(data), 16):
+        lines.append("    " + ", ".join(f"0x{b:02X}" for b in data[i : i + 16]) + ",")
+
+    lines += ["};", "", "#endif  // SRC_DISPLAY_BOOTSPLASH_H", ""]
+
+    with open(args.output, "w") as f:
+        f.write("\n".join(lines))
+
+    print(f"{args.output}: {img.width}x{img.height}, {len(data)} bytes of flash")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,78 @@
+#!/usr/bin/env python3
+"""
+Tests of the fs_sync.py plan, the comparison of the local directory with the device manifest
+
+Usage:
+
+    python3 -m unittest discover -s scripts -p "test_*.py"
+"""
+
+import hashlib
+import os
+import sys
+import tempfile
+import unittest
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+
+from fs_sync import KEEP, file_digest, plan  # noqa: E402
+
+INDEX = (120, "0" * 32)
+STYLE = (300, "1" * 32)
+
+
+class PlanTest(unittest.TestCase):
+    def test_identical_trees_send_nothing(self):
+        files = {"/index.html": INDEX, "/css/style.css": STYLE}
+
+        self.assertEqual(plan(files, dict(files)), ([], [], 2))
+
+    def test_missing_and_changed_files_are_sent_in_order(self):
+        local = {"/index.html": INDEX, "/css/style.css": STYLE, "/js/app.js": (50, "2" * 32)}
+        remote = {"/index.html": (120, "f" * 32), "/css/style.css": STYLE}
+
+        self.assertEqual(plan(local, remote), (["/index.html", "/js/app.js"], [], 1))
+
+    def test_same_digest_other_size_is_sent(self):
+        self.assertEqual(plan({"/a": (10, "0" * 32)}, {"/a": (11, "0" * 32)}), (["/a"], [], 0))
+
+    def test_unreadable_device_file_is_sent(self):
+        # the device lists a file it cannot read with an empty md5
+        self.assertEqual(plan({"/a": INDEX}, {"/a": (120, "")}), (["/a"], [], 0))
+
+    def test_extra_device_files_are_kept_without_delete(self):
+        self.assertEqual(plan({}, {"/old.html": INDEX}), ([], [], 0))
+
+    def test_delete_spares_the_keep_prefixes(self):
+        remote = {
+            "/old.html": INDEX,
+            "/gif/geek.gif": STYLE,
+            "/img/logo.gmi": STYLE,
+            "/scenes/status.bin": STYLE,
+            "/config.json": STYLE,
+            "/gifts.txt": STYLE,
+        }
+
+        self.assertEqual(plan({}, remote, delete=True), ([], ["/gifts.txt", "/old.html"], 0))
+        self.assertEqual(plan({}, remote, delete=True, keep=KEEP), ([], ["/gifts.txt", "/old.html"], 0))
+
+    def test_keep_replaces_the_defaults(self):
+        remote = {"/old.html": INDEX, "/gif/geek.gif": STYLE}
+
+        self.assertEqual(plan({}, remote, delete=True, keep=("/old",)), ([], ["/gif/geek.gif"], 0))
+        self.assertEqual(plan({}, remote, delete=True, keep=[]), ([], ["/gif/geek.gif", "/old.html"], 0))
+
+
+class FileDigestTest(unittest.TestCase):
+    def test_size_and_md5(self):
+        with tempfile.TemporaryDirectory() as directory:
+            path = os.path.join(directory, "data.bin")
+            data = bytes(range(256)) * 1000  # larger than one read block
+            with open(path, "wb") as f:
+                f.write(data)
+
+            self.assertEqual(file_digest(path), (len(data), hashlib.md5(data).hexdigest()))
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+"""
+Upload a GIF, a firmware or a file system image through the resumable upload API
+
+The file is sent in ranges (PUT /api/v1/upload?id= with Content-Range), each one committed by the device before it
+answers. When a request fails the script asks the device for the committed offset (GET /api/v1/upload) and carries
+on from there, also across runs: starting the same upload again resumes it. The upload is finalised with its MD5,
+the device installs it only if the checksum matches
+
+Usage:
+
+    python3 scripts/upload_resume.py 192.168.1.42 anim.gif
+    python3 scripts/upload_resume.py 192.168.1.42 .pio/build/esp12e/firmware.bin --target firmware
+    python3 scripts/upload_resume.py 192.168.1.42 .pio/build/esp12e/littlefs.bin --target filesystem --chunk 4096
+"""
+
+import argparse
+import hashlib
+import http.client
+import json
+import os
+import sys
+import time
+
+MAX_CHUNK = 16384  # HttpServer::MAX_BODY
+RETRY_DELAY_S = 2
+
+
+def call(host, port, method, path, body=None, headers=None):
+    """One request on a fresh connection, returns the status and the decoded JSON answer"""
+    conn = http.client.HTTPConnection(host, port, timeout=15)
+    try:
+        conn.request(method, path, body=body, headers=headers or {})
+        response = conn.getresponse()
+        data = response.read()
+    finally:
+        conn.close()
+
+    return response.status, json.loads(data) if data else {}
+
+
+def create(host, port, session):
+    status, answer = call(
+        host, port, "POST", "/api/v1/upload", json.dumps(session), {"Content-Type": "application/json"}
+    )
+    if status != 200:
+        raise SystemExit(f"create: HTTP {status} {answer.get('message', '')}")
+
+    return answer["id"], answer["offset"]
+
+
+def committed(host, port):
+    status, answer = call(host, port, "GET", "/api/v1/upload")
+
+    return answer["offset"] if status == 200 else None
+
+
+def send(host, port, session, data, chunk=8192, retries=20, quiet=False):
+    """Uploads data to the session described by the create request, returns the answer of the finish request
+
+    session holds the target and what goes with it (name, path), the size is added here
+    """
+    size = len(data)
+    session = dict(session, size=size)
+    chunk = max(1, min(chunk, MAX_CHUNK))
+    upload_id, offset = create(host, port, session)
+    if offset and not quiet:
+        print(f"resuming at {offset} of {size} bytes")
+
+    start = time.monotonic()
+
+    while offset < size:
+        end = min(offset + chunk, size)
+        headers = {"Content-Type": "application/octet-stream", "Content-Range": f"bytes {offset}-{end - 1}/{size}"}
+
+        try:
+            path = f"/api/v1/upload?id={upload_id}"
+            status, answer = call(host, port, "PUT", path, data[offset:end], headers)
+        except OSError as error:
+            status, answer = None, {"message": str(error)}
+
+        if status == 200:
+            offset = answer["offset"]
+            if not quiet:
+                print(f"\r{offset}/{size} bytes", end="", flush=True)
+            continue
+
+        # a lost session (404) is created again below
+        if status in (400, 413):
+            raise SystemExit(f"\nrange {offset}: HTTP {status} {answer.get('message', '')}")
+
+        retries -= 1
+        if retries < 0:
+            raise SystemExit(f"\ngiving up at {offset} of {size} bytes: {answer.get('message', '')}")
+
+        print(f"\nrange {offset}: {answer.get('message', status)}, retrying", file=sys.stderr)
+        time.sleep(RETRY_DELAY_S)
+        try:
+            offset = answer.get("offset") if status == 416 else committed(host, port)
+        except OSError:
+            pass
+        if offset is None:
+            upload_id, offset = create(host, port, session)
+
+    if not quiet:
+        elapsed = time.monotonic() - start
+        print(f"\n{size} bytes in {elapsed:.1f} s ({size / 1024 / max(elapsed, 1e-3):.1f} KiB/s)")
+
+    md5 = hashlib.md5(data).hexdigest()
+    status, answer = call(
+        host,
+        port,
+        "POST",
+        f"/api/v1/upload/finish?id={upload_id}",
+        json.dumps({"md5": md5}),
+        {"Content-Type": "application/json"},
+    )
+    if status != 200:
+        raise SystemExit(f"finish: HTTP {status} {answer.get('message', '')}")
+
+    return answer
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Resumable upload to the device")
+    parser.add_argument("host", help="device address")
+    parser.add_argument("file", help="file to upload")
+    parser.add_argument("--port", type=int, default=80)
+    parser.add_argument("--target", choices=("gif", "firmware", "filesystem"), default="gif")
+    parser.add_argument("--chunk", type=int, default=8192, help=f"range size in bytes, at most {MAX_CHUNK}")
+    parser.add_argument("--retries", type=int, default=20, help="failed requests tolerated")
+    args = parser.parse_args()
+
+    with open(args.file, "rb") as f:
+        data = f.read()
+
+    session = {"target": args.target}
+    if args.target == "gif":
+        session["name"] = os.path.basename(args.file)
+
+    answer = send(args.host, args.port, session, data, args.chunk, args.retries)
+    print(answer.get("filename") or answer.get("message", "done"))
+
+
+if __name__ == "__main__":
+    main()
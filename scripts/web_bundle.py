@@ -0,0 +1,204 @@
+#!/usr/bin/env python3
+"""
+Generate include/web/WebAssets.h, the web UI compiled into the firmware
+
+Every file of web/ is gzip compressed and stored in flash as a PROGMEM array, next to a route table giving its URI,
+content type, length and a strong ETag (a hash of the compressed bytes). The firmware answers the web UI from that
+table without touching LittleFS, sends the compressed bytes as is with Content-Encoding: gzip and answers a matching
+If-None-Match with 304 Not Modified. index.html is also served on /
+
+HTML pages are assembled here rather than in the browser: <!--#include file="header.html" --> is replaced by the
+file it names (relative to the page, includes may nest), so a page arrives complete in one response instead of
+fetching its fragments once loaded. A file included by a page is not served on its own
+
+Runs before every PlatformIO build (extra_scripts = pre:scripts/web_bundle.py), the header is only rewritten when
+the web UI changed. It can also be run by hand:
+
+    python3 scripts/web_bundle.py
+    python3 scripts/web_bundle.py --web web --output include/web/WebAssets.h
+"""
+
+import argparse
+import gzip
+import hashlib
+import os
+import re
+
+CONTENT_TYPES = {
+    ".html": "text/html",
+    ".htm": "text/html",
+    ".css": "text/css",
+    ".js": "application/javascript",
+    ".json": "application/json",
+    ".png": "image/png",
+    ".jpg": "image/jpeg",
+    ".jpeg": "image/jpeg",
+    ".gif": "image/gif",
+    ".svg": "image/svg+xml",
+    ".ico": "image/x-icon",
+    ".txt": "text/plain",
+}
+
+INCLUDE = re.compile(r'<!--#include file="([^"]+)" -->')
+MAX_INCLUDE_DEPTH = 8
+INDEX = "/index.html"
+ETAG_LENGTH = 16
+BYTES_PER_LINE = 16
+
+
+def collect(web_dir):
+    """Relative URI and absolute path of every file of the web UI, sorted so the output is stable"""
+    files = []
+
+    for root, dirs, names in os.walk(web_dir):
+        dirs.sort()
+        for name in sorted(names):
+            path = os.path.join(root, name)
+            uri = "/" + os.path.relpath(path, web_dir).replace(os.sep, "/")
+            files.append((uri, path))
+
+    return files
+
+
+def assemble(path, included, depth=0):
+    """Contents of an HTML page with its includes expanded, the included paths are added to included"""
+    if depth > MAX_INCLUDE_DEPTH:
+        raise SystemExit(f"[web_bundle] Include depth exceeded in {path}")
+
+    with open(path, "r", encoding="utf-8") as f:
+        text = f.read()
+
+    def expand(match):
+        fragment = os.path.normpath(os.path.join(os.path.dirname(path), match.group(1)))
+        if not os.path.isfile(fragment):
+            raise SystemExit(f"[web_bundle] {path} includes missing file {match.group(1)}")
+
+        included.add(fragment)
+
+        return assemble(fragment, included, depth + 1)
+
+    return INCLUDE.sub(expand, text)
+
+
+def compress(data):
+    """gzip with a zero mtime and no name, so the same input always gives the same bytes and ETag"""
+    return gzip.compress(data, compresslevel=9, mtime=0)
+
+
+def c_array(name, data):
+    lines = [f"static const uint8_t {name}[] PROGMEM __attribute__((aligned(4))) = {{"]
+
+    for i in range(0, len(data), BYTES_PER_LINE):
+        chunk = data[i : i + BYTES_PER_LINE]
+        lines.append("    " + ", ".join(f"0x{b:02X}" for b in chunk) + ",")
+
+    lines.append("};")
+
+    return "\n".join(lines)
+
+
+def generate(web_dir):
+    arrays = []
+    routes = []
+    raw_total = 0
+    gz_total = 0
+
+    included = set()
+    contents = []
+
+    for uri, path in collect(web_dir):
+        if uri.endswith((".html", ".htm")):
+            contents.append((uri, path, assemble(path, included).encode("utf-8")))
+        else:
+            with open(path, "rb") as f:
+                contents.append((uri, path, f.read()))
+
+    assets = [(uri, raw) for uri, path, raw in contents if os.path.normpath(path) not in included]
+
+    for index, (uri, raw) in enumerate(assets):
+        ext = os.path.splitext(uri)[1].lower()
+        content_type = CONTENT_TYPES.get(ext, "application/octet-stream")
+        raw_size = len(raw)
+        data = compress(raw)
+        etag = hashlib.sha256(data).hexdigest()[:ETAG_LENGTH]
+        name = f"WEB_ASSET_{index}"
+
+        raw_total += raw_size
+        gz_total += len(data)
+        arrays.append(f"// {uri}, {raw_size} bytes, {len(data)} bytes compressed\n" + c_array(name, data))
+
+        uris = ["/", uri] if uri == INDEX else [uri]
+        for route in uris:
+            routes.append(f'    {{"{route}", "{content_type}", "\\"{etag}\\"", {name}, {len(data)}}},')
+
+    body = "\n\n".join(arrays)
+    table = "\n".join(routes)
+
+    content = f"""// Generated by scripts/web_bundle.py from web/, do not edit
+// {len(arrays)} files, {raw_total} bytes, {gz_total} bytes compressed
+#ifndef WEB_WEBASSETS_H
+#define WEB_WEBASSETS_H
+
+#include <Arduino.h>
+
+/**
+ * @brief One route of the web UI, data is the gzip compressed file in flash
+ */
+struct WebAsset {{
+    const char* uri;
+    const char* contentType;
+    const char* etag;
+    const uint8_t* data;
+    size_t size;
+}};
+
+{body}
+
+static const WebAsset WEB_ASSETS[] = {{
+{table}
+}};
+
+#endif  // WEB_WEBASSETS_H
+"""
+
+    return content, len(arrays), raw_total, gz_total
+
+
+def update_file_if_changed(path, content):
+    os.makedirs(os.path.dirname(path), exist_ok=True)
+
+    if os.path.exists(path):
+        with open(path, "r", encoding="utf-8") as f:
+            if f.read() == content:
+                return False
+
+    with open(path, "w", encoding="utf-8") as f:
+        f.write(content)
+
+    return True
+
+
+def bundle(web_dir, output):
+    content, count, raw_total, gz_total = generate(web_dir)
+    updated = update_file_if_changed(output, content)
+    state = "Updated" if updated else "No changes detected"
+
+    print(f"[web_bundle] {state}: {output} ({count} files, {raw_total} -> {gz_total} bytes)")
+
+
+try:
+    from SCons.Script import DefaultEnvironment
+except ImportError:
+    DefaultEnvironment = None
+
+if DefaultEnvironment is not None:
+    project_dir = DefaultEnvironment().get("PROJECT_DIR")
+    bundle(os.path.join(project_dir, "web"), os.path.join(project_dir, "include", "web", "WebAssets.h"))
+elif __name__ == "__main__":
+    root = os.path.normpath(os.path.join(os.path.dirname(__file__), ".."))
+    parser = argparse.ArgumentParser(description="Pack the web UI into a PROGMEM header")
+    parser.add_argument("--web", default=os.path.join(root, "web"), help="web UI directory")
+    parser.add_argument("--output", default=os.path.join(root, "include", "web", "WebAssets.h"), help="header path")
+    args = parser.parse_args()
+
+    bundle(args.web, args.output)
@@ -1,5 +1,6 @@
 #include <ArduinoJson.h>
 #include <LittleFS.h>
+#include <algorithm>
 
 #include <Logger.h>
 #include "config/ConfigManager.h"
@@ -61,6 +62,16 @@ auto ConfigManager::load() -> bool {
     lcd_spi_hz = doc["lcd_spi_hz"] | lcd_spi_hz;
     lcd_backlight_gpio = doc["lcd_backlight_gpio"] | lcd_backlight_gpio;
     lcd_backlight_active_low = doc["lcd_backlight_active_low"] | lcd_backlight_active_low;
+    lcd_backlight_level = doc["lcd_backlight_level"] | lcd_backlight_level;
+    lcd_gamma = doc["lcd_gamma"] | lcd_gamma;
+    lcd_contrast = doc["lcd_contrast"] | lcd_contrast;
+    fx_brightness = doc["fx_brightness"] | fx_brightness;
+    fx_temperature = doc["fx_temperature"] | fx_temperature;
+    fx_greyscale = doc["fx_greyscale"] | fx_greyscale;
+    setFx(fx_brightness, fx_temperature, fx_greyscale);
+    ntp_server = doc["ntp_server"] | ntp_server.c_str();
+    time_zone = doc["timezone"] | time_zone.c_str();
+    stream_port = doc["stream_port"] | stream_port;
 
     return true;
 }
@@ -187,3 +198,94 @@ auto ConfigManager::getLCDBacklightGpio() const -> int8_t { return lcd_backlight
  * @return true if the LCD backlight pin is active low false otherwise
  */
 auto ConfigManager::getLCDBacklightActiveLow() const -> bool { return lcd_backlight_active_low; }
+
+/**
+ * @brief Retrieves the LCD backlight level
+ *
+ * @return Backlight level in percent (0 = off, 100 = full)
+ */
+auto ConfigManager::getLCDBacklightLevel() const -> uint8_t { return lcd_backlight_level; }
+
+/**
+ * @brief Retrieves the LCD gamma step applied to the vendor gamma tables
+ *
+ * @return Mid-tone step from -10 to 10, 0 = vendor tables
+ */
+auto ConfigManager::getLCDGamma() const -> int8_t { return lcd_gamma; }
+
+/**
+ * @brief Retrieves the LCD contrast step applied to the vendor gamma tables
+ *
+ * @return End point step from -10 to 10, 0 = vendor tables
+ */
+auto ConfigManager::getLCDContrast() const -> int8_t { return lcd_contrast; }
+
+/**
+ * @brief Updates the LCD picture settings at runtime (not written back to the config file)
+ *
+ * @param backlightLevel Backlight level in percent
+ * @param gamma Mid-tone gamma step
+ * @param contrast Contrast step
+ */
+void ConfigManager::setLCDPanelProfile(uint8_t backlightLevel, int8_t gamma, int8_t contrast) {
+    lcd_backlight_level = backlightLevel;
+    lcd_gamma = gamma;
+    lcd_contrast = contrast;
+}
+
+/**
+ * @brief Retrieves the global colour effect brightness
+ *
+ * @return Brightness in percent (100 = unchanged)
+ */
+auto ConfigManager::getFxBrightness() const -> uint8_t { return fx_brightness; }
+
+/**
+ * @brief Retrieves the global colour effect temperature
+ *
+ * @return Temperature from -100 (cold) to 100 (warm), 0 = unchanged
+ */
+auto ConfigManager::getFxTemperature() const -> int8_t { return fx_temperature; }
+
+/**
+ * @brief Returns whether the global colour effect renders in greyscale
+ *
+ * @return true if greyscale is enabled false otherwise
+ */
+auto ConfigManager::getFxGreyscale() const -> bool { return fx_greyscale; }
+
+/**
+ * @brief Updates the global colour effect settings at runtime (not written back to the config file)
+ *
+ * Values are clamped to what the colour transform applies, so they read back as in effect
+ *
+ * @param brightness Brightness in percent, at most 100
+ * @param temperature Temperature from -100 to 100
+ * @param greyscale Greyscale rendering
+ */
+void ConfigManager::setFx(uint8_t brightness, int8_t temperature, bool greyscale) {
+    fx_brightness = std::min(brightness, FX_BRIGHTNESS_MAX);
+    fx_temperature = std::max(std::min(temperature, FX_TEMPERATURE_MAX), static_cast<int8_t>(-FX_TEMPERATURE_MAX));
+    fx_greyscale = greyscale;
+}
+
+/**
+ * @brief Retrieves the NTP server used by the clock
+ *
+ * @return Server name or IP as a c style string
+ */
+auto ConfigManager::getNtpServer() const -> const char* { return ntp_server.c_str(); }
+
+/**
+ * @brief Retrieves the timezone used by the clock
+ *
+ * @return POSIX TZ string, e.g. "CET-1CEST,M3.5.0,M10.5.0/3"
+ */
+auto ConfigManager::getTimezone() const -> const char* { return time_zone.c_str(); }
+
+/**
+ * @brief Retrieves the UDP port of the remote frame stream
+ *
+ * @return UDP port, 0 when the stream is disabled
+ */
+auto ConfigManager::getStreamPort() const -> uint16_t { return stream_port; }
@@ -0,0 +1,150 @@
+#include <array>
+#include <cstring>
+
+#include "display/Blend565.h"
+
+// Two packed pixels p0 | p1 << 16: the first mask keeps p0 red/blue and p1 green, the second one (applied after a
+// 5 bit shift) p0 green and p1 red/blue. Every field has at least 5 free bits above it for the weight product
+static constexpr uint32_t BLEND_MASK_EVEN = 0x07E0F81FU;
+static constexpr uint32_t BLEND_MASK_ODD = 0x07C0F83FU;
+static constexpr uint8_t BLEND_SHIFT = 5;
+
+// 4x4 ordered dither thresholds, a pixel switches to the new source once the level passes its threshold
+static constexpr std::array<std::array<uint8_t, 4>, 4> DISSOLVE_BAYER = {{
+    {{0, 8, 2, 10}},
+    {{12, 4, 14, 6}},
+    {{3, 11, 1, 9}},
+    {{15, 7, 13, 5}},
+}};
+
+/**
+ * @brief Mix two pixels
+ *
+ * @param from Outgoing colour
+ * @param to Incoming colour
+ * @param alpha Weight of the incoming colour, 0 .. ALPHA_MAX
+ *
+ * @return blended colour
+ */
+auto Blend565::blend(uint16_t from, uint16_t to, uint8_t alpha) -> uint16_t {
+    // Same even mask with the pixel duplicated in both halves: red/blue stay low, green comes from the upper copy
+    const uint32_t inv = ALPHA_MAX - alpha;
+    const uint32_t wideFrom = (from | (static_cast<uint32_t>(from) << 16)) & BLEND_MASK_EVEN;
+    const uint32_t wideTo = (to | (static_cast<uint32_t>(to) << 16)) & BLEND_MASK_EVEN;
+    const uint32_t mixed = (((wideFrom * inv) + (wideTo * alpha)) >> BLEND_SHIFT) & BLEND_MASK_EVEN;
+
+    return static_cast<uint16_t>(mixed | (mixed >> 16));
+}
+
+/**
+ * @brief Mix two packed pixel pairs
+ *
+ * @param from Outgoing pixels, first pixel in the low half
+ * @param to Incoming pixels
+ * @param alpha Weight of the incoming pixels, 0 .. ALPHA_MAX
+ *
+ * @return blended pair
+ */
+auto Blend565::blendPair(uint32_t from, uint32_t to, uint8_t alpha) -> uint32_t {
+    const uint32_t inv = ALPHA_MAX - alpha;
+    const uint32_t even = ((((from & BLEND_MASK_EVEN) * inv) + ((to & BLEND_MASK_EVEN) * alpha)) >> BLEND_SHIFT) &
+                          BLEND_MASK_EVEN;
+    const uint32_t odd = (((((from >> BLEND_SHIFT) & BLEND_MASK_ODD) * inv) +
+                           (((to >> BLEND_SHIFT) & BLEND_MASK_ODD) * alpha)) >>
+                          BLEND_SHIFT) &
+                         BLEND_MASK_ODD;
+
+    return even | (odd << BLEND_SHIFT);
+}
+
+/**
+ * @brief Crossfade one line
+ *
+ * @param dst Output line, may alias from or to
+ * @param from Outgoing line
+ * @param to Incoming line
+ * @param count Number of pixels
+ * @param alpha Weight of the incoming line, 0 .. ALPHA_MAX
+ *
+ * @return void
+ */
+auto Blend565::crossfade(uint16_t* dst, const uint16_t* from, const uint16_t* to, size_t count, uint8_t alpha)
+    -> void {
+    alpha = alpha > ALPHA_MAX ? ALPHA_MAX : alpha;
+
+    auto* dstPairs = reinterpret_cast<uint32_t*>(dst);
+    const auto* fromPairs = reinterpret_cast<const uint32_t*>(from);
+    const auto* toPairs = reinterpret_cast<const uint32_t*>(to);
+    const size_t pairs = count / 2;
+
+    for (size_t i = 0; i < pairs; i++) {
+        dstPairs[i] = blendPair(fromPairs[i], toPairs[i], alpha);
+    }
+
+    if ((count & 1U) != 0) {
+        dst[count - 1] = blend(from[count - 1], to[count - 1], alpha);
+    }
+}
+
+/**
+ * @brief Horizontal wipe of one line, the incoming line covers the pixels left of split
+ *
+ * @param dst Output line, may alias from or to
+ * @param from Outgoing line
+ * @param to Incoming line
+ * @param count Number of pixels
+ * @param split Wipe edge position in pixels
+ *
+ * @return void
+ */
+auto Blend565::wipe(uint16_t* dst, const uint16_t* from, const uint16_t* to, size_t count, size_t split) -> void {
+    split = split > count ? count : split;
+
+    if (dst != to) {
+        memmove(dst, to, split * sizeof(uint16_t));
+    }
+    if (dst != from) {
+        memmove(dst + split, from + split, (count - split) * sizeof(uint16_t));
+    }
+}
+
+/**
+ * @brief Ordered dissolve of one line
+ *
+ * @param dst Output line, may alias from or to
+ * @param from Outgoing line
+ * @param to Incoming line
+ * @param count Number of pixels
+ * @param row Screen row, selects the dither pattern row
+ * @param level Number of pixels out of 16 taken from the incoming line, 0 .. DISSOLVE_LEVELS
+ *
+ * @return void
+ */
+auto Blend565::dissolve(uint16_t* dst, const uint16_t* from, const uint16_t* to, size_t count, uint16_t row,
+                        uint8_t level) -> void {
+    const auto& thresholds = DISSOLVE_BAYER[row & 3U];
+
+    // Select masks for the two pixel pairs of a pattern row, then one and/or per pair
+    std::array<uint32_t, 2> masks{};
+
+    for (size_t pair = 0; pair < masks.size(); pair++) {
+        const uint32_t low = thresholds[pair * 2] < level ? 0x0000FFFFU : 0U;
+        const uint32_t high = thresholds[(pair * 2) + 1] < level ? 0xFFFF0000U : 0U;
+        masks[pair] = low | high;
+    }
+
+    auto* dstPairs = reinterpret_cast<uint32_t*>(dst);
+    const auto* fromPairs = reinterpret_cast<const uint32_t*>(from);
+    const auto* toPairs = reinterpret_cast<const uint32_t*>(to);
+    const size_t pairs = count / 2;
+
+    for (size_t i = 0; i < pairs; i++) {
+        const uint32_t mask = masks[i & 1U];
+        dstPairs[i] = (fromPairs[i] & ~mask) | (toPairs[i] & mask);
+    }
+
+    if ((count & 1U) != 0) {
+        const size_t last = count - 1;
+        dst[last] = thresholds[last & 3U] < level ? to[last] : from[last];
+    }
+}
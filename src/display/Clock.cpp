@@ -0,0 +1,165 @@
+#include <Logger.h>
+
+#include "display/Clock.h"
+#include "display/ClockFont.h"
+#include "display/DisplayManager.h"
+#include "display/ImageAsset.h"
+#include "wireless/TimeSync.h"
+
+static constexpr uint32_t CLOCK_POLL_MS = 250;
+static constexpr int16_t CLOCK_SCREEN_W = 240;
+static constexpr int16_t CLOCK_Y = 60;
+static constexpr int16_t CLOCK_X = (CLOCK_SCREEN_W - (4 * CLOCK_DIGIT_W + CLOCK_COLON_W)) / 2;
+static constexpr int16_t CLOCK_DATE_Y = CLOCK_Y + CLOCK_DIGIT_H + 24;
+static constexpr uint8_t CLOCK_DATE_SIZE = 2;
+static constexpr int16_t CLOCK_DATE_CHAR_W = 6 * CLOCK_DATE_SIZE;
+static constexpr int16_t CLOCK_DATE_CHAR_H = 8 * CLOCK_DATE_SIZE;
+static constexpr size_t CLOCK_DATE_MAX = 32;
+
+// Left edge of each slot: H H : M M
+static constexpr std::array<int16_t, 5> CLOCK_SLOT_X = {
+    CLOCK_X, CLOCK_X + CLOCK_DIGIT_W, CLOCK_X + 2 * CLOCK_DIGIT_W, CLOCK_X + 2 * CLOCK_DIGIT_W + CLOCK_COLON_W,
+    CLOCK_X + 3 * CLOCK_DIGIT_W + CLOCK_COLON_W};
+static constexpr uint8_t CLOCK_SLOT_COLON = 2;
+
+/**
+ * @brief Start showing the clock, the caller clears the screen first
+ *
+ * @return false if the display is not ready
+ */
+auto Clock::start() -> bool {
+    if (!DisplayManager::isReady()) {
+        return false;
+    }
+
+    m_tft = reinterpret_cast<Arduino_TFT*>(DisplayManager::getGfx());
+    m_shown.fill(GLYPH_UNKNOWN);
+    m_shownDay = -1;
+    m_lastSecond = 0;
+    m_lastPollMs = millis() - CLOCK_POLL_MS;
+    m_blits = 0;
+    m_running = true;
+
+    return true;
+}
+
+/**
+ * @brief Stop updating the clock, the screen is left as is
+ *
+ * @return void
+ */
+auto Clock::stop() -> void { m_running = false; }
+
+/**
+ * @brief Check whether the clock owns the screen
+ *
+ * @return true if running
+ */
+auto Clock::isRunning() const -> bool { return m_running; }
+
+/**
+ * @brief Number of glyphs blitted since start()
+ *
+ * @return blit count
+ */
+auto Clock::getBlits() const -> uint32_t { return m_blits; }
+
+/**
+ * @brief Draw one glyph in a slot, decoding the sprite from flash
+ *
+ * @param slot Slot index (0..4)
+ * @param glyph Glyph index in ClockFont.h or GLYPH_BLANK
+ *
+ * @return void
+ */
+auto Clock::drawSlot(uint8_t slot, uint8_t glyph) -> void {
+    const int16_t xPos = CLOCK_SLOT_X[slot];
+
+    if (glyph == GLYPH_BLANK) {
+        const int16_t width = (slot == CLOCK_SLOT_COLON) ? CLOCK_COLON_W : CLOCK_DIGIT_W;
+
+        m_tft->fillRect(xPos, CLOCK_Y, width, CLOCK_DIGIT_H, LCD_BLACK);
+    } else {
+        ImageAsset::ProgmemSource source(CLOCK_GLYPH_DATA + CLOCK_GLYPH_OFFSETS[glyph],
+                                         CLOCK_GLYPH_OFFSETS[glyph + 1] - CLOCK_GLYPH_OFFSETS[glyph]);
+
+        ImageAsset::draw(m_tft, source, xPos, CLOCK_Y);
+    }
+
+    m_shown[slot] = glyph;
+    m_blits++;
+}
+
+/**
+ * @brief Draw the date line centred under the digits
+ *
+ * @param now Local time
+ *
+ * @return void
+ */
+auto Clock::drawDate(const struct tm& now) -> void {
+    char text[CLOCK_DATE_MAX];
+    const size_t len = strftime(text, sizeof(text), "%a %d %b %Y", &now);
+    const auto xPos = static_cast<int16_t>((CLOCK_SCREEN_W - static_cast<int16_t>(len) * CLOCK_DATE_CHAR_W) / 2);
+
+    m_tft->fillRect(0, CLOCK_DATE_Y, CLOCK_SCREEN_W, CLOCK_DATE_CHAR_H, LCD_BLACK);
+    DisplayManager::drawTextWrapped(xPos, CLOCK_DATE_Y, String(text), CLOCK_DATE_SIZE, LCD_WHITE, LCD_BLACK, false);
+
+    m_shownDay = now.tm_mday;
+}
+
+/**
+ * @brief Poll the time and blit the slots that changed since the last tick
+ *
+ * @return true if something was drawn
+ */
+auto Clock::update() -> bool {
+    if (!m_running) {
+        return false;
+    }
+
+    const uint32_t nowMs = millis();
+
+    if (nowMs - m_lastPollMs < CLOCK_POLL_MS) {
+        return false;
+    }
+
+    m_lastPollMs = nowMs;
+
+    const time_t now = time(nullptr);
+
+    if (now == m_lastSecond) {
+        return false;
+    }
+
+    m_lastSecond = now;
+
+    struct tm local {};
+    const bool synced = TimeSync::getLocalTime(local);
+    const uint8_t colon = (now & 1) == 0 ? CLOCK_GLYPH_COLON : GLYPH_BLANK;
+    std::array<uint8_t, SLOT_COUNT> glyphs = {CLOCK_GLYPH_DASH, CLOCK_GLYPH_DASH, colon, CLOCK_GLYPH_DASH,
+                                              CLOCK_GLYPH_DASH};
+
+    if (synced) {
+        glyphs[0] = static_cast<uint8_t>(local.tm_hour / 10);
+        glyphs[1] = static_cast<uint8_t>(local.tm_hour % 10);
+        glyphs[3] = static_cast<uint8_t>(local.tm_min / 10);
+        glyphs[4] = static_cast<uint8_t>(local.tm_min % 10);
+    }
+
+    bool drawn = false;
+
+    for (uint8_t slot = 0; slot < SLOT_COUNT; slot++) {
+        if (glyphs[slot] != m_shown[slot]) {
+            drawSlot(slot, glyphs[slot]);
+            drawn = true;
+        }
+    }
+
+    if (synced && local.tm_mday != m_shownDay) {
+        drawDate(local);
+        drawn = true;
+    }
+
+    return drawn;
+}
@@ -0,0 +1,198 @@
+#include "display/ColorFx.h"
+
+// Channel gains (x256) at the temperature extremes, warm mostly drops blue, cold mostly drops red
+static constexpr int32_t FX_TEMP_RED_DROP = 96;
+static constexpr int32_t FX_TEMP_GREEN_DROP = 24;
+static constexpr int32_t FX_TEMP_BLUE_DROP = 128;
+static constexpr int32_t FX_TEMP_MAX = 100;
+static constexpr uint8_t FX_BRIGHTNESS_MAX = 100;
+
+// BT.601 luma weights (x256)
+static constexpr uint32_t FX_LUMA_R = 77;
+static constexpr uint32_t FX_LUMA_G = 150;
+static constexpr uint32_t FX_LUMA_B = 29;
+
+/**
+ * @brief Construct an identity transform
+ */
+ColorFx::ColorFx() { rebuild(); }
+
+/**
+ * @brief Replace the static settings (brightness, temperature, greyscale)
+ *
+ * @param settings New settings, brightness is clamped to 100 and temperature to +/-100
+ *
+ * @return void
+ */
+auto ColorFx::setSettings(const ColorFxSettings& settings) -> void {
+    m_settings = settings;
+
+    if (m_settings.brightness > FX_BRIGHTNESS_MAX) {
+        m_settings.brightness = FX_BRIGHTNESS_MAX;
+    }
+    if (m_settings.temperature > FX_TEMP_MAX) {
+        m_settings.temperature = FX_TEMP_MAX;
+    }
+    if (m_settings.temperature < -FX_TEMP_MAX) {
+        m_settings.temperature = -FX_TEMP_MAX;
+    }
+
+    m_dirty = true;
+}
+
+/**
+ * @brief Current static settings
+ *
+ * @return settings
+ */
+auto ColorFx::getSettings() const -> const ColorFxSettings& { return m_settings; }
+
+/**
+ * @brief Start a fade, advanced by one step on every beginFrame()
+ *
+ * A fade out ends fully black or white and stays there until clearFade() or a fade in
+ *
+ * @param frames Number of frames the fade lasts
+ * @param toWhite Fade to/from white instead of black
+ * @param fadeIn true to fade from black/white to the picture, false for the opposite
+ *
+ * @return void
+ */
+auto ColorFx::startFade(uint16_t frames, bool toWhite, bool fadeIn) -> void {
+    m_fadeFrames = frames == 0 ? 1 : frames;
+    m_fadeStep = 0;
+    m_fadeToWhite = toWhite;
+    m_fadeIn = fadeIn;
+    m_fadeAmount = fadeIn ? FX_ONE : 0;
+    m_dirty = true;
+}
+
+/**
+ * @brief Drop any fade in progress or completed
+ *
+ * @return void
+ */
+auto ColorFx::clearFade() -> void {
+    m_fadeFrames = 0;
+    m_fadeStep = 0;
+    m_fadeAmount = 0;
+    m_dirty = true;
+}
+
+/**
+ * @brief Whether a fade is still running
+ *
+ * @return true while frames remain
+ */
+auto ColorFx::isFading() const -> bool { return m_fadeFrames > 0 && m_fadeStep < m_fadeFrames; }
+
+/**
+ * @brief Whether the transform differs from identity
+ *
+ * @return false when sources can use their colours untouched
+ */
+auto ColorFx::isActive() const -> bool {
+    return m_settings.brightness < FX_BRIGHTNESS_MAX || m_settings.temperature != 0 || m_settings.greyscale ||
+           m_fadeAmount > 0 || isFading();
+}
+
+/**
+ * @brief Revision of the tables, changes with every rebuild
+ *
+ * @return revision number
+ */
+auto ColorFx::getRevision() const -> uint32_t { return m_revision; }
+
+/**
+ * @brief Advance the fade by one frame and rebuild the tables if needed
+ *
+ * @return void
+ */
+auto ColorFx::beginFrame() -> void {
+    if (isFading()) {
+        m_fadeStep++;
+
+        const auto progress = static_cast<uint16_t>((static_cast<uint32_t>(m_fadeStep) * FX_ONE) / m_fadeFrames);
+        m_fadeAmount = m_fadeIn ? static_cast<uint16_t>(FX_ONE - progress) : progress;
+        m_dirty = true;
+
+        if (m_fadeIn && !isFading()) {
+            clearFade();
+        }
+    }
+
+    if (m_dirty) {
+        rebuild();
+    }
+}
+
+/**
+ * @brief Rebuild the per-channel tables, entries are already shifted to their RGB565 position
+ *
+ * @return void
+ */
+auto ColorFx::rebuild() -> void {
+    const int32_t temp = m_settings.temperature;
+    const int32_t gainR = FX_ONE - (temp < 0 ? (-temp * FX_TEMP_RED_DROP) / FX_TEMP_MAX : 0);
+    const int32_t gainG = FX_ONE - ((temp < 0 ? -temp : temp) * FX_TEMP_GREEN_DROP) / FX_TEMP_MAX;
+    const int32_t gainB = FX_ONE - (temp > 0 ? (temp * FX_TEMP_BLUE_DROP) / FX_TEMP_MAX : 0);
+    const int32_t bright = (static_cast<int32_t>(m_settings.brightness) * FX_ONE) / FX_BRIGHTNESS_MAX;
+    const int32_t fade = m_fadeAmount;
+
+    auto channel = [&](int32_t value, int32_t gain, int32_t maxValue) -> uint16_t {
+        value = (value * gain * bright) >> 16;
+
+        const int32_t target = m_fadeToWhite ? maxValue : 0;
+        value = ((value * (FX_ONE - fade)) + (target * fade)) >> 8;
+
+        return static_cast<uint16_t>(value > maxValue ? maxValue : value);
+    };
+
+    for (size_t i = 0; i < m_lutR.size(); i++) {
+        m_lutR[i] = static_cast<uint16_t>(channel(static_cast<int32_t>(i), gainR, 0x1F) << 11);
+        m_lutB[i] = channel(static_cast<int32_t>(i), gainB, 0x1F);
+    }
+
+    for (size_t i = 0; i < m_lutG.size(); i++) {
+        m_lutG[i] = static_cast<uint16_t>(channel(static_cast<int32_t>(i), gainG, 0x3F) << 5);
+    }
+
+    m_revision++;
+    m_dirty = false;
+}
+
+/**
+ * @brief Transform one RGB565 colour
+ *
+ * @param color Source colour
+ *
+ * @return transformed colour
+ */
+auto ColorFx::apply(uint16_t color) const -> uint16_t {
+    uint32_t red = (color >> 11) & 0x1F;
+    uint32_t green = (color >> 5) & 0x3F;
+    uint32_t blue = color & 0x1F;
+
+    if (m_settings.greyscale) {
+        green = ((red * 2 * FX_LUMA_R) + (green * FX_LUMA_G) + (blue * 2 * FX_LUMA_B) + 128) >> 8;
+        red = green >> 1;
+        blue = green >> 1;
+    }
+
+    return static_cast<uint16_t>(m_lutR[red] | m_lutG[green] | m_lutB[blue]);
+}
+
+/**
+ * @brief Transform a palette
+ *
+ * @param src Source RGB565 palette
+ * @param dst Destination, may not alias src
+ * @param count Number of entries
+ *
+ * @return void
+ */
+auto ColorFx::applyPalette(const uint16_t* src, uint16_t* dst, size_t count) const -> void {
+    for (size_t i = 0; i < count; i++) {
+        dst[i] = apply(src[i]);
+    }
+}
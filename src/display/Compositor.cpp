@@ -0,0 +1,169 @@
+#include <Logger.h>
+#include <new>
+
+#include "display/Compositor.h"
+
+// Frame rate averaging window
+static constexpr uint32_t VIEWPORT_FPS_WINDOW_MS = 2000;
+
+/**
+ * @brief Start an animation in a new viewport
+ *
+ * @param path GIF or Q565 file on LittleFS
+ * @param xPos Left position in pixels
+ * @param yPos Top position in pixels
+ * @param width Viewport width in pixels
+ * @param height Viewport height in pixels
+ *
+ * @return false when all viewports are used or the animation cannot be started
+ */
+auto Compositor::add(const String& path, int16_t xPos, int16_t yPos, int16_t width, int16_t height) -> bool {
+    if (m_viewports.size() >= MAX_VIEWPORTS || width <= 0 || height <= 0) {
+        return false;
+    }
+
+    Viewport viewport;
+    bool started = false;
+
+    viewport.stats.path = path;
+    viewport.stats.xPos = xPos;
+    viewport.stats.yPos = yPos;
+    viewport.stats.width = width;
+    viewport.stats.height = height;
+
+    if (Q565::isQ565Path(path)) {
+        viewport.q565.reset(new (std::nothrow) Q565());
+
+        if (viewport.q565) {
+            viewport.q565->setViewport(xPos, yPos, width, height);
+            viewport.q565->setLoopEnabled(true);
+            started = viewport.q565->playOne(path);
+        }
+    } else {
+        viewport.gif.reset(new (std::nothrow) Gif());
+
+        if (viewport.gif && viewport.gif->begin()) {
+            viewport.gif->setViewport(xPos, yPos, width, height);
+            viewport.gif->setLoopEnabled(true);
+            started = viewport.gif->playOne(path);
+        }
+    }
+
+    if (!started) {
+        Logger::error(("Failed to start viewport animation: " + path).c_str(), "Compositor");
+
+        return false;
+    }
+
+    viewport.windowStartMs = millis();
+    m_viewports.push_back(std::move(viewport));
+
+    return true;
+}
+
+/**
+ * @brief Stop and remove every viewport
+ *
+ * @return void
+ */
+auto Compositor::clear() -> void { m_viewports.clear(); }
+
+/**
+ * @brief Check whether at least one viewport is defined
+ *
+ * @return true if the compositor owns the screen
+ */
+auto Compositor::isActive() const -> bool { return !m_viewports.empty(); }
+
+/**
+ * @brief Check whether the player of a viewport is still running
+ *
+ * @param viewport Viewport to check
+ *
+ * @return true if playing
+ */
+auto Compositor::isPlaying(const Viewport& viewport) -> bool {
+    return viewport.gif ? viewport.gif->isPlaying() : (viewport.q565 && viewport.q565->isPlaying());
+}
+
+/**
+ * @brief Time at which the next frame of a viewport is due
+ *
+ * @param viewport Viewport to check
+ *
+ * @return millis() timestamp
+ */
+auto Compositor::nextFrameMs(const Viewport& viewport) -> uint32_t {
+    return viewport.gif ? viewport.gif->nextFrameMs() : viewport.q565->nextFrameMs();
+}
+
+/**
+ * @brief Draw the frames that are due, most overdue first, within the time budget
+ *
+ * @param budgetUs Time allowed for this call, at least one frame is drawn when one is due
+ *
+ * @return void
+ */
+auto Compositor::update(uint32_t budgetUs) -> void {
+    const uint32_t startUs = micros();
+
+    do {
+        const uint32_t now = millis();
+        Viewport* next = nullptr;
+        int32_t nextLateMs = 0;
+
+        for (auto& viewport : m_viewports) {
+            if (!isPlaying(viewport)) {
+                continue;
+            }
+
+            const auto lateMs = static_cast<int32_t>(now - nextFrameMs(viewport));
+
+            if (lateMs >= 0 && (next == nullptr || lateMs > nextLateMs)) {
+                next = &viewport;
+                nextLateMs = lateMs;
+            }
+        }
+
+        if (next == nullptr) {
+            break;
+        }
+
+        const bool drawn = next->gif ? next->gif->update() : next->q565->update();
+
+        if (!drawn) {
+            break;
+        }
+
+        next->stats.frames++;
+        next->windowFrames++;
+
+        const uint32_t windowMs = millis() - next->windowStartMs;
+
+        if (windowMs >= VIEWPORT_FPS_WINDOW_MS) {
+            next->stats.fps = static_cast<float>(next->windowFrames) * 1000.0F / static_cast<float>(windowMs);
+            next->windowFrames = 0;
+            next->windowStartMs = millis();
+        }
+
+        yield();
+    } while ((micros() - startUs) < budgetUs);
+}
+
+/**
+ * @brief Placement and frame rate of every viewport
+ *
+ * @return one entry per viewport, in creation order
+ */
+auto Compositor::getStats() const -> std::vector<ViewportStats> {
+    std::vector<ViewportStats> out;
+
+    out.reserve(m_viewports.size());
+
+    for (const auto& viewport : m_viewports) {
+        out.push_back(viewport.stats);
+        out.back().playing = isPlaying(viewport);
+    }
+
+    return out;
+}
@@ -0,0 +1,127 @@
+#include <utility>
+
+#include "display/DisplayCommand.h"
+
+/**
+ * @brief Queue a command, producer side
+ *
+ * @param command Command to queue, its id is assigned here and it is moved into the ring
+ * @return id of the command, 0 if the queue is full
+ */
+auto DisplayCommandQueue::push(DisplayCommand& command) -> uint32_t {
+    if (m_ring.full()) {
+        return 0;
+    }
+
+    // ids stay below 2^30 so that they fit in a result word next to the status
+    uint32_t commandId = m_nextId.load(std::memory_order_relaxed);
+    m_nextId.store(commandId >= (UINT32_MAX >> STATUS_BITS) ? 1 : commandId + 1, std::memory_order_relaxed);
+
+    command.id = commandId;
+    (void)m_ring.push(std::move(command));  // cannot fail, only this side fills the ring
+
+    return commandId;
+}
+
+/**
+ * @brief Take the oldest command, consumer side
+ *
+ * @param command Receives the command
+ * @return true if a command was taken
+ */
+auto DisplayCommandQueue::pop(DisplayCommand& command) -> bool { return m_ring.pop(command); }
+
+/**
+ * @brief Whether no command waits, consumer side
+ *
+ * @return true if the ring is empty
+ */
+auto DisplayCommandQueue::empty() const -> bool { return m_ring.empty(); }
+
+/**
+ * @brief Record the outcome of a command taken with pop(), consumer side
+ *
+ * @param commandId Command id
+ * @param success Whether the command succeeded
+ * @return void
+ */
+auto DisplayCommandQueue::complete(uint32_t commandId, bool success) -> void {
+    const auto status = static_cast<uint32_t>(success ? DisplayCommandStatus::Done : DisplayCommandStatus::Failed);
+
+    m_results[commandId % HISTORY].store((commandId << STATUS_BITS) | status, std::memory_order_release);
+    m_lastCompleted.store(commandId, std::memory_order_release);
+}
+
+/**
+ * @brief Status of a command, producer side
+ *
+ * @param commandId Command id returned by push()
+ * @return Queued until executed, then Done or Failed while it is one of the last HISTORY results, Unknown otherwise
+ */
+auto DisplayCommandQueue::getStatus(uint32_t commandId) const -> DisplayCommandStatus {
+    const uint32_t result = m_results[commandId % HISTORY].load(std::memory_order_acquire);
+    if (commandId != 0 && (result >> STATUS_BITS) == commandId) {
+        return static_cast<DisplayCommandStatus>(result & STATUS_MASK);
+    }
+
+    // ids are executed in order: a known id newer than the last completed one is still in the ring
+    const uint32_t nextId = m_nextId.load(std::memory_order_relaxed);
+    const uint32_t lastCompleted = m_lastCompleted.load(std::memory_order_acquire);
+    if (commandId != 0 && commandId < nextId && commandId > lastCompleted) {
+        return DisplayCommandStatus::Queued;
+    }
+
+    return DisplayCommandStatus::Unknown;
+}
+
+/**
+ * @brief API name of a command type
+ *
+ * @param type Command type
+ * @return name
+ */
+auto DisplayCommandQueue::typeName(DisplayCommandType type) -> const char* {
+    switch (type) {
+        case DisplayCommandType::PlayGif:
+            return "play_gif";
+        case DisplayCommandType::StopGif:
+            return "stop_gif";
+        case DisplayCommandType::PlayEffect:
+            return "play_effect";
+        case DisplayCommandType::Fade:
+            return "fade";
+        case DisplayCommandType::DrawImage:
+            return "draw_image";
+        case DisplayCommandType::ConsolePrint:
+            return "console_print";
+        case DisplayCommandType::Clock:
+            return "clock";
+        case DisplayCommandType::ApplyColorFx:
+            return "apply_colorfx";
+        case DisplayCommandType::DrawList:
+            return "draw_list";
+        case DisplayCommandType::SetViewports:
+            return "set_viewports";
+        default:
+            return "unknown";
+    }
+}
+
+/**
+ * @brief API name of a command status
+ *
+ * @param status Command status
+ * @return name
+ */
+auto DisplayCommandQueue::statusName(DisplayCommandStatus status) -> const char* {
+    switch (status) {
+        case DisplayCommandStatus::Queued:
+            return "queued";
+        case DisplayCommandStatus::Done:
+            return "done";
+        case DisplayCommandStatus::Failed:
+            return "failed";
+        default:
+            return "unknown";
+    }
+}
@@ -0,0 +1,455 @@
+#include <LittleFS.h>
+#include <Logger.h>
+#include <algorithm>
+#include <array>
+
+#include "display/DisplayList.h"
+#include "display/ImageAsset.h"
+
+static constexpr std::array<const char*, 6> DISPLAY_OP_NAMES = {"fill", "rect", "line", "text", "image", "gif"};
+static constexpr std::array<uint8_t, 4> DISPLAY_LIST_MAGIC = {'G', 'D', 'L', 1};
+static constexpr size_t DISPLAY_OP_RECORD_SIZE = 15;
+static constexpr int16_t DISPLAY_CHAR_W = 6;
+static constexpr int16_t DISPLAY_CHAR_H = 8;
+
+/**
+ * @brief Screen area touched by an operation, right and bottom edges excluded
+ *
+ * @param op Operation
+ * @param left Receives the left edge
+ * @param top Receives the top edge
+ * @param right Receives the right edge
+ * @param bottom Receives the bottom edge
+ *
+ * @return false if the area is not known without opening a file (image, gif)
+ */
+static auto displayOpBounds(const DisplayOp& op, int32_t& left, int32_t& top, int32_t& right, int32_t& bottom)
+    -> bool {
+    switch (op.type) {
+        case DisplayOpType::Fill:
+        case DisplayOpType::Rect:
+            left = op.xPos;
+            top = op.yPos;
+            right = op.xPos + op.width;
+            bottom = op.yPos + op.height;
+
+            return true;
+
+        case DisplayOpType::Line:
+            left = std::min(op.xPos, op.width);
+            top = std::min(op.yPos, op.height);
+            right = std::max(op.xPos, op.width) + 1;
+            bottom = std::max(op.yPos, op.height) + 1;
+
+            return true;
+
+        case DisplayOpType::Text: {
+            int32_t columns = 0;
+            int32_t lines = 1;
+            int32_t current = 0;
+
+            for (size_t i = 0; i < op.text.length(); i++) {
+                if (op.text[i] == '\n') {
+                    lines++;
+                    current = 0;
+                } else {
+                    current++;
+                    columns = std::max(columns, current);
+                }
+            }
+
+            left = op.xPos;
+            top = op.yPos;
+            right = op.xPos + columns * DISPLAY_CHAR_W * op.size;
+            bottom = op.yPos + lines * DISPLAY_CHAR_H * op.size;
+
+            return true;
+        }
+
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief Look up an operation by name
+ *
+ * @param name Operation name ("fill", "rect", "line", "text", "image" or "gif"), case insensitive
+ * @param type Receives the operation type
+ *
+ * @return false if the name is unknown
+ */
+auto DisplayList::parseType(const String& name, DisplayOpType& type) -> bool {
+    for (size_t i = 0; i < DISPLAY_OP_NAMES.size(); i++) {
+        if (name.equalsIgnoreCase(DISPLAY_OP_NAMES[i])) {
+            type = static_cast<DisplayOpType>(i);
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Append an operation
+ *
+ * @param op Operation, its text is truncated to MAX_TEXT characters
+ *
+ * @return false if the list already holds MAX_OPS operations
+ */
+auto DisplayList::add(const DisplayOp& op) -> bool {
+    if (m_ops.size() >= MAX_OPS) {
+        return false;
+    }
+
+    m_ops.push_back(op);
+
+    if (m_ops.back().text.length() > MAX_TEXT) {
+        m_ops.back().text.remove(MAX_TEXT);
+    }
+
+    if (m_ops.back().size == 0) {
+        m_ops.back().size = 1;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Remove every operation
+ *
+ * @return void
+ */
+auto DisplayList::clear() -> void {
+    m_ops.clear();
+    m_merged = 0;
+    m_culled = 0;
+}
+
+/**
+ * @brief Rewrite the list into fewer and cheaper operations, the drawn result is unchanged
+ *
+ * @return void
+ */
+auto DisplayList::optimize() -> void {
+    expandOutlines();
+    cullHidden();
+    mergeFills();
+}
+
+/**
+ * @brief Turn rectangle outlines and horizontal or vertical lines into fills
+ *
+ * A fill is one address window and one writeRepeat(), the generic line and rectangle code of Arduino_GFX goes through
+ * the same path but cannot be merged or culled
+ *
+ * @return void
+ */
+auto DisplayList::expandOutlines() -> void {
+    std::vector<DisplayOp> out;
+
+    out.reserve(m_ops.size());
+
+    auto addFill = [&out](const DisplayOp& src, int16_t xPos, int16_t yPos, int16_t width, int16_t height) {
+        if (width <= 0 || height <= 0) {
+            return;
+        }
+
+        DisplayOp fill;
+
+        fill.type = DisplayOpType::Fill;
+        fill.xPos = xPos;
+        fill.yPos = yPos;
+        fill.width = width;
+        fill.height = height;
+        fill.color = src.color;
+        out.push_back(fill);
+    };
+
+    for (const DisplayOp& op : m_ops) {
+        if (op.type == DisplayOpType::Rect) {
+            if (op.width <= 0 || op.height <= 0) {
+                continue;
+            }
+
+            addFill(op, op.xPos, op.yPos, op.width, 1);
+
+            if (op.height > 1) {
+                addFill(op, op.xPos, static_cast<int16_t>(op.yPos + op.height - 1), op.width, 1);
+            }
+
+            addFill(op, op.xPos, static_cast<int16_t>(op.yPos + 1), 1, static_cast<int16_t>(op.height - 2));
+
+            if (op.width > 1) {
+                addFill(op, static_cast<int16_t>(op.xPos + op.width - 1), static_cast<int16_t>(op.yPos + 1), 1,
+                        static_cast<int16_t>(op.height - 2));
+            }
+        } else if (op.type == DisplayOpType::Line && (op.xPos == op.width || op.yPos == op.height)) {
+            int32_t left = 0;
+            int32_t top = 0;
+            int32_t right = 0;
+            int32_t bottom = 0;
+
+            displayOpBounds(op, left, top, right, bottom);
+            addFill(op, static_cast<int16_t>(left), static_cast<int16_t>(top), static_cast<int16_t>(right - left),
+                    static_cast<int16_t>(bottom - top));
+        } else if (op.type != DisplayOpType::Fill || (op.width > 0 && op.height > 0)) {
+            out.push_back(op);
+        }
+    }
+
+    m_ops.swap(out);
+}
+
+/**
+ * @brief Drop the operations entirely covered by a later fill
+ *
+ * A status card usually starts with a background fill that hides what the previous card drew in the same batch.
+ * Images and gif viewports are kept since their size is only known from the file
+ *
+ * @return void
+ */
+auto DisplayList::cullHidden() -> void {
+    std::vector<DisplayOp> out;
+
+    out.reserve(m_ops.size());
+
+    for (size_t i = 0; i < m_ops.size(); i++) {
+        int32_t left = 0;
+        int32_t top = 0;
+        int32_t right = 0;
+        int32_t bottom = 0;
+        bool hidden = false;
+
+        if (displayOpBounds(m_ops[i], left, top, right, bottom)) {
+            for (size_t j = i + 1; j < m_ops.size() && !hidden; j++) {
+                const DisplayOp& cover = m_ops[j];
+
+                hidden = cover.type == DisplayOpType::Fill && cover.xPos <= left && cover.yPos <= top &&
+                         cover.xPos + cover.width >= right && cover.yPos + cover.height >= bottom;
+            }
+        }
+
+        if (hidden) {
+            m_culled++;
+        } else {
+            out.push_back(m_ops[i]);
+        }
+    }
+
+    m_ops.swap(out);
+}
+
+/**
+ * @brief Merge consecutive fills of the same colour whose union is a rectangle
+ *
+ * @return void
+ */
+auto DisplayList::mergeFills() -> void {
+    size_t i = 1;
+
+    while (i < m_ops.size()) {
+        DisplayOp& prev = m_ops[i - 1];
+        const DisplayOp& next = m_ops[i];
+        bool merged = false;
+
+        if (prev.type == DisplayOpType::Fill && next.type == DisplayOpType::Fill && prev.color == next.color) {
+            if (prev.xPos == next.xPos && prev.width == next.width && next.yPos <= prev.yPos + prev.height &&
+                next.yPos + next.height >= prev.yPos) {
+                const int16_t top = std::min(prev.yPos, next.yPos);
+
+                prev.height = static_cast<int16_t>(std::max(prev.yPos + prev.height, next.yPos + next.height) - top);
+                prev.yPos = top;
+                merged = true;
+            } else if (prev.yPos == next.yPos && prev.height == next.height && next.xPos <= prev.xPos + prev.width &&
+                       next.xPos + next.width >= prev.xPos) {
+                const int16_t left = std::min(prev.xPos, next.xPos);
+
+                prev.width = static_cast<int16_t>(std::max(prev.xPos + prev.width, next.xPos + next.width) - left);
+                prev.xPos = left;
+                merged = true;
+            }
+        }
+
+        if (merged) {
+            m_ops.erase(m_ops.begin() + static_cast<std::ptrdiff_t>(i));
+            m_merged++;
+        } else {
+            i++;
+        }
+    }
+}
+
+/**
+ * @brief Execute the operations, the caller wraps the call in one startWrite() / endWrite()
+ *
+ * Gif operations are skipped, they are started as viewports by DisplayManager::drawDisplayList()
+ *
+ * @param tft Panel to draw on
+ *
+ * @return void
+ */
+auto DisplayList::draw(Arduino_TFT* tft) const -> void {
+    for (const DisplayOp& op : m_ops) {
+        switch (op.type) {
+            case DisplayOpType::Fill:
+                tft->writeFillRect(op.xPos, op.yPos, op.width, op.height, op.color);
+                break;
+
+            case DisplayOpType::Rect:
+                if (op.width <= 0 || op.height <= 0) {
+                    break;
+                }
+
+                tft->writeFastHLine(op.xPos, op.yPos, op.width, op.color);
+                tft->writeFastHLine(op.xPos, static_cast<int16_t>(op.yPos + op.height - 1), op.width, op.color);
+                tft->writeFastVLine(op.xPos, op.yPos, op.height, op.color);
+                tft->writeFastVLine(static_cast<int16_t>(op.xPos + op.width - 1), op.yPos, op.height, op.color);
+                break;
+
+            case DisplayOpType::Line:
+                tft->writeLine(op.xPos, op.yPos, op.width, op.height, op.color);
+                break;
+
+            case DisplayOpType::Text:
+                tft->setTextWrap(false);
+                tft->setTextSize(op.size);
+
+                if (op.bgColor == op.color) {
+                    tft->setTextColor(op.color);
+                } else {
+                    tft->setTextColor(op.color, op.bgColor);
+                }
+
+                tft->setCursor(op.xPos, op.yPos);
+                tft->print(op.text);
+                break;
+
+            case DisplayOpType::Image:
+                if (!ImageAsset::drawFile(tft, op.text, op.xPos, op.yPos)) {
+                    Logger::warn(("Cannot draw " + op.text).c_str(), "DisplayList");
+                }
+                break;
+
+            default:
+                break;
+        }
+
+        yield();
+    }
+}
+
+/**
+ * @brief Store the list as a scene file
+ *
+ * Layout: "GDL" version u8 | count u16, then per operation type u8 | x, y, w, h i16 | color, bg u16 | size u8 |
+ * text length u8 | text, all little endian
+ *
+ * @param path Destination file
+ *
+ * @return false if the file cannot be written
+ */
+auto DisplayList::save(const String& path) const -> bool {
+    File file = LittleFS.open(path, "w");
+
+    if (!file) {
+        return false;
+    }
+
+    std::array<uint8_t, DISPLAY_OP_RECORD_SIZE> record{};
+    const auto count = static_cast<uint16_t>(m_ops.size());
+    bool writeOk = file.write(DISPLAY_LIST_MAGIC.data(), DISPLAY_LIST_MAGIC.size()) == DISPLAY_LIST_MAGIC.size();
+
+    record[0] = count & 0xFF;
+    record[1] = count >> 8;
+    writeOk = writeOk && file.write(record.data(), 2) == 2;
+
+    for (const DisplayOp& op : m_ops) {
+        const std::array<uint16_t, 6> words = {static_cast<uint16_t>(op.xPos),  static_cast<uint16_t>(op.yPos),
+                                               static_cast<uint16_t>(op.width), static_cast<uint16_t>(op.height),
+                                               op.color,                        op.bgColor};
+
+        record[0] = static_cast<uint8_t>(op.type);
+
+        for (size_t i = 0; i < words.size(); i++) {
+            record[1 + 2 * i] = words[i] & 0xFF;
+            record[2 + 2 * i] = words[i] >> 8;
+        }
+
+        record[13] = op.size;
+        record[14] = static_cast<uint8_t>(op.text.length());
+
+        writeOk = writeOk && file.write(record.data(), record.size()) == record.size();
+        writeOk = writeOk && file.write(reinterpret_cast<const uint8_t*>(op.text.c_str()), op.text.length()) ==
+                                 op.text.length();
+    }
+
+    file.close();
+
+    if (!writeOk) {
+        LittleFS.remove(path);
+    }
+
+    return writeOk;
+}
+
+/**
+ * @brief Replace the list with a scene file written by save()
+ *
+ * @param path Scene file
+ *
+ * @return false if the file is missing or malformed, the list is then empty
+ */
+auto DisplayList::load(const String& path) -> bool {
+    clear();
+
+    File file = LittleFS.open(path, "r");
+
+    if (!file) {
+        return false;
+    }
+
+    std::array<uint8_t, DISPLAY_OP_RECORD_SIZE> record{};
+    std::array<char, MAX_TEXT + 1> text{};
+
+    if (file.read(record.data(), 6) != 6 || memcmp(record.data(), DISPLAY_LIST_MAGIC.data(), 4) != 0) {
+        return false;
+    }
+
+    const auto count = static_cast<uint16_t>(record[4] | (record[5] << 8));
+
+    if (count > MAX_OPS) {
+        return false;
+    }
+
+    auto readWord = [&record](size_t pos) -> uint16_t {
+        return static_cast<uint16_t>(record[pos] | (record[pos + 1] << 8));
+    };
+
+    for (uint16_t n = 0; n < count; n++) {
+        if (file.read(record.data(), record.size()) != record.size() ||
+            record[0] > static_cast<uint8_t>(DisplayOpType::Gif) || record[14] > MAX_TEXT ||
+            file.read(reinterpret_cast<uint8_t*>(text.data()), record[14]) != record[14]) {
+            clear();
+
+            return false;
+        }
+
+        DisplayOp op;
+
+        text[record[14]] = '\0';
+        op.type = static_cast<DisplayOpType>(record[0]);
+        op.xPos = static_cast<int16_t>(readWord(1));
+        op.yPos = static_cast<int16_t>(readWord(3));
+        op.width = static_cast<int16_t>(readWord(5));
+        op.height = static_cast<int16_t>(readWord(7));
+        op.color = readWord(9);
+        op.bgColor = readWord(11);
+        op.size = record[13];
+        op.text = text.data();
+        add(op);
+    }
+
+    return true;
+}
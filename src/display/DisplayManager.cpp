@@ -6,8 +6,33 @@
 #include "display/GeekMagicSPIBus.h"
 #include "config/ConfigManager.h"
 #include "display/Gif.h"
+#include "display/Clock.h"
+#include "display/Compositor.h"
+#include "display/Effects.h"
+#include "display/Q565.h"
+#include "display/ImageAsset.h"
+#include "display/BootSplash.h"
+#include "display/ScrollConsole.h"
+#include "display/StripCanvas.h"
+#include "display/Transition.h"
 
 static Gif s_gif;
+static Q565 s_q565;
+static Compositor s_compositor;
+static Effects s_effects;
+static Clock s_clock;
+static ScrollConsole s_console;
+static ColorFx s_colorFx;
+static DisplayCommandQueue s_commands;
+static std::vector<ImageDrawStats> s_imageStats;
+static constexpr size_t IMAGE_STATS_MAX = 16;
+// Slice of update() in the blocking loop of a timed playGifFullScreen(), the scheduler gives its own budget otherwise
+static constexpr uint32_t TIMED_PLAY_BUDGET_US = 20000;
+
+// Last image drawn on a cleared screen, the outgoing source of the next transition
+static String s_screenImage;
+static int16_t s_screenImageX = 0;
+static int16_t s_screenImageY = 0;
 
 extern ConfigManager configManager;
 
@@ -18,6 +43,32 @@ static bool g_lcdInitializing = false;
 static uint32_t g_lcdInitAttempts = 0;
 static uint32_t g_lcdInitLastMs = 0;
 static bool g_lcdInitOk = false;
+
+/**
+ * @brief Hardware settings the panel was initialized with, to detect config changes after the early init
+ */
+struct LcdInitParams {
+    int8_t dcGpio;
+    int8_t csGpio;
+    int8_t rstGpio;
+    int8_t backlightGpio;
+    bool csActiveHigh;
+    bool backlightActiveLow;
+    uint32_t spiHz;
+    uint8_t spiMode;
+    int16_t width;
+    int16_t height;
+};
+
+static LcdInitParams g_lcdInitParams{};
+
+// Hardware scroll region state, top/height in frame memory lines, offset in lines within the region
+static bool g_scrollActive = false;
+static bool g_scrollFlipped = false;
+static uint16_t g_scrollTop = 0;
+static uint16_t g_scrollHeight = 0;
+static uint16_t g_scrollOffset = 0;
+static constexpr size_t SPLASH_CHUNK_BYTES = 64;
 static constexpr uint32_t LCD_HARDWARE_RESET_DELAY_MS = 100;
 static constexpr uint32_t LCD_BEGIN_DELAY_MS = 10;
 static constexpr int16_t DISPLAY_PADDING = 10;
@@ -51,6 +102,11 @@ static constexpr uint8_t ST7789_GAMMA_CTRL = 0xE4;
 static constexpr uint8_t ST7789_INVERSION_ON = 0x21;
 static constexpr uint8_t ST7789_DISPLAY_ON = 0x29;
 
+// Vertical scrolling (VSCRDEF / VSCSAD), expressed in frame memory lines: the ST7789 GRAM has 320 of them
+static constexpr uint8_t ST7789_SCROLL_DEFINITION = 0x33;
+static constexpr uint8_t ST7789_SCROLL_START = 0x37;
+static constexpr uint16_t ST7789_GRAM_LINES = 320;
+
 // Porch parameters used in sequence
 static constexpr uint8_t ST7789_PORCH_PARAM_HS = 0x1F;
 static constexpr uint8_t ST7789_PORCH_PARAM_VS = 0x1F;
@@ -79,6 +135,24 @@ static constexpr std::array<uint8_t, 14> ST7789_GAMMA_NEG_DATA = {0xF0, 0x0E, 0x
                                                                   0x32, 0x44, 0x39, 0x17, 0x18, 0x2B, 0x2F};
 static constexpr std::array<uint8_t, 3> ST7789_GAMMA_CTRL_DATA = {0x1D, 0x00, 0x00};
 
+// Gamma block byte indexes (PVGAMCTRL/NVGAMCTRL), see lcdBuildGamma
+static constexpr size_t GAMMA_V63_V0 = 0;
+static constexpr size_t GAMMA_V1 = 1;
+static constexpr size_t GAMMA_V2 = 2;
+static constexpr size_t GAMMA_J0_V13 = 5;
+static constexpr size_t GAMMA_V20 = 6;
+static constexpr size_t GAMMA_V36_V27 = 7;
+static constexpr size_t GAMMA_V43 = 8;
+static constexpr size_t GAMMA_J1_V50 = 9;
+static constexpr size_t GAMMA_V61 = 12;
+static constexpr size_t GAMMA_V62 = 13;
+static constexpr int8_t GAMMA_PROFILE_MAX = 10;
+
+// Backlight PWM (ESP8266 analogWrite is a timer driven software PWM)
+static constexpr uint32_t BACKLIGHT_PWM_HZ = 1000;
+static constexpr uint32_t BACKLIGHT_PWM_RANGE = 255;
+static constexpr uint8_t BACKLIGHT_LEVEL_MAX = 100;
+
 // Column/row address parameters
 static constexpr uint8_t ST7789_ADDR_START_HIGH = 0x00;
 static constexpr uint8_t ST7789_ADDR_START_LOW = 0x00;
@@ -93,21 +167,57 @@ static constexpr uint8_t ST7789_ADDR_END_LOW = 0xEF;
 auto DisplayManager::getGfx() -> Arduino_GFX* { return g_lcd; }
 
 /**
- * @brief Turn the LCD backlight on
+ * @brief Get the data bus of the LCD, to stream pixel bytes inside an address window opened on getGfx()
+ *
+ * @return Pointer to the bus
+ */
+auto DisplayManager::getBus() -> Arduino_DataBus* { return g_lcdBus; }
+
+/**
+ * @brief Drive the LCD backlight at a given level
+ *
+ * 0 and 100 are plain GPIO levels, anything in between uses PWM, inverted when the backlight is active low
+ *
+ * @param level Brightness in percent
  *
  * @return void
  */
-static inline void lcdBacklightOn() {
+static void lcdSetBacklightLevel(uint8_t level) {
     int8_t gpio = configManager.getLCDBacklightGpioSafe();
     if (gpio < 0) {
         Logger::warn("No backlight GPIO defined", "DisplayManager");
         return;
     }
 
+    const bool activeLow = configManager.getLCDBacklightActiveLowSafe();
+    level = level > BACKLIGHT_LEVEL_MAX ? BACKLIGHT_LEVEL_MAX : level;
+
     pinMode((uint8_t)gpio, OUTPUT);
-    digitalWrite((uint8_t)gpio, configManager.getLCDBacklightActiveLowSafe() ? LOW : HIGH);
+
+    if (level == 0 || level == BACKLIGHT_LEVEL_MAX) {
+        const bool lit = level == BACKLIGHT_LEVEL_MAX;
+        digitalWrite((uint8_t)gpio, (lit != activeLow) ? HIGH : LOW);
+
+        return;
+    }
+
+    uint32_t duty = (static_cast<uint32_t>(level) * BACKLIGHT_PWM_RANGE) / BACKLIGHT_LEVEL_MAX;
+    if (activeLow) {
+        duty = BACKLIGHT_PWM_RANGE - duty;
+    }
+
+    analogWriteRange(BACKLIGHT_PWM_RANGE);
+    analogWriteFreq(BACKLIGHT_PWM_HZ);
+    analogWrite((uint8_t)gpio, static_cast<int>(duty));
 }
 
+/**
+ * @brief Turn the LCD backlight on at the configured level
+ *
+ * @return void
+ */
+static inline void lcdBacklightOn() { lcdSetBacklightLevel(configManager.getLCDBacklightLevel()); }
+
 /**
  * @brief Write a single command byte to the ST7789 via the data bus
  *
@@ -281,6 +391,186 @@ static void lcdRunVendorInit() {
     g_lcdBus->endWrite();
 }
 
+/**
+ * @brief Add a clamped delta to a bit field of a gamma byte
+ *
+ * @param value Gamma byte
+ * @param shift Field position
+ * @param bits Field width
+ * @param delta Signed change
+ *
+ * @return the byte with the field updated
+ */
+static auto lcdGammaField(uint8_t value, uint8_t shift, uint8_t bits, int delta) -> uint8_t {
+    const int maxValue = (1 << bits) - 1;
+    int field = ((value >> shift) & maxValue) + delta;
+
+    field = field < 0 ? 0 : (field > maxValue ? maxValue : field);
+
+    return static_cast<uint8_t>((value & ~(maxValue << shift)) | (field << shift));
+}
+
+/**
+ * @brief Derive a gamma block from the vendor one
+ *
+ * The 14 bytes hold the reference voltages V0..V63 of the source driver: V0/V1/V2 and V61/V62/V63 set the dark and
+ * bright ends, V13/V20/V27/V36/V43/V50 the mid-tones. The gamma step moves the mid-tone references, the contrast
+ * step spreads the two ends apart. Both are clamped to their field widths, 0/0 returns the vendor block
+ *
+ * @param base Vendor gamma block
+ * @param gamma Mid-tone step (-10 .. 10)
+ * @param contrast End point step (-10 .. 10)
+ *
+ * @return adjusted block
+ */
+static auto lcdBuildGamma(const std::array<uint8_t, 14>& base, int8_t gamma, int8_t contrast)
+    -> std::array<uint8_t, 14> {
+    std::array<uint8_t, 14> out = base;
+
+    out[GAMMA_J0_V13] = lcdGammaField(out[GAMMA_J0_V13], 0, 4, gamma / 2);
+    out[GAMMA_V20] = lcdGammaField(out[GAMMA_V20], 0, 7, gamma * 3);
+    out[GAMMA_V36_V27] = lcdGammaField(out[GAMMA_V36_V27], 0, 3, gamma / 3);
+    out[GAMMA_V36_V27] = lcdGammaField(out[GAMMA_V36_V27], 4, 3, gamma / 3);
+    out[GAMMA_V43] = lcdGammaField(out[GAMMA_V43], 0, 7, gamma * 3);
+    out[GAMMA_J1_V50] = lcdGammaField(out[GAMMA_J1_V50], 0, 4, gamma / 2);
+
+    out[GAMMA_V63_V0] = lcdGammaField(out[GAMMA_V63_V0], 0, 4, -contrast / 2);
+    out[GAMMA_V1] = lcdGammaField(out[GAMMA_V1], 0, 6, -contrast);
+    out[GAMMA_V2] = lcdGammaField(out[GAMMA_V2], 0, 6, -contrast);
+    out[GAMMA_V61] = lcdGammaField(out[GAMMA_V61], 0, 6, contrast);
+    out[GAMMA_V62] = lcdGammaField(out[GAMMA_V62], 0, 6, contrast);
+    out[GAMMA_V63_V0] = lcdGammaField(out[GAMMA_V63_V0], 4, 4, contrast / 2);
+
+    return out;
+}
+
+/**
+ * @brief Upload positive and negative gamma blocks computed from the configured profile
+ *
+ * Only E0/E1 are written, the panel keeps running and GRAM is untouched
+ *
+ * @return void
+ */
+static void lcdWriteGamma() {
+    if (g_lcdBus == nullptr) {
+        return;
+    }
+
+    const int8_t gamma = configManager.getLCDGamma();
+    const int8_t contrast = configManager.getLCDContrast();
+    const auto positive = lcdBuildGamma(ST7789_GAMMA_POS_DATA, gamma, contrast);
+    const auto negative = lcdBuildGamma(ST7789_GAMMA_NEG_DATA, gamma, contrast);
+
+    g_lcdBus->beginWrite();
+
+    ST7789_WriteCommand(ST7789_GAMMA_POS);
+    for (uint8_t v : positive) {
+        ST7789_WriteData(v);
+    }
+
+    ST7789_WriteCommand(ST7789_GAMMA_NEG);
+    for (uint8_t v : negative) {
+        ST7789_WriteData(v);
+    }
+
+    g_lcdBus->endWrite();
+}
+
+/**
+ * @brief Stream the flash resident boot splash to the panel, centred
+ *
+ * Called right after lcdRunVendorInit, before LittleFS is mounted, and again by applyConfig when config.json sets
+ * another rotation: the splash is stored upright in PROGMEM as big endian RGB565 and the rotation is already set
+ * (MADCTL), so the whole screen is written in one RAMWR with the background as repeats around the splash rectangle.
+ * See scripts/splash_gen.py
+ *
+ * @return void
+ */
+static void lcdPushBootSplash() {
+    if (g_lcd == nullptr || g_lcdBus == nullptr) {
+        return;
+    }
+
+    auto* tft = reinterpret_cast<Arduino_TFT*>(g_lcd);
+    const auto screenW = static_cast<uint32_t>(g_lcd->width());
+    const auto screenH = static_cast<uint32_t>(g_lcd->height());
+    const bool splashFits = BOOT_SPLASH_W <= screenW && BOOT_SPLASH_H <= screenH;
+    const uint32_t splashW = splashFits ? BOOT_SPLASH_W : 0;
+    const uint32_t splashRows = splashFits ? BOOT_SPLASH_H : 0;
+    const uint32_t leftPad = (screenW - splashW) / 2;
+    const uint32_t rightPad = screenW - leftPad - splashW;
+    const uint32_t rowsAbove = (screenH - splashRows) / 2;
+    std::array<uint8_t, SPLASH_CHUNK_BYTES> chunk{};
+
+    tft->startWrite();
+    tft->writeAddrWindow(0, 0, static_cast<uint16_t>(screenW), static_cast<uint16_t>(screenH));
+
+    if (rowsAbove > 0) {
+        g_lcdBus->writeRepeat(BOOT_SPLASH_BG, rowsAbove * screenW);
+    }
+
+    const uint8_t* src = BOOT_SPLASH_DATA;
+
+    for (uint32_t row = 0; row < splashRows; row++) {
+        if (leftPad > 0) {
+            g_lcdBus->writeRepeat(BOOT_SPLASH_BG, leftPad);
+        }
+
+        size_t remaining = static_cast<size_t>(BOOT_SPLASH_W) * 2U;
+
+        while (remaining > 0) {
+            const size_t len = remaining < chunk.size() ? remaining : chunk.size();
+
+            memcpy_P(chunk.data(), src, len);
+            g_lcdBus->writeBytes(chunk.data(), static_cast<uint32_t>(len));
+            src += len;
+            remaining -= len;
+        }
+
+        if (rightPad > 0) {
+            g_lcdBus->writeRepeat(BOOT_SPLASH_BG, rightPad);
+        }
+    }
+
+    const uint32_t rowsBelow = screenH - rowsAbove - splashRows;
+
+    if (rowsBelow > 0) {
+        g_lcdBus->writeRepeat(BOOT_SPLASH_BG, rowsBelow * screenW);
+    }
+
+    tft->endWrite();
+}
+
+/**
+ * @brief Snapshot the hardware settings from the current configuration
+ *
+ * @return settings used by lcdEnsureInit
+ */
+static auto lcdCurrentParams() -> LcdInitParams {
+    return LcdInitParams{configManager.getLCDDcGpioSafe(),
+                         configManager.getLCDCsGpioSafe(),
+                         configManager.getLCDRstGpioSafe(),
+                         configManager.getLCDBacklightGpioSafe(),
+                         configManager.getLCDCsActiveHighSafe(),
+                         configManager.getLCDBacklightActiveLowSafe(),
+                         configManager.getLCDSpiHzSafe(),
+                         configManager.getLCDSpiModeSafe(),
+                         configManager.getLCDWidthSafe(),
+                         configManager.getLCDHeightSafe()};
+}
+
+/**
+ * @brief Compare two hardware setting snapshots
+ *
+ * @return true if a re-init is not needed to go from one to the other
+ */
+static auto lcdSameParams(const LcdInitParams& lhs, const LcdInitParams& rhs) -> bool {
+    return lhs.dcGpio == rhs.dcGpio && lhs.csGpio == rhs.csGpio && lhs.rstGpio == rhs.rstGpio &&
+           lhs.backlightGpio == rhs.backlightGpio && lhs.csActiveHigh == rhs.csActiveHigh &&
+           lhs.backlightActiveLow == rhs.backlightActiveLow && lhs.spiHz == rhs.spiHz && lhs.spiMode == rhs.spiMode &&
+           lhs.width == rhs.width && lhs.height == rhs.height;
+}
+
 /**
  * @brief Perform a hardware reset of the LCD panel
  *
@@ -344,6 +634,7 @@ static void lcdEnsureInit() {
     int16_t lcd_w = configManager.getLCDWidthSafe();
     int16_t lcd_h = configManager.getLCDHeightSafe();
 
+    g_lcdInitParams = lcdCurrentParams();
     g_lcdBus = new GeekMagicSPIBus(dc_gpio, cs_gpio, cs_active_high, (int32_t)spi_hz, (int8_t)spi_mode);
     g_lcd = new Arduino_ST7789(g_lcdBus, -1, rotation, true, lcd_w, lcd_h);
 
@@ -356,8 +647,12 @@ static void lcdEnsureInit() {
     g_lcdBus->begin((int32_t)spi_hz, (int8_t)spi_mode);
 
     lcdRunVendorInit();
-
     g_lcd->setRotation(rotation);
+    lcdPushBootSplash();
+
+    if (configManager.getLCDGamma() != 0 || configManager.getLCDContrast() != 0) {
+        lcdWriteGamma();
+    }
 
     g_lcdReady = true;
     g_lcdInitializing = false;
@@ -368,7 +663,6 @@ static void lcdEnsureInit() {
         "DisplayManager");
     Logger::info(("Width=" + String(g_lcd->width()) + " height=" + String(g_lcd->height())).c_str(), "DisplayManager");
 
-    g_lcd->fillScreen(LCD_BLACK);
     g_lcd->setTextColor(LCD_WHITE, LCD_BLACK);
 
     Logger::info("Initialization completed", "DisplayManager");
@@ -516,6 +810,7 @@ static auto lcdWrapText(int16_t startX, int16_t startY, const String& text, uint
  *
  * - Wraps words to fit the remaining width and limits the number of lines to avoid overflowing the screen
  *
+ * @param gfx Target, the panel or a StripCanvas
  * @param startX Starting X coordinate in pixels
  * @param startY Starting Y coordinate in pixels
  * @param text The text to draw (can contain newlines)
@@ -524,10 +819,10 @@ static auto lcdWrapText(int16_t startX, int16_t startY, const String& text, uint
  * @param bgColor Background color (16-bit RGB565)
  * @param clearBg If true, clears the background rectangle before drawing
  */
-static void lcdDrawTextWrapped(int16_t startX, int16_t startY, const String& text, uint8_t textSize, uint16_t fgColor,
-                               uint16_t bgColor, bool clearBg) {
-    const auto screenW = static_cast<int16_t>(g_lcd->width());
-    const auto screenH = static_cast<int16_t>(g_lcd->height());
+static void lcdDrawTextWrapped(Arduino_GFX* gfx, int16_t startX, int16_t startY, const String& text, uint8_t textSize,
+                               uint16_t fgColor, uint16_t bgColor, bool clearBg) {
+    const auto screenW = static_cast<int16_t>(gfx->width());
+    const auto screenH = static_cast<int16_t>(gfx->height());
 
     if (startX < 0) {
         startX = 0;
@@ -555,15 +850,15 @@ static void lcdDrawTextWrapped(int16_t startX, int16_t startY, const String& tex
 
     if (clearBg) {
         const auto heightPixels = static_cast<int16_t>(static_cast<int>(lines.size()) * static_cast<int>(charH));
-        g_lcd->fillRect(startX, startY, static_cast<int16_t>(screenW - startX), static_cast<int16_t>(heightPixels),
-                        bgColor);
+        gfx->fillRect(startX, startY, static_cast<int16_t>(screenW - startX), static_cast<int16_t>(heightPixels),
+                      bgColor);
     }
 
-    g_lcd->setTextSize(textSize);
-    g_lcd->setTextColor(fgColor, bgColor);
+    gfx->setTextSize(textSize);
+    gfx->setTextColor(fgColor, bgColor);
     for (size_t li = 0; li < lines.size(); ++li) {
-        g_lcd->setCursor(startX, static_cast<int16_t>(startY + static_cast<int>(li) * static_cast<int>(charH)));
-        g_lcd->print(lines[li]);
+        gfx->setCursor(startX, static_cast<int16_t>(startY + static_cast<int>(li) * static_cast<int>(charH)));
+        gfx->print(lines[li]);
     }
 }
 
@@ -576,6 +871,89 @@ static void lcdDrawTextWrapped(int16_t startX, int16_t startY, const String& tex
  */
 auto DisplayManager::begin() -> void { lcdEnsureInit(); }
 
+/**
+ * @brief Apply the loaded configuration to a panel initialized early with the compiled defaults
+ *
+ * The boot splash is shown before config.json is read. Once it is loaded, the panel is only re-initialized when a
+ * hardware setting differs, a rotation change is applied in place and the splash drawn again the new way up
+ *
+ * @return void
+ */
+auto DisplayManager::applyConfig() -> void {
+    DisplayManager::applyColorFxSettings();
+
+    if (!configManager.getLCDEnableSafe()) {
+        if (g_lcdReady) {
+            Logger::info("LCD disabled by configuration", "DisplayManager");
+
+            const int8_t gpio = g_lcdInitParams.backlightGpio;
+            if (gpio >= 0) {
+                digitalWrite((uint8_t)gpio, g_lcdInitParams.backlightActiveLow ? HIGH : LOW);
+            }
+        }
+
+        g_lcdReady = false;
+        g_lcdInitOk = false;
+
+        return;
+    }
+
+    if (!g_lcdReady) {
+        lcdEnsureInit();
+
+        return;
+    }
+
+    if (!lcdSameParams(g_lcdInitParams, lcdCurrentParams())) {
+        Logger::info("LCD hardware settings changed, re-initializing", "DisplayManager");
+
+        g_lcdReady = false;
+        lcdEnsureInit();
+
+        return;
+    }
+
+    if (g_lcd->getRotation() != configManager.getLCDRotationSafe()) {
+        g_lcd->setRotation(configManager.getLCDRotationSafe());
+        lcdPushBootSplash();
+    }
+
+    DisplayManager::applyPanelProfile();
+}
+
+/**
+ * @brief Apply the backlight level and gamma profile from the configuration without re-initializing the panel
+ *
+ * @return void
+ */
+auto DisplayManager::applyPanelProfile() -> void {
+    if (!DisplayManager::isReady()) {
+        return;
+    }
+
+    lcdSetBacklightLevel(configManager.getLCDBacklightLevel());
+    lcdWriteGamma();
+}
+
+/**
+ * @brief Change the backlight level and gamma profile at runtime
+ *
+ * @param backlightLevel Backlight in percent (0 .. 100)
+ * @param gamma Mid-tone step (-10 .. 10)
+ * @param contrast Contrast step (-10 .. 10)
+ * @return void
+ */
+auto DisplayManager::setPanelProfile(uint8_t backlightLevel, int8_t gamma, int8_t contrast) -> void {
+    auto clampStep = [](int8_t value) -> int8_t {
+        return value > GAMMA_PROFILE_MAX ? GAMMA_PROFILE_MAX : (value < -GAMMA_PROFILE_MAX ? -GAMMA_PROFILE_MAX : value);
+    };
+
+    backlightLevel = backlightLevel > BACKLIGHT_LEVEL_MAX ? BACKLIGHT_LEVEL_MAX : backlightLevel;
+
+    configManager.setLCDPanelProfile(backlightLevel, clampStep(gamma), clampStep(contrast));
+    DisplayManager::applyPanelProfile();
+}
+
 /**
  * @brief Check if the display is ready for drawing
  *
@@ -604,29 +982,62 @@ auto DisplayManager::drawStartup(String currentIP) -> void {
     g_lcd->fillScreen(LCD_BLUE);
     delay(rgbDelayMs);
 
-    g_lcd->fillScreen(LCD_BLACK);
-
     int constexpr titleY = 10;
     int constexpr fontSize = 2;
+    const String version = String(PROJECT_VER_STR);
+    const String ipLine = "IP: " + currentIP;
+
+    DisplayManager::compose(LCD_BLACK, [&](Arduino_GFX& gfx) {
+        lcdDrawTextWrapped(&gfx, DISPLAY_PADDING, titleY, "GeekMagic Open Firmware", fontSize, LCD_WHITE, LCD_BLACK,
+                           false);
+        lcdDrawTextWrapped(&gfx, DISPLAY_PADDING, titleY + THREE_LINES_SPACE, version, fontSize, LCD_WHITE, LCD_BLACK,
+                           false);
+        lcdDrawTextWrapped(&gfx, DISPLAY_PADDING, (titleY + THREE_LINES_SPACE + TWO_LINES_SPACE), ipLine, fontSize,
+                           LCD_WHITE, LCD_BLACK, false);
+
+        const int16_t box = 40;
+        const int16_t gap = 20;
+        const int16_t boxY = titleY + (THREE_LINES_SPACE * 2) + ONE_LINE_SPACE;
+
+        gfx.fillRect(DISPLAY_PADDING, boxY, box, box, LCD_RED);
+        gfx.fillRect((int16_t)(DISPLAY_PADDING + box + gap), boxY, box, box, LCD_GREEN);
+        gfx.fillRect((int16_t)(DISPLAY_PADDING + (box + gap) * 2), boxY, box, box, LCD_BLUE);
+    });
 
-    DisplayManager::drawTextWrapped(DISPLAY_PADDING, titleY, "GeekMagic Open Firmware", fontSize, LCD_WHITE, LCD_BLACK,
-                                    false);
-    DisplayManager::drawTextWrapped(DISPLAY_PADDING, titleY + THREE_LINES_SPACE, String(PROJECT_VER_STR), fontSize,
-                                    LCD_WHITE, LCD_BLACK, false);
-    DisplayManager::drawTextWrapped(DISPLAY_PADDING, (titleY + THREE_LINES_SPACE + TWO_LINES_SPACE), "IP: " + currentIP,
-                                    fontSize, LCD_WHITE, LCD_BLACK, false);
+    yield();
 
-    const int16_t box = 40;
-    const int16_t gap = 20;
-    const int16_t boxY = titleY + (THREE_LINES_SPACE * 2) + ONE_LINE_SPACE;
+    Logger::info("Startup screen drawn", "DisplayManager");
+}
 
-    g_lcd->fillRect(DISPLAY_PADDING, boxY, box, box, LCD_RED);
-    g_lcd->fillRect((int16_t)(DISPLAY_PADDING + box + gap), boxY, box, box, LCD_GREEN);
-    g_lcd->fillRect((int16_t)(DISPLAY_PADDING + (box + gap) * 2), boxY, box, box, LCD_BLUE);
+/**
+ * @brief Draw a full screen through the strip canvas, band by band
+ *
+ * The callback draws the whole screen with Arduino_GFX primitives and is replayed once per band. Falls back to
+ * drawing straight to the panel when the band buffer cannot be allocated
+ *
+ * @param background Colour the screen is cleared to
+ * @param draw Drawing callback
+ * @return void
+ */
+auto DisplayManager::compose(uint16_t background, const std::function<void(Arduino_GFX&)>& draw) -> void {
+    if (!DisplayManager::isReady()) {
+        return;
+    }
 
-    yield();
+    DisplayManager::resetScroll();
+    s_screenImage = "";
 
-    Logger::info("Startup screen drawn", "DisplayManager");
+    StripCanvas canvas(g_lcd->width(), g_lcd->height());
+
+    if (!canvas.begin()) {
+        Logger::warn("Not enough memory for the strip canvas, drawing directly", "DisplayManager");
+        g_lcd->fillScreen(background);
+        draw(*g_lcd);
+
+        return;
+    }
+
+    canvas.compose(reinterpret_cast<Arduino_TFT*>(g_lcd), background, draw);
 }
 
 /**
@@ -644,7 +1055,7 @@ auto DisplayManager::drawStartup(String currentIP) -> void {
  */
 void DisplayManager::drawTextWrapped(int16_t xPos, int16_t yPos, const String& text, uint8_t textSize, uint16_t fgColor,
                                      uint16_t bgColor, bool clearBg) {
-    lcdDrawTextWrapped(xPos, yPos, text, textSize, fgColor, bgColor, clearBg);
+    lcdDrawTextWrapped(g_lcd, xPos, yPos, text, textSize, fgColor, bgColor, clearBg);
 }
 
 /**
@@ -681,22 +1092,40 @@ void DisplayManager::drawLoadingBar(float progress, int yPos, int barWidth, int
 }
 
 /**
- * @brief Play a single GIF file in full screen mode (blocking)
+ * @brief Play a single GIF or Q565 animation in full screen mode (blocking)
  *
- * @param path Path to the GIF file on LittleFS
- * @param timeMs Duration to play the GIF in milliseconds (0 = play full GIF)
+ * The player is picked from the file extension, .q565 files use the Q565 decoder
+ *
+ * @param path Path to the animation file on LittleFS
+ * @param timeMs Duration to play the animation in milliseconds (0 = play full animation)
  * @return true if played successfully, false on error
  */
 auto DisplayManager::playGifFullScreen(const String& path, uint32_t timeMs) -> bool {
-    if (!s_gif.begin()) {
+    const bool isQ565 = Q565::isQ565Path(path);
+
+    if (!isQ565 && !s_gif.begin()) {
         return false;
     }
 
+    s_compositor.clear();
+    s_effects.stop();
+    s_clock.stop();
+    s_gif.stop();
+    s_q565.stop();
+    s_gif.update();
+    s_q565.update();
+
     DisplayManager::clearScreen();
 
-    s_gif.setLoopEnabled(timeMs == 0);
+    bool started = false;
+    if (isQ565) {
+        s_q565.setLoopEnabled(timeMs == 0);
+        started = s_q565.playOne(path);
+    } else {
+        s_gif.setLoopEnabled(timeMs == 0);
+        started = s_gif.playOne(path);
+    }
 
-    const bool started = s_gif.playOne(path);
     if (!started) {
         return false;
     }
@@ -708,46 +1137,658 @@ auto DisplayManager::playGifFullScreen(const String& path, uint32_t timeMs) -> b
     const uint32_t startMs = millis();
     const uint32_t endMs = startMs + timeMs;
 
-    while (s_gif.isPlaying() && static_cast<int32_t>(millis() - endMs) < 0) {
-        s_gif.update();
+    while ((s_gif.isPlaying() || s_q565.isPlaying()) && static_cast<int32_t>(millis() - endMs) < 0) {
+        DisplayManager::update(TIMED_PLAY_BUDGET_US);
         yield();
     }
 
-    if (s_gif.isPlaying()) {
-        s_gif.stop();
-    }
+    s_gif.stop();
+    s_q565.stop();
 
-    while (s_gif.isPlaying()) {
-        s_gif.update();
+    while (s_gif.isPlaying() || s_q565.isPlaying()) {
+        DisplayManager::update(TIMED_PLAY_BUDGET_US);
         yield();
     }
 
     s_gif.setLoopEnabled(false);
+    s_q565.setLoopEnabled(false);
 
     return true;
 }
 
 /**
- * @brief Stop GIF playback if playing
+ * @brief Stop GIF, Q565, effect or clock playback if playing, including the viewports
  *
+ * @param clear Clear the screen, otherwise the last frame stays (the console still ends, its scroll reset)
  * @return true
  */
-auto DisplayManager::stopGif() -> bool {
+auto DisplayManager::stopGif(bool clear) -> bool {
+    s_compositor.clear();
+    s_effects.stop();
+    s_clock.stop();
     s_gif.stop();
+    s_q565.stop();
+
+    if (!clear) {
+        DisplayManager::resetScroll();
+        s_screenImage = "";
+
+        return true;
+    }
 
     DisplayManager::clearScreen();
 
     return true;
 }
 
-auto DisplayManager::update() -> void { s_gif.update(); }
+/**
+ * @brief Draw a compressed image asset (.gmi) at the given position
+ *
+ * The decode and push time is recorded per asset path, see getImageStats()
+ *
+ * @param path Path to the image on LittleFS
+ * @param xPos Left position in pixels
+ * @param yPos Top position in pixels
+ * @return true if the image was drawn
+ */
+auto DisplayManager::drawImage(const String& path, int16_t xPos, int16_t yPos) -> bool {
+    if (!DisplayManager::isReady()) {
+        Logger::warn("Display not ready", "DisplayManager");
+
+        return false;
+    }
+
+    const uint32_t startUs = micros();
+    const bool drawOk = ImageAsset::drawFile(reinterpret_cast<Arduino_TFT*>(g_lcd), path, xPos, yPos);
+    const uint32_t elapsedUs = micros() - startUs;
+
+    if (!drawOk) {
+        return false;
+    }
+
+    ImageDrawStats* stats = nullptr;
+
+    for (auto& entry : s_imageStats) {
+        if (entry.path == path) {
+            stats = &entry;
+            break;
+        }
+    }
+
+    if (stats == nullptr) {
+        if (s_imageStats.size() >= IMAGE_STATS_MAX) {
+            s_imageStats.erase(s_imageStats.begin());
+        }
+
+        s_imageStats.push_back(ImageDrawStats{path});
+        stats = &s_imageStats.back();
+    }
+
+    stats->draws++;
+    stats->lastUs = elapsedUs;
+    stats->totalUs += elapsedUs;
+    stats->maxUs = elapsedUs > stats->maxUs ? elapsedUs : stats->maxUs;
+
+    s_screenImage = path;
+    s_screenImageX = xPos;
+    s_screenImageY = yPos;
+
+    Logger::info((path + " drawn in " + String(elapsedUs) + " us").c_str(), "DisplayManager");
+
+    return true;
+}
+
+/**
+ * @brief Replace the screen content with a compressed image through an animated transition
+ *
+ * The outgoing picture is the last image drawn with drawImage() or transitionToImage() when nothing else was drawn
+ * since, a black screen otherwise. The panel memory cannot be read back, so a running animation is stopped and
+ * cleared first and the transition starts from black
+ *
+ * @param path Path to the image on LittleFS
+ * @param xPos Left position in pixels
+ * @param yPos Top position in pixels
+ * @param type Transition kind
+ * @param durationMs Transition length in milliseconds
+ * @return true if the image was drawn
+ */
+auto DisplayManager::transitionToImage(const String& path, int16_t xPos, int16_t yPos, TransitionType type,
+                                       uint32_t durationMs) -> bool {
+    if (!DisplayManager::isReady()) {
+        Logger::warn("Display not ready", "DisplayManager");
+
+        return false;
+    }
+
+    if (s_gif.isPlaying() || s_q565.isPlaying() || s_console.isActive() || s_compositor.isActive() ||
+        s_effects.isPlaying() || s_clock.isRunning()) {
+        DisplayManager::stopGif();
+    }
+
+    SolidLineSource blank(LCD_BLACK);
+    ImageLineSource previous(s_screenImage, s_screenImageX, s_screenImageY, LCD_BLACK);
+    ImageLineSource next(path, xPos, yPos, LCD_BLACK);
+    LineSource& from = s_screenImage.isEmpty() ? static_cast<LineSource&>(blank) : previous;
+    auto* tft = reinterpret_cast<Arduino_TFT*>(g_lcd);
+
+    // A broken outgoing image (deleted since) degrades to a cut instead of failing the request
+    if (!Transition::run(tft, from, next, type, durationMs) &&
+        !Transition::run(tft, from, next, TransitionType::Cut, 0)) {
+        s_screenImage = "";
+
+        return false;
+    }
+
+    s_screenImage = path;
+    s_screenImageX = xPos;
+    s_screenImageY = yPos;
+
+    return true;
+}
+
+/**
+ * @brief Decode time counters of the images drawn since boot (last 16 distinct paths)
+ *
+ * @return list of per asset counters
+ */
+auto DisplayManager::getImageStats() -> const std::vector<ImageDrawStats>& { return s_imageStats; }
+
+/**
+ * @brief Execute a display list in a single SPI transaction, then start its gif operations as viewports
+ *
+ * Whatever animates the screen is stopped first, without clearing: the list draws over the current content (the
+ * last frame of a stopped animation included), so a dashboard can redraw only the cards that changed
+ *
+ * @param list Display list, optimized by the caller
+ * @return false if the display is not ready or a gif viewport could not start
+ */
+auto DisplayManager::drawDisplayList(const DisplayList& list) -> bool {
+    if (!DisplayManager::isReady()) {
+        Logger::warn("Display not ready", "DisplayManager");
+
+        return false;
+    }
+
+    if (s_gif.isPlaying() || s_q565.isPlaying() || s_console.isActive() || s_compositor.isActive() ||
+        s_effects.isPlaying() || s_clock.isRunning()) {
+        DisplayManager::stopGif(false);
+    }
+
+    s_screenImage = "";
+
+    auto* tft = reinterpret_cast<Arduino_TFT*>(g_lcd);
+
+    tft->startWrite();
+    list.draw(tft);
+    tft->endWrite();
+
+    bool drawOk = true;
+
+    for (const DisplayOp& op : list.getOps()) {
+        if (op.type == DisplayOpType::Gif) {
+            drawOk = s_compositor.add(op.text, op.xPos, op.yPos, op.width, op.height) && drawOk;
+        }
+    }
+
+    return drawOk;
+}
+
+/**
+ * @brief Colour transform applied to indexed sources (GIF palettes)
+ *
+ * @return the shared ColorFx instance
+ */
+auto DisplayManager::getColorFx() -> ColorFx& { return s_colorFx; }
+
+/**
+ * @brief Global colour settings from the configuration
+ *
+ * @return the configured settings
+ */
+auto DisplayManager::getConfiguredColorFx() -> ColorFxSettings {
+    ColorFxSettings settings;
+
+    settings.brightness = configManager.getFxBrightness();
+    settings.temperature = configManager.getFxTemperature();
+    settings.greyscale = configManager.getFxGreyscale();
+
+    return settings;
+}
+
+/**
+ * @brief Reset the colour transform to the global display setting from the configuration
+ *
+ * @return void
+ */
+auto DisplayManager::applyColorFxSettings() -> void { s_colorFx.setSettings(getConfiguredColorFx()); }
+
+/**
+ * @brief Queue a screen change for the next update(), so the caller does not wait on SPI or flash
+ *
+ * @param command Command to queue, its id is assigned here and it is moved into the queue
+ * @return id to query with getCommandStatus(), 0 if the queue is full
+ */
+auto DisplayManager::queueCommand(DisplayCommand& command) -> uint32_t { return s_commands.push(command); }
+
+/**
+ * @brief Status of a queued command
+ *
+ * @param commandId Id returned by queueCommand()
+ * @return command status
+ */
+auto DisplayManager::getCommandStatus(uint32_t commandId) -> DisplayCommandStatus {
+    return s_commands.getStatus(commandId);
+}
+
+/**
+ * @brief Print text on the scrolled console, one console line per text line
+ *
+ * @param text Text to print, lines separated by '\n'
+ * @return true if every line was printed
+ */
+static auto printConsoleLines(const String& text) -> bool {
+    bool printOk = true;
+    int start = 0;
+
+    while (printOk && start <= static_cast<int>(text.length())) {
+        int end = text.indexOf('\n', start);
+        if (end < 0) {
+            end = static_cast<int>(text.length());
+        }
+
+        printOk = DisplayManager::consolePrint(text.substring(start, end));
+        start = end + 1;
+    }
+
+    return printOk;
+}
+
+/**
+ * @brief Replace the screen with the viewports described by the Gif operations of a list
+ *
+ * @param list List holding one Gif operation per viewport, empty to only stop the animations
+ * @return true if every viewport was added
+ */
+static auto setViewports(const DisplayList& list) -> bool {
+    bool addOk = true;
+
+    DisplayManager::stopGif();
+
+    for (const DisplayOp& op : list.getOps()) {
+        addOk = DisplayManager::addViewport(op.text, op.xPos, op.yPos, op.width, op.height) && addOk;
+    }
+
+    return addOk;
+}
+
+/**
+ * @brief Execute one queued command
+ *
+ * @param command Command to execute
+ * @return true if it succeeded
+ */
+static auto runCommand(const DisplayCommand& command) -> bool {
+    switch (command.type) {
+        case DisplayCommandType::PlayGif:
+            DisplayManager::applyColorFxSettings();
+            s_colorFx.clearFade();
+            if (command.hasFx) {
+                s_colorFx.setSettings(command.fx);
+            }
+            if (command.fadeFrames > 0) {
+                s_colorFx.startFade(command.fadeFrames, command.fadeToWhite, true);
+            }
+            return DisplayManager::playGifFullScreen(command.path);
+        case DisplayCommandType::StopGif:
+            return DisplayManager::stopGif();
+        case DisplayCommandType::PlayEffect:
+            return DisplayManager::playEffect(command.effect);
+        case DisplayCommandType::Fade:
+            s_colorFx.startFade(command.fadeFrames, command.fadeToWhite, false);
+            return true;
+        case DisplayCommandType::DrawImage:
+            if (command.transition != TransitionType::Cut) {
+                return DisplayManager::transitionToImage(command.path, command.xPos, command.yPos, command.transition,
+                                                         command.durationMs);
+            }
+            DisplayManager::stopGif();
+            return DisplayManager::drawImage(command.path, command.xPos, command.yPos);
+        case DisplayCommandType::ConsolePrint:
+            return printConsoleLines(command.text);
+        case DisplayCommandType::Clock:
+            if (command.enabled) {
+                return DisplayManager::showClock();
+            }
+            if (DisplayManager::isClockRunning()) {
+                DisplayManager::stopGif();
+            }
+            return true;
+        case DisplayCommandType::ApplyColorFx:
+            DisplayManager::applyColorFxSettings();
+            return true;
+        case DisplayCommandType::DrawList:
+            return DisplayManager::drawDisplayList(command.list);
+        case DisplayCommandType::SetViewports:
+            return setViewports(command.list);
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief Execute the queued commands in order until the queue is empty or the budget is spent
+ *
+ * @param budgetUs Time allowed, at least one command runs when one is queued
+ * @return void
+ */
+static auto runQueuedCommands(uint32_t budgetUs) -> void {
+    const uint32_t startUs = micros();
+    DisplayCommand command;
+
+    while ((micros() - startUs) < budgetUs && s_commands.pop(command)) {
+        const bool success = runCommand(command);
+        s_commands.complete(command.id, success);
+
+        if (!success) {
+            Logger::warn((String("Command ") + DisplayCommandQueue::typeName(command.type) + " " + String(command.id) +
+                          " failed")
+                             .c_str(),
+                         "DisplayManager");
+        }
+    }
+}
+
+/**
+ * @brief Whether screen changes are still waiting for update(), called from the main loop like update()
+ *
+ * @return true if a command is queued
+ */
+auto DisplayManager::hasQueuedCommands() -> bool { return !s_commands.empty(); }
+
+/**
+ * @brief Run the queued commands, then draw the frames that are due, within the budget given by the scheduler
+ *
+ * Commands run in the order they were queued and keep running until the budget is spent, whatever is left of it
+ * draws the frames; the players left out are released again on the next period
+ *
+ * @param budgetUs Time allowed for this call
+ * @return void
+ */
+auto DisplayManager::update(uint32_t budgetUs) -> void {
+    const uint32_t startUs = micros();
+
+    runQueuedCommands(budgetUs);
+
+    const auto budgetLeft = [startUs, budgetUs]() -> uint32_t {
+        const uint32_t usedUs = micros() - startUs;
+
+        return usedUs < budgetUs ? budgetUs - usedUs : 0;
+    };
+
+    if (budgetLeft() > 0) {
+        s_gif.update();
+    }
+    if (budgetLeft() > 0) {
+        s_q565.update();
+    }
+    if (budgetLeft() > 0) {
+        s_compositor.update(budgetLeft());
+    }
+    if (budgetLeft() > 0) {
+        s_effects.update();
+    }
+    if (budgetLeft() > 0) {
+        s_clock.update();
+    }
+}
+
+/**
+ * @brief Play a procedural effect full screen, replacing any animation
+ *
+ * @param type Effect to play
+ * @return true if the effect started
+ */
+auto DisplayManager::playEffect(EffectType type) -> bool {
+    if (!DisplayManager::isReady()) {
+        Logger::warn("Display not ready", "DisplayManager");
+
+        return false;
+    }
+
+    DisplayManager::stopGif();
+    s_gif.update();
+    s_q565.update();
+
+    return s_effects.play(type);
+}
+
+/**
+ * @brief Name and frame rate of the current or last effect
+ *
+ * @return effect stats
+ */
+auto DisplayManager::getEffectStats() -> EffectStats { return s_effects.getStats(); }
+
+/**
+ * @brief Replace the screen with the clock face, digits are redrawn only when they change
+ *
+ * @return true if the clock started
+ */
+auto DisplayManager::showClock() -> bool {
+    if (!DisplayManager::isReady()) {
+        Logger::warn("Display not ready", "DisplayManager");
+
+        return false;
+    }
+
+    DisplayManager::stopGif();
+    s_gif.update();
+    s_q565.update();
+
+    return s_clock.start();
+}
+
+/**
+ * @brief Check whether the clock face owns the screen
+ *
+ * @return true if the clock is running
+ */
+auto DisplayManager::isClockRunning() -> bool { return s_clock.isRunning(); }
+
+/**
+ * @brief Add an animation in a rectangle of the screen, played alongside the other viewports
+ *
+ * The first viewport stops the full screen player and clears the screen
+ *
+ * @param path GIF or Q565 file on LittleFS
+ * @param xPos Left position in pixels
+ * @param yPos Top position in pixels
+ * @param width Viewport width in pixels
+ * @param height Viewport height in pixels
+ * @return true if the animation started
+ */
+auto DisplayManager::addViewport(const String& path, int16_t xPos, int16_t yPos, int16_t width, int16_t height)
+    -> bool {
+    if (!DisplayManager::isReady()) {
+        Logger::warn("Display not ready", "DisplayManager");
+
+        return false;
+    }
+
+    if (!s_compositor.isActive()) {
+        DisplayManager::stopGif();
+        s_gif.update();
+        s_q565.update();
+    }
+
+    return s_compositor.add(path, xPos, yPos, width, height);
+}
+
+/**
+ * @brief Placement and frame rate of the animated viewports
+ *
+ * @return one entry per viewport
+ */
+auto DisplayManager::getViewportStats() -> std::vector<ViewportStats> { return s_compositor.getStats(); }
+
+/**
+ * @brief Write the VSCRDEF and VSCSAD registers from the current scroll state
+ *
+ * @return void
+ */
+static void lcdWriteScrollRegisters() {
+    const uint16_t top = g_scrollActive ? g_scrollTop : 0;
+    const uint16_t height = g_scrollActive ? g_scrollHeight : ST7789_GRAM_LINES;
+
+    g_lcdBus->beginWrite();
+
+    ST7789_WriteCommand(ST7789_SCROLL_DEFINITION);
+    g_lcdBus->write16(top);
+    g_lcdBus->write16(height);
+    g_lcdBus->write16(static_cast<uint16_t>(ST7789_GRAM_LINES - top - height));
+
+    ST7789_WriteCommand(ST7789_SCROLL_START);
+    g_lcdBus->write16(static_cast<uint16_t>(top + (g_scrollActive ? g_scrollOffset : 0)));
+
+    g_lcdBus->endWrite();
+}
+
+/**
+ * @brief Define a hardware vertical scroll region
+ *
+ * The ST7789 scrolls frame memory lines, which follow the logical rows only when the rotation does not swap
+ * axes (MADCTL MV). Rotations 0 and 4 (small tv, cube) map rows directly, 2 and 6 map them bottom up
+ *
+ * @param yPos First logical row of the region
+ * @param height Number of rows in the region
+ * @return true if the region was programmed, false for swapped rotations or invalid bounds
+ */
+auto DisplayManager::setScrollRegion(int16_t yPos, int16_t height) -> bool {
+    if (!DisplayManager::isReady()) {
+        return false;
+    }
+
+    const uint8_t rotation = g_lcd->getRotation();
+    const int16_t screenH = g_lcd->height();
+
+    if ((rotation & 1U) != 0) {
+        Logger::warn("Hardware scrolling needs a rotation without row/column exchange", "DisplayManager");
+
+        return false;
+    }
+
+    if (yPos < 0 || height <= 0 || yPos + height > screenH) {
+        return false;
+    }
+
+    g_scrollFlipped = rotation == 2 || rotation == 6;
+    g_scrollTop = static_cast<uint16_t>(g_scrollFlipped ? screenH - yPos - height : yPos);
+    g_scrollHeight = static_cast<uint16_t>(height);
+    g_scrollOffset = 0;
+    g_scrollActive = true;
+
+    lcdWriteScrollRegisters();
+
+    return true;
+}
+
+/**
+ * @brief Scroll the content of the region up by a number of lines
+ *
+ * Only VSCSAD is written: the lines leaving the top reappear at the bottom and are the only ones to redraw,
+ * see scrollLineToY()
+ *
+ * @param lines Lines to scroll, negative to scroll down
+ * @return void
+ */
+auto DisplayManager::scrollBy(int16_t lines) -> void {
+    if (!g_scrollActive || !DisplayManager::isReady()) {
+        return;
+    }
+
+    const int32_t height = g_scrollHeight;
+    int32_t step = lines % height;
+
+    if (g_scrollFlipped) {
+        step = -step;
+    }
+
+    g_scrollOffset = static_cast<uint16_t>((g_scrollOffset + step + height) % height);
+
+    lcdWriteScrollRegisters();
+}
+
+/**
+ * @brief Map a line of the scroll region to the logical row currently showing it
+ *
+ * @param line Line index from the visible top of the region (0 .. height - 1)
+ * @return logical y to draw at, -1 if no region is active
+ */
+auto DisplayManager::scrollLineToY(int16_t line) -> int16_t {
+    if (!g_scrollActive || g_lcd == nullptr || line < 0 || line >= static_cast<int16_t>(g_scrollHeight)) {
+        return -1;
+    }
+
+    const uint16_t displayLine = g_scrollFlipped ? static_cast<uint16_t>(g_scrollHeight - 1 - line) : line;
+    const auto memoryLine = static_cast<int16_t>(g_scrollTop + ((g_scrollOffset + displayLine) % g_scrollHeight));
+
+    return g_scrollFlipped ? static_cast<int16_t>(g_lcd->height() - 1 - memoryLine) : memoryLine;
+}
+
+/**
+ * @brief Disable the scroll region and show the frame memory unshifted
+ *
+ * @return void
+ */
+auto DisplayManager::resetScroll() -> void {
+    if (!g_scrollActive) {
+        return;
+    }
+
+    g_scrollActive = false;
+    g_scrollOffset = 0;
+    s_console.end();
+
+    if (DisplayManager::isReady()) {
+        lcdWriteScrollRegisters();
+    }
+}
+
+/**
+ * @brief Append a line to the on-screen console, opening it full screen if needed
+ *
+ * @param text Line to print, truncated to the screen width
+ * @return true if the line was printed
+ */
+auto DisplayManager::consolePrint(const String& text) -> bool {
+    if (!DisplayManager::isReady()) {
+        return false;
+    }
+
+    if (!s_console.isActive()) {
+        DisplayManager::stopGif();
+
+        if (!s_console.begin(g_lcd, 0, g_lcd->height())) {
+            return false;
+        }
+    }
+
+    s_console.println(text);
+
+    return true;
+}
 
 /**
  * @brief Clear the entire display to black
  *
+ * Any hardware scroll region (and the console using it) is reset first
+ *
  * @return void
  */
 auto DisplayManager::clearScreen() -> void {
+    DisplayManager::resetScroll();
+    s_screenImage = "";
+
     if (g_lcdReady && g_lcd != nullptr) {
         g_lcd->fillScreen(LCD_BLACK);
     }
@@ -0,0 +1,651 @@
+#include <Logger.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <new>
+
+#include "display/Effects.h"
+#include "display/DisplayManager.h"
+
+static constexpr uint32_t EFFECT_FRAME_MS = 33;
+static constexpr uint32_t EFFECT_MAX_STEP_MS = 100;
+static constexpr uint32_t EFFECT_FPS_WINDOW_MS = 2000;
+static constexpr int16_t EFFECT_SIZE = 240;
+static constexpr uint32_t FIXED_SHIFT = 16;
+
+// Plasma: LUT steps per millisecond in 16.16 for the x, y, diagonal and colour cycling phases
+static constexpr std::array<uint32_t, 4> PLASMA_SPEED = {0x0A3D, 0x07AE, 0x0CCC, 0x0520};
+static constexpr uint8_t PLASMA_X_FREQ = 2;
+static constexpr uint8_t PLASMA_Y_FREQ = 3;
+static constexpr uint8_t PLASMA_DIAG_FREQ = 1;
+
+// Fire: heat grid of 80x60 cells of 3x4 pixels, plus two hidden seed rows, cooling factor 0.94 in 16.16
+static constexpr uint8_t FIRE_COLS = 80;
+static constexpr uint8_t FIRE_ROWS = 60;
+static constexpr uint8_t FIRE_SEED_ROWS = 2;
+static constexpr uint8_t FIRE_CELL_W = 3;
+static constexpr uint8_t FIRE_CELL_SHIFT = 2;
+static constexpr uint32_t FIRE_COOLING = 61604;
+static constexpr uint8_t FIRE_SEED_HOT = 255;
+static constexpr uint8_t FIRE_SEED_COLD = 40;
+
+// Starfield: world coordinates in -1024..1023, depth in 8..255 (16.16), reciprocal LUT scaled by the focal length
+static constexpr size_t STAR_COUNT = 96;
+static constexpr int32_t STAR_WORLD = 1024;
+static constexpr uint32_t STAR_NEAR = 8;
+static constexpr uint32_t STAR_FAR = 255;
+static constexpr uint32_t STAR_FOCAL = 32;
+static constexpr uint32_t STAR_SPEED = 0x1999;
+static constexpr uint32_t STAR_BIG_DEPTH = 64;
+
+// Game of Life: 60x60 torus of 4x4 pixel cells
+static constexpr uint8_t LIFE_COLS = 60;
+static constexpr uint8_t LIFE_ROWS = 60;
+static constexpr uint8_t LIFE_CELL = 4;
+static constexpr size_t LIFE_GRID = static_cast<size_t>(LIFE_COLS) * LIFE_ROWS;
+static constexpr uint32_t LIFE_FRAME_MS = 80;
+static constexpr uint32_t LIFE_SEED_PERCENT = 30;
+static constexpr uint32_t LIFE_STAGNANT_CHANGES = 20;
+static constexpr uint32_t LIFE_STAGNANT_GENERATIONS = 150;
+static constexpr uint32_t LIFE_MAX_GENERATIONS = 2000;
+static constexpr uint16_t LIFE_ALIVE = 0x47E8;
+static constexpr uint16_t LIFE_DEAD = 0x0000;
+
+static constexpr std::array<const char*, Effects::EFFECT_COUNT> EFFECT_NAMES = {"plasma", "fire", "starfield", "life"};
+
+/**
+ * @brief Pack 8 bit channels into RGB565
+ *
+ * @param red Red 0..255
+ * @param green Green 0..255
+ * @param blue Blue 0..255
+ *
+ * @return RGB565 pixel
+ */
+static inline auto effectRgb565(uint32_t red, uint32_t green, uint32_t blue) -> uint16_t {
+    return static_cast<uint16_t>(((red & 0xF8) << 8) | ((green & 0xFC) << 3) | (blue >> 3));
+}
+
+/**
+ * @brief Clamp a channel value to 0..255
+ *
+ * @param value Channel value
+ *
+ * @return clamped value
+ */
+static inline auto effectClamp(int32_t value) -> uint32_t {
+    if (value < 0) {
+        return 0;
+    }
+
+    return value > 255 ? 255U : static_cast<uint32_t>(value);
+}
+
+/**
+ * @brief Construct a new Effects player
+ */
+Effects::Effects() = default;
+
+/**
+ * @brief Destroy the Effects player
+ */
+Effects::~Effects() = default;
+
+/**
+ * @brief Parse an effect name as used by the play API
+ *
+ * @param name Effect name (plasma, fire, starfield, life), case insensitive
+ * @param type Receives the effect on success
+ *
+ * @return false if the name is unknown
+ */
+auto Effects::parseType(const String& name, EffectType& type) -> bool {
+    for (uint8_t i = 0; i < EFFECT_COUNT; i++) {
+        if (name.equalsIgnoreCase(EFFECT_NAMES[i])) {
+            type = static_cast<EffectType>(i);
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Name of an effect
+ *
+ * @param type Effect
+ *
+ * @return lower case name
+ */
+auto Effects::typeName(EffectType type) -> const char* { return EFFECT_NAMES[static_cast<uint8_t>(type)]; }
+
+/**
+ * @brief xorshift32 generator, cheap enough for per cell noise
+ *
+ * @return next pseudo random value
+ */
+auto Effects::nextRandom() -> uint32_t {
+    m_rng ^= m_rng << 13;
+    m_rng ^= m_rng >> 17;
+    m_rng ^= m_rng << 5;
+
+    return m_rng;
+}
+
+/**
+ * @brief Fill the 256 entry sine LUT (-127..127), done once
+ *
+ * @return void
+ */
+auto Effects::buildSine() -> void {
+    if (m_sine[LUT_SIZE / 4] != 0) {
+        return;
+    }
+
+    for (size_t i = 0; i < LUT_SIZE; i++) {
+        m_sine[i] = static_cast<int8_t>(lroundf(127.0F * sinf(static_cast<float>(i) * 2.0F * PI / LUT_SIZE)));
+    }
+}
+
+/**
+ * @brief Fill the RGB565 colour LUT of the current effect
+ *
+ * @return void
+ */
+auto Effects::buildPalette() -> void {
+    for (size_t i = 0; i < LUT_SIZE; i++) {
+        const auto level = static_cast<int32_t>(i);
+
+        switch (m_type) {
+            case EffectType::Plasma:
+                m_palette[i] = effectRgb565(128 + m_sine[i], 128 + m_sine[(i + 85) & 0xFF], 128 + m_sine[(i + 170) & 0xFF]);
+                break;
+            case EffectType::Fire:
+                m_palette[i] = effectRgb565(effectClamp(level * 3), effectClamp(level * 3 - 255),
+                                            effectClamp(level * 3 - 510));
+                break;
+            default:
+                m_palette[i] = effectRgb565(i, i, i);
+                break;
+        }
+    }
+}
+
+/**
+ * @brief Start an effect, replacing the current one
+ *
+ * The screen is expected to be cleared by the caller
+ *
+ * @param type Effect to play
+ *
+ * @return false if the display is not ready or the effect state cannot be allocated
+ */
+auto Effects::play(EffectType type) -> bool {
+    if (!DisplayManager::isReady()) {
+        return false;
+    }
+
+    stop();
+
+    size_t stateSize = 0;
+
+    switch (type) {
+        case EffectType::Plasma:
+            stateSize = EFFECT_SIZE * sizeof(int16_t);
+            break;
+        case EffectType::Fire:
+            stateSize = static_cast<size_t>(FIRE_ROWS + FIRE_SEED_ROWS) * FIRE_COLS;
+            break;
+        case EffectType::Starfield:
+            stateSize = LUT_SIZE * sizeof(uint32_t) + STAR_COUNT * sizeof(Star);
+            break;
+        case EffectType::Life:
+            stateSize = 2 * LIFE_GRID + 2 * LIFE_ROWS;
+            break;
+    }
+
+    m_state.reset(new (std::nothrow) uint8_t[stateSize]);
+
+    if (!m_state) {
+        Logger::error((String("Not enough memory for effect ") + typeName(type)).c_str(), "Effects");
+
+        return false;
+    }
+
+    memset(m_state.get(), 0, stateSize);
+
+    m_tft = reinterpret_cast<Arduino_TFT*>(DisplayManager::getGfx());
+    m_type = type;
+    m_rng = micros() | 1U;
+    m_phase = {};
+    m_frames = 0;
+    m_generation = 0;
+    m_stagnantGenerations = 0;
+    m_fps = 0.0F;
+    m_frameMs = (type == EffectType::Life) ? LIFE_FRAME_MS : EFFECT_FRAME_MS;
+
+    buildSine();
+    buildPalette();
+
+    if (type == EffectType::Starfield) {
+        auto* recip = reinterpret_cast<uint32_t*>(m_state.get());
+        auto* stars = reinterpret_cast<Star*>(recip + LUT_SIZE);
+
+        for (uint32_t depth = 1; depth < LUT_SIZE; depth++) {
+            recip[depth] = (STAR_FOCAL << FIXED_SHIFT) / depth;
+        }
+
+        for (size_t i = 0; i < STAR_COUNT; i++) {
+            resetStar(stars[i], true);
+        }
+    } else if (type == EffectType::Life) {
+        seedLife();
+    }
+
+    m_lastFrameMs = millis() - m_frameMs;
+    m_windowStartMs = millis();
+    m_windowFrames = 0;
+    m_playing = true;
+
+    Logger::info((String("Playing effect ") + typeName(type)).c_str(), "Effects");
+
+    return true;
+}
+
+/**
+ * @brief Render the next frame when it is due
+ *
+ * @return true if a frame was drawn
+ */
+auto Effects::update() -> bool {
+    if (!m_playing) {
+        return false;
+    }
+
+    const uint32_t now = millis();
+    uint32_t elapsedMs = now - m_lastFrameMs;
+
+    if (elapsedMs < m_frameMs) {
+        return false;
+    }
+
+    if (elapsedMs > EFFECT_MAX_STEP_MS) {
+        elapsedMs = EFFECT_MAX_STEP_MS;
+    }
+
+    m_lastFrameMs = now;
+
+    m_tft->startWrite();
+
+    switch (m_type) {
+        case EffectType::Plasma:
+            renderPlasma(elapsedMs);
+            break;
+        case EffectType::Fire:
+            renderFire();
+            break;
+        case EffectType::Starfield:
+            renderStarfield(elapsedMs);
+            break;
+        case EffectType::Life:
+            renderLife();
+            break;
+    }
+
+    m_tft->endWrite();
+
+    m_frames++;
+    m_windowFrames++;
+
+    const uint32_t windowMs = millis() - m_windowStartMs;
+
+    if (windowMs >= EFFECT_FPS_WINDOW_MS) {
+        m_fps = static_cast<float>(m_windowFrames) * 1000.0F / static_cast<float>(windowMs);
+        m_windowFrames = 0;
+        m_windowStartMs = millis();
+    }
+
+    return true;
+}
+
+/**
+ * @brief Stop the effect and release its state
+ *
+ * @return void
+ */
+auto Effects::stop() -> void {
+    if (!m_playing) {
+        return;
+    }
+
+    Logger::info((String(typeName(m_type)) + ": " + String(m_frames) + " frames, " + String(m_fps, 1) + " fps").c_str(),
+                 "Effects");
+
+    m_playing = false;
+    m_state.reset();
+}
+
+/**
+ * @brief Check whether an effect is running
+ *
+ * @return true if playing
+ */
+auto Effects::isPlaying() const -> bool { return m_playing; }
+
+/**
+ * @brief Name and frame rate of the current (or last) effect
+ *
+ * @return effect stats, fps is averaged over the last two seconds
+ */
+auto Effects::getStats() const -> EffectStats {
+    EffectStats stats;
+
+    stats.name = typeName(m_type);
+    stats.playing = m_playing;
+    stats.frames = m_frames;
+    stats.fps = m_fps;
+
+    return stats;
+}
+
+/**
+ * @brief Plasma, sum of three sine waves looked up in the colour LUT
+ *
+ * The x wave is computed once per frame for the 240 columns, the diagonal one is advanced incrementally along the line
+ *
+ * @param elapsedMs Time since the previous frame
+ *
+ * @return void
+ */
+auto Effects::renderPlasma(uint32_t elapsedMs) -> void {
+    auto* columns = reinterpret_cast<int16_t*>(m_state.get());
+
+    for (size_t i = 0; i < m_phase.size(); i++) {
+        m_phase[i] += PLASMA_SPEED[i] * elapsedMs;
+    }
+
+    const auto phaseX = static_cast<uint8_t>(m_phase[0] >> FIXED_SHIFT);
+    const auto phaseY = static_cast<uint8_t>(m_phase[1] >> FIXED_SHIFT);
+    const auto phaseDiag = static_cast<uint8_t>(m_phase[2] >> FIXED_SHIFT);
+    const auto phaseColor = static_cast<uint8_t>(m_phase[3] >> FIXED_SHIFT);
+
+    for (int16_t col = 0; col < EFFECT_SIZE; col++) {
+        columns[col] = m_sine[static_cast<uint8_t>(col * PLASMA_X_FREQ + phaseX)];
+    }
+
+    m_tft->writeAddrWindow(0, 0, EFFECT_SIZE, EFFECT_SIZE);
+
+    for (int16_t row = 0; row < EFFECT_SIZE; row++) {
+        const int16_t rowWave = m_sine[static_cast<uint8_t>(row * PLASMA_Y_FREQ + phaseY)];
+        auto diag = static_cast<uint8_t>(row * PLASMA_DIAG_FREQ + phaseDiag);
+
+        for (int16_t col = 0; col < EFFECT_SIZE; col++) {
+            const int32_t sum = columns[col] + rowWave + m_sine[diag];
+
+            // -381..381 scaled to -126..126 (x 85 / 256)
+            m_lineBuf[col] = m_palette[static_cast<uint8_t>(((sum * 85) >> 8) + 128 + phaseColor)];
+            diag = static_cast<uint8_t>(diag + PLASMA_DIAG_FREQ);
+        }
+
+        m_tft->writePixels(m_lineBuf.data(), EFFECT_SIZE);
+    }
+}
+
+/**
+ * @brief Fire, each cell averages the heat below it and cools by a constant factor
+ *
+ * @return void
+ */
+auto Effects::renderFire() -> void {
+    uint8_t* heat = m_state.get();
+
+    for (uint8_t row = FIRE_ROWS; row < FIRE_ROWS + FIRE_SEED_ROWS; row++) {
+        uint8_t* seed = heat + static_cast<size_t>(row) * FIRE_COLS;
+
+        for (uint8_t col = 0; col < FIRE_COLS; col++) {
+            seed[col] = (nextRandom() & 1U) != 0 ? FIRE_SEED_HOT : FIRE_SEED_COLD;
+        }
+    }
+
+    for (uint8_t row = 0; row < FIRE_ROWS; row++) {
+        uint8_t* line = heat + static_cast<size_t>(row) * FIRE_COLS;
+        const uint8_t* below = line + FIRE_COLS;
+        const uint8_t* below2 = below + FIRE_COLS;
+
+        for (uint8_t col = 0; col < FIRE_COLS; col++) {
+            const uint8_t left = (col == 0) ? 0 : col - 1;
+            const uint8_t right = (col == FIRE_COLS - 1) ? col : col + 1;
+            const uint32_t sum = below[left] + below[col] + below[right] + below2[col];
+
+            // Average of four (>> 2) times the cooling factor (>> 16)
+            line[col] = static_cast<uint8_t>((sum * FIRE_COOLING) >> (FIXED_SHIFT + 2));
+        }
+    }
+
+    m_tft->writeAddrWindow(0, 0, EFFECT_SIZE, EFFECT_SIZE);
+
+    for (int16_t row = 0; row < EFFECT_SIZE; row++) {
+        if ((row & ((1 << FIRE_CELL_SHIFT) - 1)) == 0) {
+            const uint8_t* line = heat + static_cast<size_t>(row >> FIRE_CELL_SHIFT) * FIRE_COLS;
+            uint16_t* out = m_lineBuf.data();
+
+            for (uint8_t col = 0; col < FIRE_COLS; col++) {
+                const uint16_t color = m_palette[line[col]];
+
+                for (uint8_t i = 0; i < FIRE_CELL_W; i++) {
+                    *out++ = color;
+                }
+            }
+        }
+
+        m_tft->writePixels(m_lineBuf.data(), EFFECT_SIZE);
+    }
+}
+
+/**
+ * @brief Place a star at a random position, far away unless anyDepth is set
+ *
+ * @param star Star to reset
+ * @param anyDepth true to pick a random depth (initial spread)
+ *
+ * @return void
+ */
+auto Effects::resetStar(Star& star, bool anyDepth) -> void {
+    star.xPos = static_cast<int16_t>(static_cast<int32_t>(nextRandom() % (2 * STAR_WORLD)) - STAR_WORLD);
+    star.yPos = static_cast<int16_t>(static_cast<int32_t>(nextRandom() % (2 * STAR_WORLD)) - STAR_WORLD);
+
+    const uint32_t depth = anyDepth ? STAR_NEAR + nextRandom() % (STAR_FAR - STAR_NEAR) : STAR_FAR;
+
+    star.depth = depth << FIXED_SHIFT;
+    star.screenX = -1;
+    star.screenY = -1;
+    star.size = 0;
+}
+
+/**
+ * @brief Starfield, only the pixels of the stars are rewritten (erase at the old position, draw at the new one)
+ *
+ * @param elapsedMs Time since the previous frame
+ *
+ * @return void
+ */
+auto Effects::renderStarfield(uint32_t elapsedMs) -> void {
+    const auto* recip = reinterpret_cast<const uint32_t*>(m_state.get());
+    auto* stars = reinterpret_cast<Star*>(m_state.get() + LUT_SIZE * sizeof(uint32_t));
+    const uint32_t step = STAR_SPEED * elapsedMs;
+    constexpr int16_t center = EFFECT_SIZE / 2;
+
+    for (size_t i = 0; i < STAR_COUNT; i++) {
+        Star& star = stars[i];
+
+        if (star.size > 0) {
+            m_lineBuf.fill(LCD_BLACK);
+            m_tft->writeAddrWindow(star.screenX, star.screenY, star.size, star.size);
+            m_tft->writePixels(m_lineBuf.data(), static_cast<uint32_t>(star.size) * star.size);
+        }
+
+        star.depth = (star.depth > step + (STAR_NEAR << FIXED_SHIFT)) ? star.depth - step : 0;
+
+        if (star.depth == 0) {
+            resetStar(star, false);
+        }
+
+        const uint32_t depth = star.depth >> FIXED_SHIFT;
+        const uint8_t size = (depth < STAR_BIG_DEPTH) ? 2 : 1;
+        const auto screenX = static_cast<int16_t>(center + ((star.xPos * static_cast<int32_t>(recip[depth])) >> FIXED_SHIFT));
+        const auto screenY = static_cast<int16_t>(center + ((star.yPos * static_cast<int32_t>(recip[depth])) >> FIXED_SHIFT));
+
+        if (screenX < 0 || screenY < 0 || screenX > EFFECT_SIZE - size || screenY > EFFECT_SIZE - size) {
+            resetStar(star, false);
+
+            continue;
+        }
+
+        star.screenX = screenX;
+        star.screenY = screenY;
+        star.size = size;
+
+        m_lineBuf.fill(m_palette[STAR_FAR - depth]);
+        m_tft->writeAddrWindow(screenX, screenY, size, size);
+        m_tft->writePixels(m_lineBuf.data(), static_cast<uint32_t>(size) * size);
+    }
+}
+
+/**
+ * @brief Fill the Game of Life grid with random cells, drawn whole by the next frame
+ *
+ * @return void
+ */
+auto Effects::seedLife() -> void {
+    uint8_t* cells = m_state.get();
+
+    for (size_t i = 0; i < LIFE_GRID; i++) {
+        cells[i] = (nextRandom() % 100) < LIFE_SEED_PERCENT ? 1 : 0;
+    }
+
+    m_generation = 0;
+    m_stagnantGenerations = 0;
+}
+
+/**
+ * @brief Draw a run of cells of one grid row in a single address window
+ *
+ * Cells are 3x3 pixels with a one pixel dead border so the grid stays readable
+ *
+ * @param row Grid row
+ * @param firstCol First cell of the run
+ * @param endCol Cell after the last one
+ * @param cells Cells of the row
+ *
+ * @return void
+ */
+auto Effects::drawLifeRun(uint8_t row, uint8_t firstCol, uint8_t endCol, const uint8_t* cells) -> void {
+    const auto width = static_cast<uint16_t>((endCol - firstCol) * LIFE_CELL);
+    uint16_t* out = m_lineBuf.data();
+
+    for (uint8_t col = firstCol; col < endCol; col++) {
+        const uint16_t color = cells[col] != 0 ? LIFE_ALIVE : LIFE_DEAD;
+
+        for (uint8_t i = 0; i < LIFE_CELL - 1; i++) {
+            *out++ = color;
+        }
+
+        *out++ = LIFE_DEAD;
+    }
+
+    m_tft->writeAddrWindow(static_cast<int16_t>(firstCol * LIFE_CELL), static_cast<int16_t>(row * LIFE_CELL), width,
+                           LIFE_CELL);
+
+    for (uint8_t i = 0; i < LIFE_CELL - 1; i++) {
+        m_tft->writePixels(m_lineBuf.data(), width);
+    }
+
+    std::fill(m_lineBuf.begin(), m_lineBuf.begin() + width, LIFE_DEAD);
+    m_tft->writePixels(m_lineBuf.data(), width);
+}
+
+/**
+ * @brief Game of Life generation on a torus with per row dirty tracking
+ *
+ * A row can only change when it or one of its neighbours changed in the previous generation, other rows are copied.
+ * Only the cells that flipped are redrawn, grouped in runs. The grid is reseeded when it dies out or settles
+ *
+ * @return void
+ */
+auto Effects::renderLife() -> void {
+    uint8_t* grids = m_state.get();
+    uint8_t* changedRows = grids + 2 * LIFE_GRID;
+    const size_t current = m_generation & 1U;
+    uint8_t* cur = grids + current * LIFE_GRID;
+    uint8_t* next = grids + (current ^ 1U) * LIFE_GRID;
+    uint8_t* curChanged = changedRows + current * LIFE_ROWS;
+    uint8_t* nextChanged = changedRows + (current ^ 1U) * LIFE_ROWS;
+
+    if (m_generation == 0) {
+        for (uint8_t row = 0; row < LIFE_ROWS; row++) {
+            drawLifeRun(row, 0, LIFE_COLS, cur + static_cast<size_t>(row) * LIFE_COLS);
+            nextChanged[row] = 1;
+        }
+
+        // The seed is what generation 1 reads, every row counts as changed
+        memcpy(next, cur, LIFE_GRID);
+        m_generation++;
+
+        return;
+    }
+
+    uint32_t changes = 0;
+
+    for (uint8_t row = 0; row < LIFE_ROWS; row++) {
+        const uint8_t up = (row == 0) ? LIFE_ROWS - 1 : row - 1;
+        const uint8_t down = (row == LIFE_ROWS - 1) ? 0 : row + 1;
+        const uint8_t* rowCur = cur + static_cast<size_t>(row) * LIFE_COLS;
+        uint8_t* rowNext = next + static_cast<size_t>(row) * LIFE_COLS;
+
+        nextChanged[row] = 0;
+
+        if ((curChanged[up] | curChanged[row] | curChanged[down]) == 0) {
+            memcpy(rowNext, rowCur, LIFE_COLS);
+
+            continue;
+        }
+
+        const uint8_t* rowUp = cur + static_cast<size_t>(up) * LIFE_COLS;
+        const uint8_t* rowDown = cur + static_cast<size_t>(down) * LIFE_COLS;
+        int16_t runStart = -1;
+
+        for (uint8_t col = 0; col <= LIFE_COLS; col++) {
+            bool flipped = false;
+
+            if (col < LIFE_COLS) {
+                const uint8_t left = (col == 0) ? LIFE_COLS - 1 : col - 1;
+                const uint8_t right = (col == LIFE_COLS - 1) ? 0 : col + 1;
+                const uint8_t neighbours = rowUp[left] + rowUp[col] + rowUp[right] + rowCur[left] + rowCur[right] +
+                                           rowDown[left] + rowDown[col] + rowDown[right];
+
+                rowNext[col] = (neighbours == 3 || (neighbours == 2 && rowCur[col] != 0)) ? 1 : 0;
+                flipped = rowNext[col] != rowCur[col];
+            }
+
+            if (flipped) {
+                changes++;
+                nextChanged[row] = 1;
+
+                if (runStart < 0) {
+                    runStart = col;
+                }
+            } else if (runStart >= 0) {
+                drawLifeRun(row, static_cast<uint8_t>(runStart), col, rowNext);
+                runStart = -1;
+            }
+        }
+    }
+
+    m_generation++;
+    m_stagnantGenerations = (changes < LIFE_STAGNANT_CHANGES) ? m_stagnantGenerations + 1 : 0;
+
+    if (m_stagnantGenerations >= LIFE_STAGNANT_GENERATIONS || m_generation >= LIFE_MAX_GENERATIONS) {
+        seedLife();
+    }
+}
@@ -1,49 +1,169 @@
 #include "display/Gif.h"
 #include "display/DisplayManager.h"
+#include "display/ColorFx.h"
 #include <Arduino_GFX_Library.h>
+#include <Logger.h>
+#include <algorithm>
 #include <array>
+#include <new>
 static constexpr uint32_t GIF_MAX_MS_PER_FILE = 20000U;
 static constexpr uint8_t GIF_TARGET_FPS = 30U;
 static constexpr uint32_t GIF_FRAME_MS = 1000U / GIF_TARGET_FPS;
 
-Gif* Gif::s_instance = nullptr;
+/**
+ * @brief File opened by the decoder for one player
+ *
+ * gifFile is the decoder side state handed to the read/seek callbacks, resumePos replaces the rewind the decoder does
+ * at the end of open(). Both are only read through decoderNextFrame() and resumeOffset()
+ */
+struct GifFileHandle {
+    File file;
+    Gif* owner = nullptr;
+    GIFFILE* gifFile = nullptr;
+    int32_t resumePos = 0;
+};
+
+/*
+ * AnimatedGIF (2.2.x, see platformio.ini) cannot reopen a file at a given frame, resuming a player leans on two of
+ * its internals, used by the two helpers below and nowhere else:
+ *  - once playFrame() returns, GIFFILE::iPos is the offset of the block following the decoded frame
+ *  - open() ends by seeking back to offset 0, after it read the header and the global palette
+ * A saved offset that does not start a GIF block means a library update changed this, the player then starts over
+ * from the first frame instead of decoding garbage
+ */
+static constexpr uint8_t GIF_EXTENSION_INTRODUCER = 0x21U;
+static constexpr uint8_t GIF_IMAGE_SEPARATOR = 0x2CU;
+static constexpr uint8_t GIF_TRAILER = 0x3BU;
 
 /**
- * @brief Construct a new Gif:: Gif object
+ * @brief Offset of the frame the decoder plays next, 0 when unknown
+ *
+ * @param handle File opened for the player
+ * @return int32_t File offset
  */
-Gif::Gif() : m_gif(nullptr), m_playRequested(false), m_playing(false), m_loopEnabled(false), m_stopRequested(false) {
-    s_instance = this;
+static auto decoderNextFrame(const GifFileHandle* handle) -> int32_t {
+    return (handle != nullptr && handle->gifFile != nullptr) ? handle->gifFile->iPos : 0;
 }
 
+/**
+ * @brief Where the rewind ending open() should land: the saved frame offset once, if it still starts a GIF block
+ *
+ * @param handle File opened for the player
+ * @return int32_t File offset, 0 to start from the first frame
+ */
+static auto resumeOffset(GifFileHandle* handle) -> int32_t {
+    const int32_t offset = handle->resumePos;
+    uint8_t introducer = 0;
+
+    handle->resumePos = 0;
+
+    if (offset <= 0 || !handle->file.seek(static_cast<uint32_t>(offset), SeekSet) ||
+        handle->file.read(&introducer, 1) != 1) {
+        return 0;
+    }
+
+    if (introducer != GIF_EXTENSION_INTRODUCER && introducer != GIF_IMAGE_SEPARATOR && introducer != GIF_TRAILER) {
+        Logger::warn("Saved frame offset is not a GIF block, restarting the animation", "Gif");
+
+        return 0;
+    }
+
+    return offset;
+}
+
+// One decoder for every player, see Gif
+static AnimatedGIF* s_decoder = nullptr;
+static Gif* s_decoderOwner = nullptr;
+static Gif* s_opening = nullptr;
+
+/**
+ * @brief Construct a new Gif:: Gif object
+ */
+Gif::Gif() : m_gif(nullptr), m_playRequested(false), m_playing(false), m_loopEnabled(false), m_stopRequested(false) {}
+
 /**
  * @brief Destroy the Gif:: Gif object
  */
 Gif::~Gif() {
     stop();
-
-    if (m_gif != nullptr) {
-        delete m_gif;
-        m_gif = nullptr;
-    }
+    closeDecoder();
 }
 
 /**
- * @brief Initialize the Gif object
+ * @brief Initialize the Gif object, allocating the shared decoder on first use
  *
  * @return true if initialization was successful false otherwise
  */
 auto Gif::begin() -> bool {
-    if (m_gif == nullptr) {
-        m_gif = new AnimatedGIF();
+    if (s_decoder == nullptr) {
+        s_decoder = new (std::nothrow) AnimatedGIF();
 
-        if (m_gif == nullptr) {
+        if (s_decoder == nullptr) {
             return false;
         }
     }
 
+    m_gif = s_decoder;
+
     return true;
 }
 
+/**
+ * @brief Open the current file on the shared decoder, taking it from its previous owner
+ *
+ * @param resumePos File offset of the next frame to decode, 0 to start from the beginning
+ *
+ * @return true if the file was opened
+ */
+auto Gif::openDecoder(int32_t resumePos) -> bool {
+    if (s_decoderOwner != nullptr && s_decoderOwner != this) {
+        s_decoderOwner->suspend();
+    }
+
+    closeDecoder();
+
+    m_gif->begin(GIF_PALETTE_RGB565_LE);
+    m_resumePos = resumePos;
+    s_opening = this;
+
+    const int opened = m_gif->open(m_currentPath.c_str(), gifOpenFile, gifCloseFile, gifReadFile, gifSeekFile, gifDraw);
+
+    s_opening = nullptr;
+
+    if (opened <= 0) {
+        return false;
+    }
+
+    s_decoderOwner = this;
+
+    return true;
+}
+
+/**
+ * @brief Close the file if this player owns the decoder
+ *
+ * @return void
+ */
+auto Gif::closeDecoder() -> void {
+    if (s_decoderOwner != this) {
+        return;
+    }
+
+    m_gif->close();
+    s_decoderOwner = nullptr;
+}
+
+/**
+ * @brief Give the decoder away, remembering where the next frame starts
+ *
+ * @return void
+ */
+auto Gif::suspend() -> void {
+    m_resumePos = decoderNextFrame(m_fileHandle);
+
+    closeDecoder();
+}
+
 /**
  * @brief Open a GIF file from LittleFS
  *
@@ -59,23 +179,29 @@ auto Gif::gifOpenFile(const char* fname, int32_t* pSize) -> void* {
         path = "/" + path;
     }
 
-    auto* filePtr = new File();
+    auto* handle = new (std::nothrow) GifFileHandle();
 
-    if (filePtr == nullptr) {
+    if (handle == nullptr) {
         return nullptr;
     }
 
-    *filePtr = LittleFS.open(path, "r");
+    handle->file = LittleFS.open(path, "r");
 
-    if (!(*filePtr)) {
-        delete filePtr;
+    if (!handle->file) {
+        delete handle;
 
         return nullptr;
     }
 
-    *pSize = static_cast<int32_t>(filePtr->size());
+    if (s_opening != nullptr) {
+        handle->owner = s_opening;
+        handle->resumePos = s_opening->m_resumePos;
+        s_opening->m_fileHandle = handle;
+    }
+
+    *pSize = static_cast<int32_t>(handle->file.size());
 
-    return reinterpret_cast<void*>(filePtr);
+    return reinterpret_cast<void*>(handle);
 }
 
 /**
@@ -84,17 +210,21 @@ auto Gif::gifOpenFile(const char* fname, int32_t* pSize) -> void* {
  * @param pHandle Handle to the file to close
  */
 auto Gif::gifCloseFile(void* pHandle) -> void {
-    auto* filePtr = reinterpret_cast<File*>(pHandle);
+    auto* handle = reinterpret_cast<GifFileHandle*>(pHandle);
 
-    if (filePtr == nullptr) {
+    if (handle == nullptr) {
         return;
     }
 
-    if (*filePtr) {
-        filePtr->close();
+    if (handle->file) {
+        handle->file.close();
     }
 
-    delete filePtr;
+    if (handle->owner != nullptr && handle->owner->m_fileHandle == handle) {
+        handle->owner->m_fileHandle = nullptr;
+    }
+
+    delete handle;
 }
 
 /**
@@ -106,12 +236,14 @@ auto Gif::gifCloseFile(void* pHandle) -> void {
  * @return int32_t Number of bytes read
  */
 auto Gif::gifReadFile(GIFFILE* pFile, uint8_t* pBuf, int32_t iLen) -> int32_t {
-    auto* filePtr = reinterpret_cast<File*>(pFile->fHandle);
+    auto* handle = reinterpret_cast<GifFileHandle*>(pFile->fHandle);
 
-    if (filePtr == nullptr || !(*filePtr)) {
+    if (handle == nullptr || !handle->file) {
         return 0;
     }
 
+    handle->gifFile = pFile;
+
     int32_t bytesToRead = iLen;
     const int32_t remaining = pFile->iSize - pFile->iPos;
 
@@ -123,7 +255,7 @@ auto Gif::gifReadFile(GIFFILE* pFile, uint8_t* pBuf, int32_t iLen) -> int32_t {
         return 0;
     }
 
-    const auto bytesRead = static_cast<int32_t>(filePtr->read(pBuf, static_cast<size_t>(bytesToRead)));
+    const auto bytesRead = static_cast<int32_t>(handle->file.read(pBuf, static_cast<size_t>(bytesToRead)));
 
     if (bytesRead > 0) {
         pFile->iPos += bytesRead;
@@ -135,17 +267,25 @@ auto Gif::gifReadFile(GIFFILE* pFile, uint8_t* pBuf, int32_t iLen) -> int32_t {
 /**
  * @brief Seek to a position in the GIF file
  *
+ * The first rewind of a resumed player (the one ending open()) lands on the saved frame offset instead
+ *
  * @param pFile Pointer to the GIFFILE structure
  * @param iPosition Position to seek to
  * @return int32_t New position after seeking
  */
 auto Gif::gifSeekFile(GIFFILE* pFile, int32_t iPosition) -> int32_t {
-    auto* filePtr = reinterpret_cast<File*>(pFile->fHandle);
+    auto* handle = reinterpret_cast<GifFileHandle*>(pFile->fHandle);
 
-    if (filePtr == nullptr || !(*filePtr)) {
+    if (handle == nullptr || !handle->file) {
         return 0;
     }
 
+    handle->gifFile = pFile;
+
+    if (iPosition == 0 && handle->resumePos > 0) {
+        iPosition = resumeOffset(handle);
+    }
+
     if (iPosition < 0) {
         iPosition = 0;
     }
@@ -154,7 +294,7 @@ auto Gif::gifSeekFile(GIFFILE* pFile, int32_t iPosition) -> int32_t {
     }
 
     pFile->iPos = iPosition;
-    (void)filePtr->seek(static_cast<uint32_t>(iPosition), SeekSet);
+    (void)handle->file.seek(static_cast<uint32_t>(iPosition), SeekSet);
 
     return iPosition;
 }
@@ -162,13 +302,14 @@ auto Gif::gifSeekFile(GIFFILE* pFile, int32_t iPosition) -> int32_t {
 /**
  * @brief Draw a frame of the GIF
  *
- * @note need to be refactored
+ * pDraw->pUser is the player passed to playFrame(), lines are clipped to its viewport
  *
  * @param pDraw Pointer to the GIFDRAW structure
  */
-auto Gif::gifDraw(GIFDRAW* pDraw) -> void  // NOLINT(readability-function-cognitive-complexity)
-{
-    if (!DisplayManager::isReady()) {
+auto Gif::gifDraw(GIFDRAW* pDraw) -> void {
+    auto* self = static_cast<Gif*>(pDraw->pUser);
+
+    if (self == nullptr || !DisplayManager::isReady()) {
         return;
     }
 
@@ -180,65 +321,122 @@ auto Gif::gifDraw(GIFDRAW* pDraw) -> void  // NOLINT(readability-function-cognit
     auto* tft = reinterpret_cast<Arduino_TFT*>(gfx);
     if (pDraw->y == 0) {
         tft->startWrite();
-
-        if (s_instance != nullptr) {
-            s_instance->m_inFrameWrite = true;
-        }
+        self->m_inFrameWrite = true;
     }
 
     const auto* palette565 = reinterpret_cast<const uint16_t*>(pDraw->pPalette);
-    const auto* src = pDraw->pPixels;
 
-    const auto rawY = static_cast<int>(pDraw->iY + pDraw->y);
-    const auto rawX = static_cast<int>(pDraw->iX);
-    const auto width = static_cast<int>(pDraw->iWidth);
+    // Colour effects run on the palette once per frame, lines then index the transformed copy
+    if (pDraw->y == 0 && self->m_fxFrame) {
+        DisplayManager::getColorFx().applyPalette(palette565, self->m_fxPalette.data(), self->m_fxPalette.size());
+    }
+
+    if (self->m_fxFrame) {
+        palette565 = self->m_fxPalette.data();
+    }
 
-    if (pDraw->y == 0 && s_instance != nullptr) {
-        if (!s_instance->m_centered) {
-            const auto screenW = static_cast<int>(gfx->width());
-            const auto screenH = static_cast<int>(gfx->height());
-            const auto gifW = static_cast<int>(pDraw->iWidth);
-            const auto gifH = static_cast<int>(pDraw->iHeight);
+    if (pDraw->y == 0) {
+        self->m_curDisposal = pDraw->ucDisposalMethod;
+        self->m_curHadTransparency = (pDraw->ucHasTransparency != 0);
+        self->m_curX = static_cast<int16_t>(pDraw->iX + self->m_offsetX);
+        self->m_curY = static_cast<int16_t>(pDraw->iY + self->m_offsetY);
+        self->m_curW = static_cast<int16_t>(pDraw->iWidth);
+        self->m_curH = static_cast<int16_t>(pDraw->iHeight);
+        self->m_curBg = LCD_BLACK;
+    }
+
+    const auto xPos = static_cast<int>(pDraw->iX + self->m_offsetX);
+    const auto yPos = static_cast<int>(pDraw->iY + pDraw->y + self->m_offsetY);
+
+    // Viewport clipped to the screen
+    const auto screenW = static_cast<int>(gfx->width());
+    const auto screenH = static_cast<int>(gfx->height());
+    const int viewLeft = self->m_viewX < 0 ? 0 : self->m_viewX;
+    const int viewTop = self->m_viewY < 0 ? 0 : self->m_viewY;
+    const int viewRight = (self->m_viewX + self->m_viewW) > screenW ? screenW : (self->m_viewX + self->m_viewW);
+    const int viewBottom = (self->m_viewY + self->m_viewH) > screenH ? screenH : (self->m_viewY + self->m_viewH);
+
+    // A frame covering the whole canvas repaints everything with the current colours, a partial one only its
+    // rectangle: after a colour change the first frame is drawn over a canvas cleared to the transformed background
+    if (pDraw->y == 0) {
+        const bool fullFrame = pDraw->iX == 0 && pDraw->iY == 0 && pDraw->iWidth == self->m_gif->getCanvasWidth() &&
+                               pDraw->iHeight == self->m_gif->getCanvasHeight() && pDraw->ucHasTransparency == 0;
+
+        if (!fullFrame) {
+            self->m_partialFrames = true;
+        }
 
-            const auto centerX = static_cast<int>((screenW - gifW) / 2);
-            const auto centerY = static_cast<int>((screenH - gifH) / 2);
+        if (self->m_repaint && !fullFrame) {
+            const int left = std::max(static_cast<int>(self->m_offsetX), viewLeft);
+            const int top = std::max(static_cast<int>(self->m_offsetY), viewTop);
+            const int right = std::min(self->m_offsetX + self->m_gif->getCanvasWidth(), viewRight);
+            const int bottom = std::min(self->m_offsetY + self->m_gif->getCanvasHeight(), viewBottom);
+            const uint16_t background = self->m_fxFrame ? DisplayManager::getColorFx().apply(LCD_BLACK) : LCD_BLACK;
 
-            s_instance->m_offsetX = static_cast<int16_t>(centerX - static_cast<int>(pDraw->iX));
-            s_instance->m_offsetY = static_cast<int16_t>(centerY - static_cast<int>(pDraw->iY));
-            s_instance->m_centered = true;
+            if (right > left && bottom > top) {
+                tft->writeFillRect(static_cast<int16_t>(left), static_cast<int16_t>(top),
+                                   static_cast<int16_t>(right - left), static_cast<int16_t>(bottom - top), background);
+            }
         }
 
-        s_instance->m_curDisposal = pDraw->ucDisposalMethod;
-        s_instance->m_curHadTransparency = (pDraw->ucHasTransparency != 0);
-        s_instance->m_curX = static_cast<int16_t>(pDraw->iX + s_instance->m_offsetX);
-        s_instance->m_curY = static_cast<int16_t>(pDraw->iY + s_instance->m_offsetY);
-        s_instance->m_curW = static_cast<int16_t>(pDraw->iWidth);
-        s_instance->m_curH = static_cast<int16_t>(pDraw->iHeight);
-        s_instance->m_curBg = LCD_BLACK;
+        self->m_repaint = false;
     }
 
-    const auto xPos = static_cast<int>(rawX + (s_instance != nullptr ? s_instance->m_offsetX : 0));
-    const auto yPos = static_cast<int>(rawY + (s_instance != nullptr ? s_instance->m_offsetY : 0));
+    if (yPos >= viewTop && yPos < viewBottom) {
+        self->drawLine(pDraw, tft, palette565, xPos, yPos, viewLeft, viewRight);
+    }
 
-    if (yPos < 0 || yPos >= static_cast<int>(gfx->height())) {
-        return;
+    const bool endOfFrame = (pDraw->y == static_cast<int>(pDraw->iHeight - 1));
+
+    if (endOfFrame) {
+        if (self->m_inFrameWrite) {
+            tft->endWrite();
+            self->m_inFrameWrite = false;
+        }
+
+        self->m_havePrev = true;
+        self->m_prevDisposal = self->m_curDisposal;
+        self->m_prevHadTransparency = self->m_curHadTransparency;
+        self->m_prevX = self->m_curX;
+        self->m_prevY = self->m_curY;
+        self->m_prevW = self->m_curW;
+        self->m_prevH = self->m_curH;
+        self->m_prevBg = self->m_curBg;
     }
+}
+
+/**
+ * @brief Output one decoded line, restoring the background of the previous frame where its disposal requires it
+ *
+ * @note need to be refactored
+ *
+ * @param pDraw Pointer to the GIFDRAW structure
+ * @param tft Panel
+ * @param palette565 Palette of the frame (after colour effects)
+ * @param xPos Screen column of the first pixel of the line
+ * @param yPos Screen row of the line, inside the viewport
+ * @param viewLeft First visible column of the viewport
+ * @param viewRight Column after the last visible one
+ */
+auto Gif::drawLine(GIFDRAW* pDraw, Arduino_TFT* tft, const uint16_t* palette565, int xPos, int yPos, int viewLeft,
+                   int viewRight) -> void  // NOLINT(readability-function-cognitive-complexity)
+{
+    const auto* src = pDraw->pPixels;
+    const auto width = static_cast<int>(pDraw->iWidth);
 
-    std::array<uint16_t, LINEBUF_MAX> localLineBuf{};
-    std::array<uint16_t, LINEBUF_MAX>* pLineBuf = (s_instance != nullptr) ? &s_instance->m_lineBuf : &localLineBuf;
-    auto& lineBuf = *pLineBuf;
+    auto& lineBuf = m_lineBuf;
     const auto maxW = static_cast<int>(lineBuf.size());
     const auto drawW = (width > maxW) ? maxW : width;
 
     int visStart = 0;
     int visEnd = drawW;
 
-    if (xPos < 0) {
-        visStart = -xPos;
+    if (xPos < viewLeft) {
+        visStart = viewLeft - xPos;
     }
 
-    if (xPos + visEnd > static_cast<int>(gfx->width())) {
-        visEnd = static_cast<int>(gfx->width() - xPos);
+    if (xPos + visEnd > viewRight) {
+        visEnd = viewRight - xPos;
     }
 
     if (visEnd <= visStart) {
@@ -248,168 +446,188 @@ auto Gif::gifDraw(GIFDRAW* pDraw) -> void  // NOLINT(readability-function-cognit
     const auto curStart = static_cast<int>(xPos + visStart);
     const auto curEnd = static_cast<int>(xPos + visEnd);
 
-    const auto screenW = static_cast<int>(gfx->width());
     bool skipDraw = false;
 
     if (width <= 0) {
         skipDraw = true;
     }
-    if (xPos >= screenW || (xPos + drawW) <= 0) {
+    if (xPos >= viewRight || (xPos + drawW) <= viewLeft) {
         skipDraw = true;
     }
 
-    const bool endOfFrame = (pDraw->y == static_cast<int>(pDraw->iHeight - 1));
-
     bool needClearLine = false;
     int clearStart = 0;
     int clearEnd = 0;
 
-    if (s_instance != nullptr && s_instance->m_havePrev &&
-        (s_instance->m_prevDisposal == 2 || s_instance->m_prevHadTransparency)) {
-        const auto prevTop = s_instance->m_prevY;
-        const auto prevBot =
-            static_cast<int>(static_cast<int32_t>(s_instance->m_prevY) + static_cast<int32_t>(s_instance->m_prevH) - 1);
+    if (m_havePrev && (m_prevDisposal == 2 || m_prevHadTransparency)) {
+        const auto prevTop = m_prevY;
+        const auto prevBot = static_cast<int>(static_cast<int32_t>(m_prevY) + static_cast<int32_t>(m_prevH) - 1);
 
         if (yPos >= prevTop && yPos <= prevBot) {
             needClearLine = true;
-            clearStart = s_instance->m_prevX;
-            clearEnd =
-                static_cast<int>(static_cast<int32_t>(s_instance->m_prevX) + static_cast<int32_t>(s_instance->m_prevW));
+            clearStart = m_prevX;
+            clearEnd = static_cast<int>(static_cast<int32_t>(m_prevX) + static_cast<int32_t>(m_prevW));
         }
     }
 
     const bool curValid = (!skipDraw);
 
-    if (needClearLine || curValid) {
-        const auto screenW2 = static_cast<int>(gfx->width());
-        int uStart = curValid ? curStart : clearStart;
-        int uEnd = curValid ? curEnd : clearEnd;
+    if (!needClearLine && !curValid) {
+        return;
+    }
 
-        if (needClearLine) {
-            if (clearStart < uStart) {
-                uStart = clearStart;
-            }
-            if (clearEnd > uEnd) {
-                uEnd = clearEnd;
-            }
+    int uStart = curValid ? curStart : clearStart;
+    int uEnd = curValid ? curEnd : clearEnd;
+
+    if (needClearLine) {
+        if (clearStart < uStart) {
+            uStart = clearStart;
+        }
+        if (clearEnd > uEnd) {
+            uEnd = clearEnd;
         }
+    }
 
-        if (uStart < 0) {
-            uStart = 0;
+    if (uStart < viewLeft) {
+        uStart = viewLeft;
+    }
+    if (uEnd > viewRight) {
+        uEnd = viewRight;
+    }
+    const auto uLen = static_cast<int>(uEnd - uStart);
+    if (uLen <= 0) {
+        return;
+    }
+
+    auto fillBg = m_prevBg;
+
+    if (m_fxFrame) {
+        fillBg = DisplayManager::getColorFx().apply(fillBg);
+    }
+
+    if (!curValid) {
+        for (int i = 0; i < uLen; i++) {
+            lineBuf[static_cast<size_t>(i)] = fillBg;
         }
-        if (uEnd > screenW2) {
-            uEnd = screenW2;
+
+        tft->writeAddrWindow(static_cast<int16_t>(uStart), static_cast<int16_t>(yPos), static_cast<uint16_t>(uLen), 1);
+        tft->writePixels(reinterpret_cast<uint16_t*>(lineBuf.data()), static_cast<uint32_t>(uLen));
+
+        return;
+    }
+
+    if (pDraw->ucHasTransparency == 0) {
+        for (int i = 0; i < uLen; i++) {
+            lineBuf[static_cast<size_t>(i)] = fillBg;
         }
-        const auto uLen = static_cast<int>(uEnd - uStart);
-        if (uLen > 0) {
-            const auto fillBg = (s_instance != nullptr) ? s_instance->m_prevBg : static_cast<uint16_t>(0);
 
-            if (!curValid) {
-                for (int i = 0; i < uLen; i++) {
-                    lineBuf[static_cast<size_t>(i)] = fillBg;
-                }
+        const auto* const sPtr = src;
+        const auto baseX = xPos - uStart;
+
+        for (int i = 0; i < drawW; ++i) {
+            const auto dstIndex = baseX + i;
 
-                tft->writeAddrWindow(static_cast<int16_t>(uStart), static_cast<int16_t>(yPos),
-                                     static_cast<uint16_t>(uLen), 1);
-                tft->writePixels(reinterpret_cast<uint16_t*>(lineBuf.data()), static_cast<uint32_t>(uLen));
-
-            } else {
-                if (pDraw->ucHasTransparency == 0) {
-                    for (int i = 0; i < uLen; i++) {
-                        lineBuf[static_cast<size_t>(i)] = fillBg;
-                    }
-
-                    const auto* const sPtr = src;
-                    const auto baseX = xPos - uStart;
-
-                    for (int i = 0; i < drawW; ++i) {
-                        const auto dstIndex = baseX + i;
-
-                        if (dstIndex >= 0 && dstIndex < uLen) {
-                            lineBuf[static_cast<size_t>(dstIndex)] = palette565[static_cast<uint8_t>(sPtr[i])];
-                        }
-                    }
-
-                    tft->writeAddrWindow(static_cast<int16_t>(uStart), static_cast<int16_t>(yPos),
-                                         static_cast<uint16_t>(uLen), 1);
-                    tft->writePixels(reinterpret_cast<uint16_t*>(lineBuf.data()), static_cast<uint32_t>(uLen));
-                } else {
-                    if (needClearLine) {
-                        for (int i = 0; i < uLen; i++) {
-                            lineBuf[static_cast<size_t>(i)] = fillBg;
-                        }
-
-                        const auto transparentIndex = static_cast<uint8_t>(pDraw->ucTransparent);
-                        const auto* const sPtr = src;
-                        const auto baseX = xPos - uStart;
-
-                        for (int i = 0; i < drawW; ++i) {
-                            const auto idx = static_cast<uint8_t>(sPtr[i]);
-
-                            if (idx != transparentIndex) {
-                                const auto dstIndex = baseX + i;
-
-                                if (dstIndex >= 0 && dstIndex < uLen) {
-                                    lineBuf[static_cast<size_t>(dstIndex)] = palette565[idx];
-                                }
-                            }
-                        }
-
-                        tft->writeAddrWindow(static_cast<int16_t>(uStart), static_cast<int16_t>(yPos),
-                                             static_cast<uint16_t>(uLen), 1);
-                        tft->writePixels(reinterpret_cast<uint16_t*>(lineBuf.data()), static_cast<uint32_t>(uLen));
-                    } else {
-                        const auto transparentIndex = static_cast<uint8_t>(pDraw->ucTransparent);
-                        const auto* const sPtr = src + visStart;
-                        int idx = 0;
-
-                        while (idx < (visEnd - visStart)) {
-                            while (idx < (visEnd - visStart) && sPtr[idx] == transparentIndex) {
-                                idx++;
-                            }
-
-                            if (idx >= (visEnd - visStart)) {
-                                break;
-                            }
-
-                            int runLen = 0;
-
-                            while (idx < (visEnd - visStart) && sPtr[idx] != transparentIndex) {
-                                lineBuf[static_cast<size_t>(runLen)] = palette565[static_cast<uint8_t>(sPtr[idx])];
-                                ++runLen;
-                                ++idx;
-                            }
-
-                            const auto dstX = static_cast<int>(xPos + visStart + (idx - runLen));
-
-                            tft->writeAddrWindow(static_cast<int16_t>(dstX), static_cast<int16_t>(yPos),
-                                                 static_cast<uint16_t>(runLen), 1);
-                            tft->writePixels(reinterpret_cast<uint16_t*>(lineBuf.data()),
-                                             static_cast<uint32_t>(runLen));
-                        }
-                    }
+            if (dstIndex >= 0 && dstIndex < uLen) {
+                lineBuf[static_cast<size_t>(dstIndex)] = palette565[static_cast<uint8_t>(sPtr[i])];
+            }
+        }
+
+        tft->writeAddrWindow(static_cast<int16_t>(uStart), static_cast<int16_t>(yPos), static_cast<uint16_t>(uLen), 1);
+        tft->writePixels(reinterpret_cast<uint16_t*>(lineBuf.data()), static_cast<uint32_t>(uLen));
+
+        return;
+    }
+
+    if (needClearLine) {
+        for (int i = 0; i < uLen; i++) {
+            lineBuf[static_cast<size_t>(i)] = fillBg;
+        }
+
+        const auto transparentIndex = static_cast<uint8_t>(pDraw->ucTransparent);
+        const auto* const sPtr = src;
+        const auto baseX = xPos - uStart;
+
+        for (int i = 0; i < drawW; ++i) {
+            const auto idx = static_cast<uint8_t>(sPtr[i]);
+
+            if (idx != transparentIndex) {
+                const auto dstIndex = baseX + i;
+
+                if (dstIndex >= 0 && dstIndex < uLen) {
+                    lineBuf[static_cast<size_t>(dstIndex)] = palette565[idx];
                 }
             }
         }
+
+        tft->writeAddrWindow(static_cast<int16_t>(uStart), static_cast<int16_t>(yPos), static_cast<uint16_t>(uLen), 1);
+        tft->writePixels(reinterpret_cast<uint16_t*>(lineBuf.data()), static_cast<uint32_t>(uLen));
+
+        return;
     }
 
-    if (endOfFrame) {
-        if (s_instance != nullptr && s_instance->m_inFrameWrite) {
-            tft->endWrite();
-            s_instance->m_inFrameWrite = false;
+    const auto transparentIndex = static_cast<uint8_t>(pDraw->ucTransparent);
+    const auto* const sPtr = src + visStart;
+    int idx = 0;
+
+    while (idx < (visEnd - visStart)) {
+        while (idx < (visEnd - visStart) && sPtr[idx] == transparentIndex) {
+            idx++;
+        }
+
+        if (idx >= (visEnd - visStart)) {
+            break;
         }
 
-        if (s_instance != nullptr) {
-            s_instance->m_havePrev = true;
-            s_instance->m_prevDisposal = s_instance->m_curDisposal;
-            s_instance->m_prevHadTransparency = s_instance->m_curHadTransparency;
-            s_instance->m_prevX = s_instance->m_curX;
-            s_instance->m_prevY = s_instance->m_curY;
-            s_instance->m_prevW = s_instance->m_curW;
-            s_instance->m_prevH = s_instance->m_curH;
-            s_instance->m_prevBg = s_instance->m_curBg;
+        int runLen = 0;
+
+        while (idx < (visEnd - visStart) && sPtr[idx] != transparentIndex) {
+            lineBuf[static_cast<size_t>(runLen)] = palette565[static_cast<uint8_t>(sPtr[idx])];
+            ++runLen;
+            ++idx;
         }
+
+        const auto dstX = static_cast<int>(xPos + visStart + (idx - runLen));
+
+        tft->writeAddrWindow(static_cast<int16_t>(dstX), static_cast<int16_t>(yPos), static_cast<uint16_t>(runLen), 1);
+        tft->writePixels(reinterpret_cast<uint16_t*>(lineBuf.data()), static_cast<uint32_t>(runLen));
+    }
+}
+
+/**
+ * @brief Advance the colour transform before a frame and restart from the first frame when it has to be repainted
+ *
+ * A palette transform only reaches the pixels a frame redraws and the panel cannot be read back, so when the
+ * transform changed and the GIF draws partial frames, decoding starts again from the first frame drawn over the
+ * whole canvas. During a fade such a GIF therefore stays on its first frame, GIFs made of full frames keep playing
+ *
+ * @return false if the file could not be reopened
+ */
+auto Gif::prepareColorFx() -> bool {
+    auto& colorFx = DisplayManager::getColorFx();
+
+    colorFx.beginFrame();
+    m_fxFrame = colorFx.isActive();
+
+    if (colorFx.getRevision() == m_fxRevision) {
+        return true;
+    }
+
+    m_fxRevision = colorFx.getRevision();
+
+    if (!m_partialFrames) {
+        return true;
     }
+
+    m_repaint = true;
+    m_havePrev = false;
+
+    if (m_frameIndex == 0) {
+        return true;
+    }
+
+    m_frameIndex = 0;
+
+    return openDecoder(0);
 }
 
 /**
@@ -430,17 +648,34 @@ auto Gif::playOne(const String& path) -> bool {
         }
     }
 
-    m_offsetX = 0;
-    m_offsetY = 0;
-    m_centered = false;
-
-    m_gif->begin(GIF_PALETTE_RGB565_LE);
+    m_currentPath = path;
+    m_havePrev = false;
+    m_partialFrames = false;
+    m_repaint = false;
+    m_frameIndex = 0;
+    m_fxRevision = DisplayManager::getColorFx().getRevision();
 
-    if (m_gif->open(path.c_str(), gifOpenFile, gifCloseFile, gifReadFile, gifSeekFile, gifDraw) <= 0) {
+    if (!openDecoder(0)) {
         return false;
     }
 
-    m_currentPath = path;
+    // Centre the canvas in the viewport, the whole screen unless setViewport() was called
+    auto* gfx = DisplayManager::getGfx();
+
+    m_viewX = m_requestX;
+    m_viewY = m_requestY;
+    m_viewW = m_requestW;
+    m_viewH = m_requestH;
+
+    if (m_viewW <= 0 || m_viewH <= 0) {
+        m_viewX = 0;
+        m_viewY = 0;
+        m_viewW = static_cast<int16_t>(gfx->width());
+        m_viewH = static_cast<int16_t>(gfx->height());
+    }
+
+    m_offsetX = static_cast<int16_t>(m_viewX + ((m_viewW - m_gif->getCanvasWidth()) / 2));
+    m_offsetY = static_cast<int16_t>(m_viewY + ((m_viewH - m_gif->getCanvasHeight()) / 2));
 
     m_stopRequested = false;
     m_playRequested = true;
@@ -450,64 +685,97 @@ auto Gif::playOne(const String& path) -> bool {
     m_lastFrameMs = millis();
     m_startMs = millis();
     m_frameCount = 0;
+    m_decodeUsTotal = 0;
 
     return true;
 }
 
 /**
- * @brief Update the GIF playback, should be called regularly
+ * @brief Log the average decode time of the frames played so far
  *
  * @return void
  */
-auto Gif::update() -> void {
-    if (!m_playing || m_gif == nullptr) {
+auto Gif::logStats() -> void {
+    if (m_frameCount <= 0) {
         return;
     }
 
+    Logger::info((m_currentPath + ": " + String(m_frameCount) + " frames, avg decode " +
+                  String(m_decodeUsTotal / static_cast<uint32_t>(m_frameCount)) + " us/frame")
+                     .c_str(),
+                 "Gif");
+
+    m_frameCount = 0;
+    m_decodeUsTotal = 0;
+}
+
+/**
+ * @brief Update the GIF playback, should be called regularly
+ *
+ * @return true if a frame was drawn
+ */
+auto Gif::update() -> bool {
+    if (!m_playing || m_gif == nullptr) {
+        return false;
+    }
+
     if (m_stopRequested) {
-        m_gif->close();
+        closeDecoder();
+        m_resumePos = 0;
         m_playing = false;
         m_playRequested = false;
         m_stopRequested = false;
-        return;
+        return false;
     }
 
     const uint32_t now = millis();
     if (m_targetMs > 0) {
         if ((now - m_lastFrameMs) < m_targetMs) {
-            return;
+            return false;
         }
     }
 
+    // Another player used the decoder since the last frame: reopen at the next frame of this one
+    if ((s_decoderOwner != this && !openDecoder(m_resumePos)) || !prepareColorFx()) {
+        m_playing = false;
+        m_playRequested = false;
+
+        return false;
+    }
+
     int delayMsFromGif = 0;
-    const int result = m_gif->playFrame(false, &delayMsFromGif, nullptr);
+    const uint32_t startUs = micros();
+    const int result = m_gif->playFrame(false, &delayMsFromGif, this);
+    m_decodeUsTotal += micros() - startUs;
     m_frameCount++;
+    m_frameIndex++;
     m_lastFrameMs = now;
 
     if (result <= 0) {
+        logStats();
+
         if (m_loopEnabled && !m_stopRequested && !m_currentPath.isEmpty()) {
-            m_gif->close();
-            if (m_gif->open(m_currentPath.c_str(), gifOpenFile, gifCloseFile, gifReadFile, gifSeekFile, gifDraw) <= 0) {
+            if (!openDecoder(0)) {
                 m_playing = false;
                 m_playRequested = false;
 
-                return;
+                return true;
             }
 
+            m_frameIndex = 0;
             m_delayMsFromGif = 0;
             m_targetMs = 0;
             m_lastFrameMs = millis();
             m_startMs = millis();
-            m_frameCount = 0;
 
-            return;
+            return true;
         }
 
-        m_gif->close();
+        closeDecoder();
         m_playing = false;
         m_playRequested = false;
 
-        return;
+        return true;
     }
 
     uint32_t targetMs = GIF_FRAME_MS;
@@ -518,12 +786,12 @@ auto Gif::update() -> void {
     m_targetMs = targetMs;
 
     if ((millis() - m_startMs) > GIF_MAX_MS_PER_FILE) {
-        m_gif->close();
+        closeDecoder();
         m_playing = false;
         m_playRequested = false;
-
-        return;
     }
+
+    return true;
 }
 
 /**
@@ -551,8 +819,6 @@ auto Gif::playAllFromLittleFS() -> bool {
         return false;
     }
 
-    m_gif->begin(LITTLE_ENDIAN_PIXELS);
-
     Dir dir = LittleFS.openDir("/gifs");
 
     while (dir.next()) {
@@ -610,3 +876,55 @@ auto Gif::isPlaying() const -> bool { return m_playing; }
  * @param enabled true to enable looping false to disable
  */
 auto Gif::setLoopEnabled(bool enabled) -> void { m_loopEnabled = enabled; }
+
+/**
+ * @brief Restrict the player to a rectangle of the screen, applied by the next playOne()
+ *
+ * The animation is centred in the viewport and clipped to it, a zero size means the whole screen
+ *
+ * @param xPos Left position in pixels
+ * @param yPos Top position in pixels
+ * @param width Width in pixels
+ * @param height Height in pixels
+ */
+auto Gif::setViewport(int16_t xPos, int16_t yPos, int16_t width, int16_t height) -> void {
+    m_requestX = xPos;
+    m_requestY = yPos;
+    m_requestW = width;
+    m_requestH = height;
+}
+
+/**
+ * @brief Time at which the next frame is due
+ *
+ * @return millis() timestamp
+ */
+auto Gif::nextFrameMs() const -> uint32_t { return m_lastFrameMs + m_targetMs; }
+
+/**
+ * @brief Check the header and logical screen descriptor of an uploaded GIF before it is stored
+ *
+ * @param data First bytes of the file
+ * @param len Number of bytes, HEADER_SIZE are needed
+ * @param error Receives the reason of a refusal
+ * @return true if the file is a GIF87a or GIF89a whose canvas the decoder accepts
+ */
+auto Gif::checkHeader(const uint8_t* data, size_t len, String& error) -> bool {
+    if (len < HEADER_SIZE || memcmp(data, "GIF8", 4) != 0 || (data[4] != '7' && data[4] != '9') || data[5] != 'a') {
+        error = "Not a GIF file";
+
+        return false;
+    }
+
+    const auto width = static_cast<uint16_t>(data[6] | (data[7] << 8));
+    const auto height = static_cast<uint16_t>(data[8] | (data[9] << 8));
+
+    if (width == 0 || height == 0 || width > MAX_CANVAS || height > MAX_CANVAS) {
+        error = "Unsupported size " + String(width) + "x" + String(height) + ", at most " + String(MAX_CANVAS) + "x" +
+                String(MAX_CANVAS);
+
+        return false;
+    }
+
+    return true;
+}
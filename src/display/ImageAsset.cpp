@@ -0,0 +1,348 @@
+#include <Logger.h>
+#include <array>
+#include <memory>
+#include <new>
+
+#include "display/ImageAsset.h"
+
+static constexpr uint8_t GMI_VERSION = 1;
+static constexpr size_t GMI_HEADER_SIZE = 16;
+static constexpr uint8_t GMI_FORMAT_RGB565 = 0;
+static constexpr uint8_t GMI_FORMAT_PAL8 = 1;
+static constexpr uint8_t GMI_FORMAT_PAL4 = 2;
+static constexpr uint16_t GMI_MAX_SIZE = 240;
+static constexpr uint16_t GMI_MAX_PALETTE = 256;
+static constexpr uint16_t GMI_MAX_PALETTE_PAL4 = 16;
+static constexpr uint8_t GMI_WINDOW_BITS_MIN = 8;
+static constexpr uint8_t GMI_WINDOW_BITS_MAX = 10;
+static constexpr uint8_t GMI_LOOKAHEAD_BITS_MIN = 3;
+static constexpr uint8_t GMI_LOOKAHEAD_BITS_MAX = 6;
+static constexpr size_t GMI_INPUT_CHUNK = 64;
+
+/**
+ * @class LzssStream
+ * @brief Incremental decoder for the heatshrink style LZSS bitstream
+ *
+ * Bits are read MSB first: a set tag bit is followed by an 8 bit literal, a clear one by (distance - 1) on windowBits
+ * and (length - 1) on lookaheadBits. A back reference may span several read() calls
+ */
+class LzssStream {
+   public:
+    LzssStream(ImageAsset::Source& source, uint8_t* window, uint8_t windowBits, uint8_t lookaheadBits)
+        : m_source(source),
+          m_window(window),
+          m_windowMask(static_cast<uint16_t>((1U << windowBits) - 1U)),
+          m_windowBits(windowBits),
+          m_lookaheadBits(lookaheadBits) {
+        memset(m_window, 0, static_cast<size_t>(m_windowMask) + 1U);
+    }
+
+    /**
+     * @brief Inflate exactly len bytes into out
+     *
+     * @param out Destination buffer
+     * @param len Number of bytes wanted
+     *
+     * @return false if the compressed stream ended early
+     */
+    auto read(uint8_t* out, size_t len) -> bool {
+        size_t produced = 0;
+
+        while (produced < len) {
+            if (m_copyLeft > 0) {
+                const uint8_t value = m_window[(m_head - m_copyDist) & m_windowMask];
+                m_window[m_head & m_windowMask] = value;
+                m_head++;
+                m_copyLeft--;
+                out[produced++] = value;
+
+                continue;
+            }
+
+            const uint16_t tag = getBits(1);
+
+            if (tag != 0U) {
+                const auto value = static_cast<uint8_t>(getBits(8));
+                m_window[m_head & m_windowMask] = value;
+                m_head++;
+                out[produced++] = value;
+            } else {
+                m_copyDist = static_cast<uint16_t>(getBits(m_windowBits) + 1U);
+                m_copyLeft = static_cast<uint16_t>(getBits(m_lookaheadBits) + 1U);
+            }
+
+            if (m_error) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+   private:
+    ImageAsset::Source& m_source;
+    uint8_t* m_window;
+    uint16_t m_windowMask;
+    uint8_t m_windowBits;
+    uint8_t m_lookaheadBits;
+
+    std::array<uint8_t, GMI_INPUT_CHUNK> m_input{};
+    size_t m_inputPos = 0;
+    size_t m_inputLen = 0;
+    uint8_t m_bitByte = 0;
+    uint8_t m_bitMask = 0;
+    bool m_error = false;
+
+    uint16_t m_head = 0;
+    uint16_t m_copyDist = 0;
+    uint16_t m_copyLeft = 0;
+
+    auto getBits(uint8_t count) -> uint16_t {
+        uint16_t value = 0;
+
+        while (count-- > 0) {
+            if (m_bitMask == 0) {
+                if (m_inputPos >= m_inputLen) {
+                    m_inputLen = m_source.read(m_input.data(), m_input.size());
+                    m_inputPos = 0;
+
+                    if (m_inputLen == 0) {
+                        m_error = true;
+
+                        return 0;
+                    }
+                }
+
+                m_bitByte = m_input[m_inputPos++];
+                m_bitMask = 0x80;
+            }
+
+            value = static_cast<uint16_t>((value << 1) | ((m_bitByte & m_bitMask) != 0 ? 1U : 0U));
+            m_bitMask >>= 1;
+        }
+
+        return value;
+    }
+};
+
+/**
+ * @brief Check whether a path points to a compressed image asset
+ *
+ * @param path File path
+ *
+ * @return true if the path has a .gmi extension
+ */
+auto ImageAsset::isImagePath(const String& path) -> bool {
+    String lower = path;
+    lower.toLowerCase();
+
+    return lower.endsWith(".gmi");
+}
+
+/**
+ * @brief Draw a compressed image stored on LittleFS
+ *
+ * @param tft Panel to draw on
+ * @param path Path to the .gmi file
+ * @param xPos Left position, may be negative or overflow the panel (clipped)
+ * @param yPos Top position, may be negative or overflow the panel (clipped)
+ *
+ * @return true if the image was decoded and drawn
+ */
+auto ImageAsset::drawFile(Arduino_TFT* tft, const String& path, int16_t xPos, int16_t yPos) -> bool {
+    File file = LittleFS.open(path, "r");
+
+    if (!file) {
+        Logger::error(("Failed to open image: " + path).c_str(), "ImageAsset");
+
+        return false;
+    }
+
+    FileSource source(file);
+    const bool drawOk = ImageAsset::draw(tft, source, xPos, yPos);
+
+    file.close();
+
+    if (!drawOk) {
+        Logger::error(("Failed to decode image: " + path).c_str(), "ImageAsset");
+    }
+
+    return drawOk;
+}
+
+/**
+ * @brief Decoder over a compressed stream positioned on the file header
+ *
+ * @param source Compressed byte source, must outlive the decoder
+ */
+ImageAsset::RowDecoder::RowDecoder(Source& source) : m_source(source) {}
+
+ImageAsset::RowDecoder::~RowDecoder() = default;
+
+/**
+ * @brief Parse the header and palette and allocate the decode buffers
+ *
+ * @return false on a malformed header or when out of memory
+ */
+auto ImageAsset::RowDecoder::open() -> bool {
+    std::array<uint8_t, GMI_HEADER_SIZE> header{};
+
+    if (m_source.read(header.data(), header.size()) != header.size() || memcmp(header.data(), "GMIM", 4) != 0 ||
+        header[4] != GMI_VERSION) {
+        return false;
+    }
+
+    m_format = header[5];
+    m_width = static_cast<uint16_t>(header[6] | (header[7] << 8));
+    m_height = static_cast<uint16_t>(header[8] | (header[9] << 8));
+    m_paletteCount = static_cast<uint16_t>(header[10] | (header[11] << 8));
+    m_row = 0;
+
+    const uint8_t windowBits = header[12];
+    const uint8_t lookaheadBits = header[13];
+    const uint16_t paletteMax = m_format == GMI_FORMAT_PAL4 ? GMI_MAX_PALETTE_PAL4 : GMI_MAX_PALETTE;
+    const bool paletted = m_format == GMI_FORMAT_PAL8 || m_format == GMI_FORMAT_PAL4;
+
+    if (m_format > GMI_FORMAT_PAL4 || m_width == 0 || m_height == 0 || m_width > GMI_MAX_SIZE ||
+        m_height > GMI_MAX_SIZE || windowBits < GMI_WINDOW_BITS_MIN || windowBits > GMI_WINDOW_BITS_MAX ||
+        lookaheadBits < GMI_LOOKAHEAD_BITS_MIN || lookaheadBits > GMI_LOOKAHEAD_BITS_MAX ||
+        (paletted && (m_paletteCount == 0 || m_paletteCount > paletteMax))) {
+        return false;
+    }
+
+    m_rowBytes = m_width;
+    if (m_format == GMI_FORMAT_RGB565) {
+        m_rowBytes = static_cast<size_t>(m_width) * 2U;
+    } else if (m_format == GMI_FORMAT_PAL4) {
+        m_rowBytes = (static_cast<size_t>(m_width) + 1U) / 2U;
+    }
+
+    // One block for the whole decode: window | palette | row (raw bytes, reused as RGB565 line)
+    const size_t windowSize = 1U << windowBits;
+    const size_t paletteBytes = paletted ? static_cast<size_t>(m_paletteCount) * 2U : 0U;
+    const size_t lineBytes = static_cast<size_t>(m_width) * 2U;
+    const size_t rawOffset = lineBytes - m_rowBytes;
+
+    m_block.reset(new (std::nothrow) uint8_t[windowSize + paletteBytes + lineBytes]);
+
+    if (!m_block) {
+        Logger::error("Not enough memory to decode image", "ImageAsset");
+
+        return false;
+    }
+
+    uint8_t* window = m_block.get();
+    m_palette = reinterpret_cast<uint16_t*>(window + windowSize);
+    m_line = reinterpret_cast<uint16_t*>(window + windowSize + paletteBytes);
+    m_raw = reinterpret_cast<uint8_t*>(m_line) + rawOffset;
+
+    if (paletted && m_source.read(reinterpret_cast<uint8_t*>(m_palette), paletteBytes) != paletteBytes) {
+        return false;
+    }
+
+    m_stream.reset(new (std::nothrow) LzssStream(m_source, window, windowBits, lookaheadBits));
+
+    return static_cast<bool>(m_stream);
+}
+
+/**
+ * @brief Inflate the next row
+ *
+ * @return the row as width() RGB565 pixels, valid until the next call, or nullptr past the last row or on error
+ */
+auto ImageAsset::RowDecoder::nextRow() -> const uint16_t* {
+    if (!m_stream || m_row >= m_height) {
+        return nullptr;
+    }
+
+    // The raw row sits at the end of the line buffer so palette expansion can run front to back in place
+    if (!m_stream->read(m_raw, m_rowBytes)) {
+        return nullptr;
+    }
+
+    m_row++;
+
+    if (m_format == GMI_FORMAT_RGB565) {
+        for (size_t col = 0; col < m_width; col++) {
+            m_line[col] = static_cast<uint16_t>(m_raw[col * 2] | (m_raw[(col * 2) + 1] << 8));
+        }
+    } else if (m_format == GMI_FORMAT_PAL8) {
+        for (size_t col = 0; col < m_width; col++) {
+            const uint8_t index = m_raw[col];
+            m_line[col] = index < m_paletteCount ? m_palette[index] : 0;
+        }
+    } else {
+        for (size_t col = 0; col < m_width; col++) {
+            const uint8_t packed = m_raw[col >> 1];
+            const uint8_t index = (col & 1U) != 0 ? (packed & 0x0F) : (packed >> 4);
+            m_line[col] = index < m_paletteCount ? m_palette[index] : 0;
+        }
+    }
+
+    return m_line;
+}
+
+/**
+ * @brief Decode an image from a byte source and stream it to the panel
+ *
+ * The visible part of the image is written inside one address window. Rows above the panel are inflated and
+ * dropped, decoding stops after the last visible row
+ *
+ * @param tft Panel to draw on
+ * @param source Compressed stream positioned on the file header
+ * @param xPos Left position
+ * @param yPos Top position
+ *
+ * @return true on success
+ */
+auto ImageAsset::draw(Arduino_TFT* tft, Source& source, int16_t xPos, int16_t yPos) -> bool {
+    if (tft == nullptr) {
+        return false;
+    }
+
+    RowDecoder decoder(source);
+
+    if (!decoder.open()) {
+        return false;
+    }
+
+    const int32_t screenW = tft->width();
+    const int32_t screenH = tft->height();
+    const int32_t left = xPos < 0 ? 0 : xPos;
+    const int32_t top = yPos < 0 ? 0 : yPos;
+    const int32_t right = (xPos + decoder.width()) > screenW ? screenW : (xPos + decoder.width());
+    const int32_t bottom = (yPos + decoder.height()) > screenH ? screenH : (yPos + decoder.height());
+
+    if (left >= right || top >= bottom) {
+        return true;
+    }
+
+    const auto visibleW = static_cast<uint32_t>(right - left);
+    const auto firstCol = static_cast<size_t>(left - xPos);
+    const auto lastRow = static_cast<uint16_t>(bottom - yPos);
+    bool decodeOk = true;
+
+    tft->startWrite();
+    tft->writeAddrWindow(static_cast<int16_t>(left), static_cast<int16_t>(top), static_cast<uint16_t>(visibleW),
+                         static_cast<uint16_t>(bottom - top));
+
+    for (uint16_t row = 0; row < lastRow; row++) {
+        const uint16_t* line = decoder.nextRow();
+
+        if (line == nullptr) {
+            decodeOk = false;
+
+            break;
+        }
+
+        if (row + yPos < top) {
+            continue;
+        }
+
+        tft->writePixels(const_cast<uint16_t*>(line) + firstCol, visibleW);
+    }
+
+    tft->endWrite();
+
+    return decodeOk;
+}
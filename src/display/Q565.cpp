@@ -0,0 +1,544 @@
+#include <Logger.h>
+
+#include "display/Q565.h"
+#include "display/DisplayManager.h"
+
+static constexpr uint8_t Q565_VERSION = 1;
+static constexpr uint8_t Q565_FLAG_LOOP = 0x01;
+static constexpr uint8_t Q565_TARGET_FPS = 30U;
+static constexpr uint32_t Q565_MIN_FRAME_MS = 1000U / Q565_TARGET_FPS;
+
+// Op codes, see scripts/q565_encode.py for the full format description
+static constexpr uint8_t Q565_OP_DIFF = 0x40;
+static constexpr uint8_t Q565_OP_LUMA = 0x80;
+static constexpr uint8_t Q565_OP_RUN = 0xC0;
+static constexpr uint8_t Q565_OP_SKIP8 = 0xFC;
+static constexpr uint8_t Q565_OP_SKIP16 = 0xFD;
+static constexpr uint8_t Q565_OP_RGB565 = 0xFE;
+static constexpr uint8_t Q565_OP_ARG_MASK = 0x3F;
+
+/**
+ * @brief Hash an RGB565 pixel into the 64 entry colour index
+ *
+ * @param pixel RGB565 pixel
+ *
+ * @return index slot in 0..63
+ */
+static inline auto q565Hash(uint16_t pixel) -> uint8_t {
+    const uint32_t red = (pixel >> 11) & 0x1F;
+    const uint32_t green = (pixel >> 5) & 0x3F;
+    const uint32_t blue = pixel & 0x1F;
+
+    return static_cast<uint8_t>((red * 3 + green * 5 + blue * 7) & 0x3F);
+}
+
+/**
+ * @brief Construct a new Q565 player
+ */
+Q565::Q565() = default;
+
+/**
+ * @brief Destroy the Q565 player, closing any open file
+ */
+Q565::~Q565() {
+    if (m_file) {
+        m_file.close();
+    }
+}
+
+/**
+ * @brief Check whether a path points to a Q565 animation
+ *
+ * @param path File path
+ *
+ * @return true if the path has a .q565 extension
+ */
+auto Q565::isQ565Path(const String& path) -> bool {
+    String lower = path;
+    lower.toLowerCase();
+
+    return lower.endsWith(".q565");
+}
+
+/**
+ * @brief Check the header of an uploaded animation before it is stored
+ *
+ * @param data First bytes of the file
+ * @param len Number of bytes, HEADER_SIZE are needed
+ * @param error Receives the reason of a refusal
+ * @return true if the file is a Q565 animation of this version that fits the screen
+ */
+auto Q565::checkHeader(const uint8_t* data, size_t len, String& error) -> bool {
+    if (len < HEADER_SIZE || memcmp(data, "Q565", 4) != 0 || data[4] != Q565_VERSION) {
+        error = "Not a Q565 animation";
+
+        return false;
+    }
+
+    const auto width = static_cast<uint16_t>(data[6] | (data[7] << 8));
+    const auto height = static_cast<uint16_t>(data[8] | (data[9] << 8));
+
+    // frames are not clipped, see readHeader()
+    auto* gfx = DisplayManager::getGfx();
+    const int maxW = gfx != nullptr ? std::min(static_cast<int>(gfx->width()), static_cast<int>(LINEBUF_MAX))
+                                    : static_cast<int>(LINEBUF_MAX);
+    const int maxH = gfx != nullptr ? static_cast<int>(gfx->height()) : static_cast<int>(LINEBUF_MAX);
+
+    if (width == 0 || height == 0 || width > maxW || height > maxH) {
+        error = "Unsupported size " + String(width) + "x" + String(height) + ", the screen is " + String(maxW) + "x" +
+                String(maxH);
+
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Read one byte from the buffered file stream
+ *
+ * @return the next byte, 0 on end of file (m_readError is set)
+ */
+auto Q565::readByte() -> uint8_t {
+    if (m_readPos >= m_readLen) {
+        m_readLen = m_file.read(m_readBuf.data(), m_readBuf.size());
+        m_readPos = 0;
+
+        if (m_readLen == 0) {
+            m_readError = true;
+
+            return 0;
+        }
+    }
+
+    return m_readBuf[m_readPos++];
+}
+
+/**
+ * @brief Read a little endian 16 bit value from the buffered file stream
+ *
+ * @return the value read
+ */
+auto Q565::readU16() -> uint16_t {
+    const uint8_t low = readByte();
+    const uint8_t high = readByte();
+
+    return static_cast<uint16_t>(low | (high << 8));
+}
+
+/**
+ * @brief Parse and validate the file header
+ *
+ * @return true if the header is valid and the animation fits on screen
+ */
+auto Q565::readHeader() -> bool {
+    std::array<uint8_t, HEADER_SIZE> header{};
+
+    if (m_file.read(header.data(), header.size()) != header.size()) {
+        return false;
+    }
+
+    if (memcmp(header.data(), "Q565", 4) != 0 || header[4] != Q565_VERSION) {
+        Logger::error(("Invalid Q565 header: " + m_currentPath).c_str(), "Q565");
+
+        return false;
+    }
+
+    m_width = static_cast<uint16_t>(header[6] | (header[7] << 8));
+    m_height = static_cast<uint16_t>(header[8] | (header[9] << 8));
+    m_frameTotal = static_cast<uint16_t>(header[10] | (header[11] << 8));
+
+    if ((header[5] & Q565_FLAG_LOOP) == 0) {
+        m_loopEnabled = false;
+    }
+
+    // Frames are streamed without clipping, the animation has to fit its viewport (the whole screen by default)
+    auto* gfx = DisplayManager::getGfx();
+    const bool fullScreen = m_viewW <= 0 || m_viewH <= 0;
+    const int viewX = fullScreen ? 0 : m_viewX;
+    const int viewY = fullScreen ? 0 : m_viewY;
+    const int viewW = fullScreen ? static_cast<int>(gfx->width()) : m_viewW;
+    const int viewH = fullScreen ? static_cast<int>(gfx->height()) : m_viewH;
+
+    if (m_width == 0 || m_height == 0 || m_width > viewW || m_height > viewH || m_width > LINEBUF_MAX || viewX < 0 ||
+        viewY < 0 || viewX + viewW > gfx->width() || viewY + viewH > gfx->height()) {
+        Logger::error(("Unsupported Q565 size " + String(m_width) + "x" + String(m_height)).c_str(), "Q565");
+
+        return false;
+    }
+
+    m_offsetX = static_cast<int16_t>(viewX + ((viewW - m_width) / 2));
+    m_offsetY = static_cast<int16_t>(viewY + ((viewH - m_height) / 2));
+    m_readPos = 0;
+    m_readLen = 0;
+    m_readError = false;
+    m_frameIndex = 0;
+
+    return true;
+}
+
+/**
+ * @brief Seek back to the first frame for looping
+ *
+ * @return true on success
+ */
+auto Q565::rewind() -> bool {
+    if (!m_file.seek(HEADER_SIZE, SeekSet)) {
+        return false;
+    }
+
+    m_readPos = 0;
+    m_readLen = 0;
+    m_readError = false;
+    m_frameIndex = 0;
+
+    return true;
+}
+
+/**
+ * @brief Write the buffered pixels of the current span to the panel
+ *
+ * @return void
+ */
+auto Q565::flushLine() -> void {
+    if (m_lineLen == 0) {
+        return;
+    }
+
+    m_tft->writePixels(m_lineBuf.data(), static_cast<uint32_t>(m_lineLen));
+    m_lineLen = 0;
+}
+
+/**
+ * @brief Output a pixel value count times at the current position of the dirty rectangle
+ *
+ * Opens one address window for the remainder of the rectangle when starting at a row boundary, so runs of rows
+ * without skips are streamed in a single RAMWR
+ *
+ * @param pixel RGB565 value
+ * @param count Number of pixels
+ *
+ * @return void
+ */
+auto Q565::emit(uint16_t pixel, uint32_t count) -> void {
+    while (count > 0 && m_row < m_rectH) {
+        if (!m_winOpen) {
+            const auto winY = static_cast<int16_t>(m_rectY + m_row);
+
+            if (m_col == 0) {
+                m_tft->writeAddrWindow(m_rectX, winY, m_rectW, static_cast<uint16_t>(m_rectH - m_row));
+                m_winRowOnly = false;
+            } else {
+                m_tft->writeAddrWindow(static_cast<int16_t>(m_rectX + m_col), winY,
+                                       static_cast<uint16_t>(m_rectW - m_col), 1);
+                m_winRowOnly = true;
+            }
+
+            m_winOpen = true;
+        }
+
+        m_lineBuf[m_lineLen++] = pixel;
+        count--;
+
+        if (m_lineLen == LINEBUF_MAX) {
+            flushLine();
+        }
+
+        if (++m_col == m_rectW) {
+            m_col = 0;
+            m_row++;
+
+            if (m_winRowOnly) {
+                flushLine();
+                m_winOpen = false;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Leave count pixels untouched, closing the current address window
+ *
+ * @param count Number of pixels to skip
+ *
+ * @return void
+ */
+auto Q565::skip(uint32_t count) -> void {
+    flushLine();
+    m_winOpen = false;
+
+    const uint32_t pos = static_cast<uint32_t>(m_row) * m_rectW + m_col + count;
+
+    m_row = static_cast<uint16_t>(pos / m_rectW);
+    m_col = static_cast<uint16_t>(pos % m_rectW);
+}
+
+/**
+ * @brief Decode the next frame and stream it to the panel
+ *
+ * @param delayMs Receives the frame delay in milliseconds
+ *
+ * @return true if the frame was decoded, false on a truncated or corrupt file
+ */
+auto Q565::decodeFrame(uint16_t& delayMs) -> bool  // NOLINT(readability-function-cognitive-complexity)
+{
+    uint32_t payload = readU16();
+    payload |= static_cast<uint32_t>(readU16()) << 16;
+    delayMs = readU16();
+    const uint16_t rectX = readU16();
+    const uint16_t rectY = readU16();
+    m_rectW = readU16();
+    m_rectH = readU16();
+
+    if (m_readError) {
+        return false;
+    }
+
+    m_frameIndex++;
+
+    if (payload == 0 || m_rectW == 0 || m_rectH == 0) {
+        return true;
+    }
+
+    if (rectX + m_rectW > m_width || rectY + m_rectH > m_height) {
+        Logger::error("Q565 frame rectangle out of bounds", "Q565");
+
+        return false;
+    }
+
+    const uint32_t payloadStart = m_file.position() - (m_readLen - m_readPos);
+
+    m_rectX = static_cast<int16_t>(rectX + m_offsetX);
+    m_rectY = static_cast<int16_t>(rectY + m_offsetY);
+    m_col = 0;
+    m_row = 0;
+    m_lineLen = 0;
+    m_winOpen = false;
+    m_index.fill(0);
+
+    uint16_t pixel = 0;
+
+    m_tft->startWrite();
+
+    while (m_row < m_rectH && !m_readError) {
+        const uint8_t op = readByte();
+
+        if (op == Q565_OP_SKIP8) {
+            skip(static_cast<uint32_t>(readByte()) + 1);
+            continue;
+        }
+
+        if (op == Q565_OP_SKIP16) {
+            skip(static_cast<uint32_t>(readU16()) + 1);
+            continue;
+        }
+
+        if (op == Q565_OP_RGB565) {
+            pixel = readU16();
+        } else if (op >= Q565_OP_RUN) {
+            emit(pixel, static_cast<uint32_t>(op & Q565_OP_ARG_MASK) + 1);
+            continue;
+        } else if (op >= Q565_OP_LUMA) {
+            const uint8_t next = readByte();
+            const int greenDiff = static_cast<int>(op & Q565_OP_ARG_MASK) - 32;
+            const int halfGreen = greenDiff >> 1;
+            const int red = static_cast<int>((pixel >> 11) & 0x1F) + halfGreen + (next >> 4) - 8;
+            const int green = static_cast<int>((pixel >> 5) & 0x3F) + greenDiff;
+            const int blue = static_cast<int>(pixel & 0x1F) + halfGreen + (next & 0x0F) - 8;
+
+            pixel = static_cast<uint16_t>(((red & 0x1F) << 11) | ((green & 0x3F) << 5) | (blue & 0x1F));
+        } else if (op >= Q565_OP_DIFF) {
+            const int red = static_cast<int>((pixel >> 11) & 0x1F) + ((op >> 4) & 0x03) - 2;
+            const int green = static_cast<int>((pixel >> 5) & 0x3F) + ((op >> 2) & 0x03) - 2;
+            const int blue = static_cast<int>(pixel & 0x1F) + (op & 0x03) - 2;
+
+            pixel = static_cast<uint16_t>(((red & 0x1F) << 11) | ((green & 0x3F) << 5) | (blue & 0x1F));
+        } else {
+            pixel = m_index[op];
+            emit(pixel, 1);
+            continue;
+        }
+
+        m_index[q565Hash(pixel)] = pixel;
+        emit(pixel, 1);
+    }
+
+    flushLine();
+    m_tft->endWrite();
+
+    const uint32_t consumed = (m_file.position() - (m_readLen - m_readPos)) - payloadStart;
+    if (consumed != payload) {
+        Logger::warn("Q565 payload size mismatch, resyncing", "Q565");
+
+        if (!m_file.seek(payloadStart + payload, SeekSet)) {
+            return false;
+        }
+
+        m_readPos = 0;
+        m_readLen = 0;
+    }
+
+    return !m_readError;
+}
+
+/**
+ * @brief Log the average decode time of the frames played so far
+ *
+ * @return void
+ */
+auto Q565::logStats() -> void {
+    if (m_frameCount == 0) {
+        return;
+    }
+
+    Logger::info((m_currentPath + ": " + String(m_frameCount) + " frames, avg decode " +
+                  String(m_decodeUsTotal / m_frameCount) + " us/frame")
+                     .c_str(),
+                 "Q565");
+
+    m_frameCount = 0;
+    m_decodeUsTotal = 0;
+}
+
+/**
+ * @brief Start playing a Q565 animation
+ *
+ * @param path Path of the .q565 file on LittleFS
+ *
+ * @return true if playback started successfully false otherwise
+ */
+auto Q565::playOne(const String& path) -> bool {
+    if (!DisplayManager::isReady()) {
+        return false;
+    }
+
+    if (m_file) {
+        m_file.close();
+    }
+
+    m_currentPath = path;
+    m_file = LittleFS.open(path, "r");
+
+    if (!m_file) {
+        Logger::error(("Failed to open " + path).c_str(), "Q565");
+
+        return false;
+    }
+
+    m_tft = reinterpret_cast<Arduino_TFT*>(DisplayManager::getGfx());
+
+    if (!readHeader()) {
+        m_file.close();
+
+        return false;
+    }
+
+    m_stopRequested = false;
+    m_playing = true;
+    m_targetMs = 0;
+    m_lastFrameMs = millis();
+    m_frameCount = 0;
+    m_decodeUsTotal = 0;
+
+    return true;
+}
+
+/**
+ * @brief Update the Q565 playback, should be called regularly
+ *
+ * @return true if a frame was drawn
+ */
+auto Q565::update() -> bool {
+    if (!m_playing) {
+        return false;
+    }
+
+    if (m_stopRequested) {
+        logStats();
+        m_file.close();
+        m_playing = false;
+        m_stopRequested = false;
+
+        return false;
+    }
+
+    const uint32_t now = millis();
+    if (m_targetMs > 0 && (now - m_lastFrameMs) < m_targetMs) {
+        return false;
+    }
+
+    if (m_frameIndex >= m_frameTotal) {
+        logStats();
+
+        if (!m_loopEnabled || !rewind()) {
+            m_file.close();
+            m_playing = false;
+
+            return false;
+        }
+    }
+
+    uint16_t delayMs = 0;
+    const uint32_t startUs = micros();
+    const bool decoded = decodeFrame(delayMs);
+
+    m_decodeUsTotal += micros() - startUs;
+    m_frameCount++;
+    m_lastFrameMs = now;
+
+    if (!decoded) {
+        Logger::error(("Corrupt or truncated file: " + m_currentPath).c_str(), "Q565");
+        logStats();
+        m_file.close();
+        m_playing = false;
+
+        return true;
+    }
+
+    m_targetMs = (delayMs > Q565_MIN_FRAME_MS) ? delayMs : Q565_MIN_FRAME_MS;
+
+    return true;
+}
+
+/**
+ * @brief Stop Q565 playback
+ */
+auto Q565::stop() -> void { m_stopRequested = true; }
+
+/**
+ * @brief Check if an animation is currently playing
+ *
+ * @return true if playing false otherwise
+ */
+auto Q565::isPlaying() const -> bool { return m_playing; }
+
+/**
+ * @brief Enable or disable looping, files without the loop flag never loop
+ *
+ * @param enabled true to enable looping false to disable
+ */
+auto Q565::setLoopEnabled(bool enabled) -> void { m_loopEnabled = enabled; }
+
+/**
+ * @brief Place the animation in a rectangle of the screen, applied by the next playOne()
+ *
+ * The animation is centred in the viewport and must fit in it, a zero size means the whole screen
+ *
+ * @param xPos Left position in pixels
+ * @param yPos Top position in pixels
+ * @param width Width in pixels
+ * @param height Height in pixels
+ */
+auto Q565::setViewport(int16_t xPos, int16_t yPos, int16_t width, int16_t height) -> void {
+    m_viewX = xPos;
+    m_viewY = yPos;
+    m_viewW = width;
+    m_viewH = height;
+}
+
+/**
+ * @brief Time at which the next frame is due
+ *
+ * @return millis() timestamp
+ */
+auto Q565::nextFrameMs() const -> uint32_t { return m_lastFrameMs + m_targetMs; }
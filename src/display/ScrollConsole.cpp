@@ -0,0 +1,105 @@
+#include <Logger.h>
+
+#include "display/ScrollConsole.h"
+#include "display/DisplayManager.h"
+
+/**
+ * @brief Open the console on a band of the screen and program the hardware scroll region
+ *
+ * @param gfx Display to draw on
+ * @param yPos Top of the console in logical rows
+ * @param height Available height, rounded down to a whole number of lines
+ * @param textSize Font size multiplier
+ * @param fgColor Text colour (RGB565)
+ * @param bgColor Background colour (RGB565)
+ *
+ * @return true if the scroll region could be set for the current rotation
+ */
+auto ScrollConsole::begin(Arduino_GFX* gfx, int16_t yPos, int16_t height, uint8_t textSize, uint16_t fgColor,
+                          uint16_t bgColor) -> bool {
+    if (gfx == nullptr || textSize == 0) {
+        return false;
+    }
+
+    m_gfx = gfx;
+    m_textSize = textSize;
+    m_fgColor = fgColor;
+    m_bgColor = bgColor;
+    m_lineHeight = static_cast<int16_t>((CHAR_H * textSize) + LINE_SPACING);
+    m_lines = static_cast<uint16_t>(height / m_lineHeight);
+    m_used = 0;
+
+    if (m_lines == 0) {
+        return false;
+    }
+
+    const auto regionHeight = static_cast<int16_t>(m_lines * m_lineHeight);
+
+    if (!DisplayManager::setScrollRegion(yPos, regionHeight)) {
+        return false;
+    }
+
+    m_gfx->fillRect(0, yPos, m_gfx->width(), regionHeight, m_bgColor);
+    m_active = true;
+
+    Logger::info(("Console opened with " + String(m_lines) + " lines").c_str(), "ScrollConsole");
+
+    return true;
+}
+
+/**
+ * @brief Print one line at the bottom of the console
+ *
+ * Once the console is full, the region is scrolled by one line height in hardware and only the exposed band is
+ * cleared and drawn
+ *
+ * @param text Line to print, cut at the console width
+ *
+ * @return void
+ */
+auto ScrollConsole::println(const String& text) -> void {
+    if (!m_active) {
+        return;
+    }
+
+    uint16_t line = m_used;
+
+    if (m_used < m_lines) {
+        m_used++;
+    } else {
+        DisplayManager::scrollBy(m_lineHeight);
+        line = static_cast<uint16_t>(m_lines - 1);
+    }
+
+    const int16_t bandY = DisplayManager::scrollLineToY(static_cast<int16_t>(line * m_lineHeight));
+
+    if (bandY < 0) {
+        return;
+    }
+
+    const auto maxChars = static_cast<unsigned int>(m_gfx->width() / (CHAR_W * m_textSize));
+
+    m_gfx->fillRect(0, bandY, m_gfx->width(), m_lineHeight, m_bgColor);
+    m_gfx->setTextWrap(false);
+    m_gfx->setTextSize(m_textSize);
+    m_gfx->setTextColor(m_fgColor, m_bgColor);
+    m_gfx->setCursor(0, static_cast<int16_t>(bandY + (LINE_SPACING / 2)));
+    m_gfx->print(text.length() > maxChars ? text.substring(0, maxChars) : text);
+}
+
+/**
+ * @brief Mark the console closed, the scroll region is released by DisplayManager::resetScroll
+ *
+ * @return void
+ */
+auto ScrollConsole::end() -> void {
+    m_active = false;
+    m_used = 0;
+}
+
+/**
+ * @brief Whether the console currently owns the scroll region
+ *
+ * @return true if open
+ */
+auto ScrollConsole::isActive() const -> bool { return m_active; }
@@ -0,0 +1,125 @@
+#include <new>
+
+#include "display/StripCanvas.h"
+
+/**
+ * @brief Canvas of the given screen size, the band buffer is allocated by begin()
+ *
+ * @param width Screen width in pixels
+ * @param height Screen height in pixels
+ * @param bandHeight Rows per band
+ */
+StripCanvas::StripCanvas(int16_t width, int16_t height, int16_t bandHeight)
+    : Arduino_GFX(width, height), m_bandHeight(bandHeight) {}
+
+StripCanvas::~StripCanvas() { delete[] m_band; }
+
+/**
+ * @brief Allocate the band buffer
+ *
+ * @param speed Unused, there is no bus behind the canvas
+ *
+ * @return false when the heap cannot hold one band
+ */
+bool StripCanvas::begin(int32_t speed) {
+    (void)speed;
+
+    if (m_band == nullptr) {
+        m_band = new (std::nothrow) uint16_t[static_cast<size_t>(WIDTH) * static_cast<size_t>(m_bandHeight)];
+    }
+
+    return m_band != nullptr;
+}
+
+/**
+ * @brief Store one pixel if it falls in the current band
+ *
+ * @param xPos Column, already clipped to the screen
+ * @param yPos Screen row, already clipped to the screen
+ * @param color RGB565 colour
+ */
+void StripCanvas::writePixelPreclipped(int16_t xPos, int16_t yPos, uint16_t color) {
+    const int16_t row = static_cast<int16_t>(yPos - m_bandY);
+
+    if (row < 0 || row >= m_bandRows) {
+        return;
+    }
+
+    m_band[(static_cast<size_t>(row) * WIDTH) + xPos] = color;
+}
+
+/**
+ * @brief Fill the part of a rectangle that falls in the current band
+ *
+ * @param xPos Left column, already clipped to the screen
+ * @param yPos Top screen row, already clipped to the screen
+ * @param width Width in pixels
+ * @param height Height in pixels
+ * @param color RGB565 colour
+ */
+void StripCanvas::writeFillRectPreclipped(int16_t xPos, int16_t yPos, int16_t width, int16_t height,
+                                          uint16_t color) {
+    int16_t first = static_cast<int16_t>(yPos - m_bandY);
+    int16_t last = static_cast<int16_t>(first + height);
+
+    first = first < 0 ? 0 : first;
+    last = last > m_bandRows ? m_bandRows : last;
+
+    for (int16_t row = first; row < last; row++) {
+        uint16_t* dst = m_band + (static_cast<size_t>(row) * WIDTH) + xPos;
+
+        for (int16_t col = 0; col < width; col++) {
+            dst[col] = color;
+        }
+    }
+}
+
+/**
+ * @brief Check whether a row range is drawn in the current band, lets callers skip work for other bands
+ *
+ * @param yPos Top screen row
+ * @param height Number of rows
+ *
+ * @return true if at least one row is inside the band
+ */
+auto StripCanvas::intersectsBand(int16_t yPos, int16_t height) const -> bool {
+    return yPos < m_bandY + m_bandRows && yPos + height > m_bandY;
+}
+
+/**
+ * @brief Build the screen band by band and flush each band with one address window
+ *
+ * @param tft Panel to flush to, must have the canvas size
+ * @param background Colour every band is cleared to before drawing
+ * @param draw Drawing callback, called once per band with the canvas as target
+ *
+ * @return void
+ */
+auto StripCanvas::compose(Arduino_TFT* tft, uint16_t background, const std::function<void(Arduino_GFX&)>& draw)
+    -> void {
+    if (tft == nullptr || m_band == nullptr) {
+        return;
+    }
+
+    for (m_bandY = 0; m_bandY < HEIGHT; m_bandY = static_cast<int16_t>(m_bandY + m_bandHeight)) {
+        m_bandRows = (HEIGHT - m_bandY) < m_bandHeight ? static_cast<int16_t>(HEIGHT - m_bandY) : m_bandHeight;
+
+        const size_t count = static_cast<size_t>(WIDTH) * static_cast<size_t>(m_bandRows);
+
+        for (size_t i = 0; i < count; i++) {
+            m_band[i] = background;
+        }
+
+        draw(*this);
+
+        tft->startWrite();
+        tft->writeAddrWindow(0, m_bandY, WIDTH, m_bandRows);
+        tft->writePixels(m_band, count);
+        tft->endWrite();
+
+        yield();
+    }
+
+    m_bandY = 0;
+    m_bandRows = 0;
+}
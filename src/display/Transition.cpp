@@ -0,0 +1,259 @@
+#include <Logger.h>
+#include <new>
+
+#include "display/Blend565.h"
+#include "display/Transition.h"
+
+// Transition progress scale, a frame at TRANSITION_ONE shows the incoming source only
+static constexpr uint16_t TRANSITION_ONE = 256;
+
+/**
+ * @brief Fill one line with the source colour
+ *
+ * @param line Output line
+ * @param width Number of pixels
+ *
+ * @return true
+ */
+auto SolidLineSource::readLine(uint16_t* line, uint16_t width) -> bool {
+    for (uint16_t col = 0; col < width; col++) {
+        line[col] = m_color;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Image source, the file is opened on rewind()
+ *
+ * @param path Path to the .gmi file on LittleFS
+ * @param xPos Left position of the image on screen
+ * @param yPos Top position of the image on screen
+ * @param background Colour around the image
+ */
+ImageLineSource::ImageLineSource(const String& path, int16_t xPos, int16_t yPos, uint16_t background)
+    : m_path(path), m_xPos(xPos), m_yPos(yPos), m_background(background), m_source(m_file) {}
+
+ImageLineSource::~ImageLineSource() {
+    m_decoder.reset();
+
+    if (m_file) {
+        m_file.close();
+    }
+}
+
+/**
+ * @brief Restart from the first screen line, reopening the file and the decoder
+ *
+ * @return false if the image cannot be opened or decoded
+ */
+auto ImageLineSource::rewind() -> bool {
+    m_decoder.reset();
+
+    if (m_file) {
+        m_file.close();
+    }
+
+    m_screenRow = 0;
+    m_decodedRow = -1;
+    m_row = nullptr;
+    m_file = LittleFS.open(m_path, "r");
+
+    if (!m_file) {
+        Logger::error(("Failed to open image: " + m_path).c_str(), "Transition");
+
+        return false;
+    }
+
+    m_decoder.reset(new (std::nothrow) ImageAsset::RowDecoder(m_source));
+
+    if (!m_decoder || !m_decoder->open()) {
+        Logger::error(("Failed to decode image: " + m_path).c_str(), "Transition");
+        m_decoder.reset();
+
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Produce the next screen line: background with the clipped image row on top
+ *
+ * @param line Output line
+ * @param width Number of pixels
+ *
+ * @return false on a decode error
+ */
+auto ImageLineSource::readLine(uint16_t* line, uint16_t width) -> bool {
+    for (uint16_t col = 0; col < width; col++) {
+        line[col] = m_background;
+    }
+
+    if (!m_decoder) {
+        return false;
+    }
+
+    const int16_t imageRow = static_cast<int16_t>(m_screenRow - m_yPos);
+    m_screenRow++;
+
+    if (imageRow < 0 || imageRow >= m_decoder->height()) {
+        return true;
+    }
+
+    // Rows above the screen are inflated and dropped on the first visible line
+    while (m_decodedRow < imageRow) {
+        m_row = m_decoder->nextRow();
+        m_decodedRow++;
+
+        if (m_row == nullptr) {
+            m_decoder.reset();
+
+            return false;
+        }
+    }
+
+    const int32_t first = m_xPos < 0 ? -m_xPos : 0;
+    const int32_t last = (m_xPos + m_decoder->width()) > width ? width - m_xPos : m_decoder->width();
+
+    for (int32_t col = first; col < last; col++) {
+        line[m_xPos + col] = m_row[col];
+    }
+
+    return true;
+}
+
+/**
+ * @brief Transition type from its API name
+ *
+ * @param name "crossfade", "wipe", "dissolve", anything else is a plain cut
+ *
+ * @return transition type
+ */
+auto Transition::parseType(const String& name) -> TransitionType {
+    if (name.equalsIgnoreCase("crossfade") || name.equalsIgnoreCase("fade")) {
+        return TransitionType::Crossfade;
+    }
+    if (name.equalsIgnoreCase("wipe")) {
+        return TransitionType::Wipe;
+    }
+    if (name.equalsIgnoreCase("dissolve")) {
+        return TransitionType::Dissolve;
+    }
+
+    return TransitionType::Cut;
+}
+
+/**
+ * @brief Play a transition, blocking until the incoming source fills the screen
+ *
+ * @param tft Panel to draw on
+ * @param from Source currently on screen
+ * @param to Source shown at the end
+ * @param type Transition kind, Cut draws the incoming source once
+ * @param durationMs Transition length
+ *
+ * @return false if a source failed or the line buffers could not be allocated
+ */
+auto Transition::run(Arduino_TFT* tft, LineSource& from, LineSource& to, TransitionType type, uint32_t durationMs)
+    -> bool {
+    if (tft == nullptr) {
+        return false;
+    }
+
+    // Line width rounded up to a pixel pair so the second buffer stays 4 byte aligned for the SWAR kernels
+    const size_t pitch = (static_cast<size_t>(tft->width()) + 1U) & ~static_cast<size_t>(1U);
+    std::unique_ptr<uint16_t[]> lines(new (std::nothrow) uint16_t[pitch * 2]);
+
+    if (!lines) {
+        Logger::error("Not enough memory for the transition line buffers", "Transition");
+
+        return false;
+    }
+
+    uint16_t* fromLine = lines.get();
+    uint16_t* toLine = lines.get() + pitch;
+
+    const uint32_t startMs = millis();
+    uint32_t frames = 0;
+    uint32_t elapsedMs = 0;
+
+    while (type != TransitionType::Cut && elapsedMs < durationMs) {
+        const auto progress = static_cast<uint16_t>((elapsedMs * TRANSITION_ONE) / durationMs);
+
+        if (!renderFrame(tft, from, to, type, progress, fromLine, toLine)) {
+            return false;
+        }
+
+        frames++;
+        yield();
+        elapsedMs = millis() - startMs;
+    }
+
+    if (!renderFrame(tft, from, to, TransitionType::Cut, TRANSITION_ONE, fromLine, toLine)) {
+        return false;
+    }
+
+    Logger::info(("Transition done: " + String(frames + 1) + " frames in " + String(millis() - startMs) + " ms").c_str(),
+                 "Transition");
+
+    return true;
+}
+
+/**
+ * @brief Build and push one full screen transition frame
+ *
+ * @param tft Panel to draw on
+ * @param from Outgoing source
+ * @param to Incoming source
+ * @param type Transition kind
+ * @param progress 0 .. TRANSITION_ONE
+ * @param fromLine Scratch line, receives the mixed output
+ * @param toLine Scratch line
+ *
+ * @return false if a source failed
+ */
+auto Transition::renderFrame(Arduino_TFT* tft, LineSource& from, LineSource& to, TransitionType type,
+                             uint16_t progress, uint16_t* fromLine, uint16_t* toLine) -> bool {
+    const auto width = static_cast<uint16_t>(tft->width());
+    const auto height = static_cast<uint16_t>(tft->height());
+    const bool needFrom = type != TransitionType::Cut;
+
+    if ((needFrom && !from.rewind()) || !to.rewind()) {
+        return false;
+    }
+
+    const auto alpha = static_cast<uint8_t>((progress * Blend565::ALPHA_MAX) / TRANSITION_ONE);
+    const auto level = static_cast<uint8_t>((progress * Blend565::DISSOLVE_LEVELS) / TRANSITION_ONE);
+    const size_t split = (static_cast<size_t>(progress) * width) / TRANSITION_ONE;
+    bool frameOk = true;
+
+    tft->startWrite();
+    tft->writeAddrWindow(0, 0, width, height);
+
+    for (uint16_t row = 0; row < height; row++) {
+        frameOk = to.readLine(toLine, width) && frameOk;
+
+        if (!needFrom) {
+            tft->writePixels(toLine, width);
+
+            continue;
+        }
+
+        frameOk = from.readLine(fromLine, width) && frameOk;
+
+        if (type == TransitionType::Crossfade) {
+            Blend565::crossfade(fromLine, fromLine, toLine, width, alpha);
+        } else if (type == TransitionType::Wipe) {
+            Blend565::wipe(fromLine, fromLine, toLine, width, split);
+        } else {
+            Blend565::dissolve(fromLine, fromLine, toLine, width, row, level);
+        }
+
+        tft->writePixels(fromLine, width);
+    }
+
+    tft->endWrite();
+
+    return frameOk;
+}
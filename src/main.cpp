@@ -7,9 +7,12 @@
 #include "project_version.h"
 #include "config/ConfigManager.h"
 #include "wireless/WiFiManager.h"
+#include "wireless/TimeSync.h"
 #include "display/DisplayManager.h"
 #include "web/Webserver.h"
 #include "web/Api.h"
+#include "web/FrameStream.h"
+#include "system/Scheduler.h"
 
 ConfigManager configManager;
 const char* AP_SSID = "GeekMagic";
@@ -18,19 +21,66 @@ WiFiManager* wifiManager = nullptr;
 
 static constexpr uint32_t SERIAL_BAUD_RATE = 115200;
 static constexpr uint32_t BOOT_DELAY_MS = 200;
-static constexpr int LOADING_BAR_TEXT_X = 50;
-static constexpr int LOADING_BAR_TEXT_Y = 80;
-static constexpr int LOADING_BAR_Y = 110;
+static constexpr int LOADING_BAR_Y = 200;
 static constexpr int LOADING_DELAY_MS = 1000;
 
 Webserver* webserver = nullptr;
 
+// Main loop tasks: priority, release period, deadline after release and slice budget, in microseconds
+static constexpr uint8_t RENDER_PRIORITY = 4;
+static constexpr uint32_t RENDER_PERIOD_US = 2000;
+static constexpr uint32_t RENDER_DEADLINE_US = 4000;
+static constexpr uint32_t RENDER_BUDGET_US = 20000;
+static constexpr uint8_t STREAM_PRIORITY = 3;
+static constexpr uint32_t STREAM_PERIOD_US = 1000;
+static constexpr uint32_t STREAM_DEADLINE_US = 10000;
+static constexpr uint32_t STREAM_BUDGET_US = 4000;
+static constexpr uint8_t HTTP_PRIORITY = 1;
+static constexpr uint32_t HTTP_DEADLINE_US = 20000;
+static constexpr uint8_t HOUSEKEEPING_PRIORITY = 2;
+static constexpr uint32_t LOG_PERIOD_US = 10000;
+static constexpr uint32_t LOG_DEADLINE_US = 50000;
+static constexpr uint32_t LOG_BUDGET_US = 500;
+static constexpr uint32_t WIFI_PERIOD_US = 1000000;
+static constexpr uint32_t WIFI_DEADLINE_US = 100000;
+static constexpr uint32_t WIFI_BUDGET_US = 1000;
+
+/**
+ * @brief Register the main loop tasks
+ *
+ * Rendering goes first, the short periodic tasks next and HTTP, the only task always ready, fills the time left
+ *
+ */
+static void registerTasks() {
+    Scheduler::add("render", RENDER_PRIORITY, RENDER_PERIOD_US, RENDER_DEADLINE_US, RENDER_BUDGET_US,
+                   [](uint32_t budgetUs) { DisplayManager::update(budgetUs); });
+    Scheduler::add("stream", STREAM_PRIORITY, STREAM_PERIOD_US, STREAM_DEADLINE_US, STREAM_BUDGET_US,
+                   [](uint32_t budgetUs) { FrameStream::update(budgetUs); });
+    Scheduler::add("http", HTTP_PRIORITY, 0, HTTP_DEADLINE_US, HttpServer::BUDGET_US, [](uint32_t budgetUs) {
+        if (webserver != nullptr) {
+            webserver->handleClient(budgetUs);
+        }
+    });
+    Scheduler::add("log", HOUSEKEEPING_PRIORITY, LOG_PERIOD_US, LOG_DEADLINE_US, LOG_BUDGET_US,
+                   [](uint32_t) { Logger::flush(); });
+    Scheduler::add("wifi", HOUSEKEEPING_PRIORITY, WIFI_PERIOD_US, WIFI_DEADLINE_US, WIFI_BUDGET_US, [](uint32_t) {
+        if (wifiManager != nullptr) {
+            wifiManager->update();
+        }
+    });
+}
+
 /**
  * @brief Initializes the system
  *
  */
 void setup() {
     Serial.begin(SERIAL_BAUD_RATE);
+
+    // Panel first with the compiled defaults: the boot splash is pushed from flash before the filesystem is mounted
+    DisplayManager::begin();
+    registerTasks();
+
     delay(BOOT_DELAY_MS);
     Serial.println("");
     Logger::info(("GeekMagic Open Firmware " + String(PROJECT_VER_STR)).c_str());
@@ -53,16 +103,17 @@ void setup() {
     }
     step++;
 
-    DisplayManager::begin();
+    DisplayManager::applyConfig();
     if (DisplayManager::isReady()) {
-        DisplayManager::drawTextWrapped(LOADING_BAR_TEXT_X, LOADING_BAR_TEXT_Y, "Starting...", 2, LCD_WHITE, LCD_BLACK,
-                                        true);
         DisplayManager::drawLoadingBar((float)step / TOTAL_STEPS, LOADING_BAR_Y);
     }
     step++;
 
     wifiManager = new WiFiManager(configManager.getSSID(), configManager.getPassword(), AP_SSID, AP_PASSWORD);
     wifiManager->begin();
+    if (!wifiManager->isApMode()) {
+        TimeSync::begin(configManager.getNtpServer(), configManager.getTimezone());
+    }
     if (DisplayManager::isReady()) {
         DisplayManager::drawLoadingBar((float)step / TOTAL_STEPS, LOADING_BAR_Y);
     }
@@ -77,17 +128,11 @@ void setup() {
 
     registerApiEndpoints(webserver);
 
-    webserver->serveStatic("/", "/web/index.html", "text/html");
-    webserver->serveStatic("/header.html", "/web/header.html", "text/html");
-    webserver->serveStatic("/footer.html", "/web/footer.html", "text/html");
-    webserver->serveStatic("/index.html", "/web/index.html", "text/html");
-    webserver->serveStatic("/update.html", "/web/update.html", "text/html");
-    webserver->serveStatic("/gif_upload.html", "/web/gif_upload.html", "text/html");
+    if (configManager.getStreamPort() != 0) {
+        FrameStream::begin(configManager.getStreamPort());
+    }
 
-    webserver->serveStatic("/css/pico.min.css", "/web/css/pico.min.css", "text/css");
-    webserver->serveStatic("/css/style.css", "/web/css/style.css", "text/css");
-    webserver->serveStatic("/js/alpinejs.min.js", "/web/js/alpinejs.min.js", "application/javascript");
-    webserver->serveStatic("/js/main.js", "/web/js/main.js", "application/javascript");
+    webserver->serveBundle();
 
     if (DisplayManager::isReady()) {
         DisplayManager::drawLoadingBar(1.0F, LOADING_BAR_Y);
@@ -96,11 +141,9 @@ void setup() {
     delay(LOADING_DELAY_MS);
 
     DisplayManager::drawStartup(wifiManager->getIP().toString());
-}
 
-void loop() {
-    if (webserver != nullptr) {
-        webserver->handleClient();
-    }
-    DisplayManager::update();
+    // from now on the log task sends the output, a full UART no longer stalls a frame
+    Logger::setBuffered(true);
 }
+
+void loop() { Scheduler::run(); }
@@ -0,0 +1,193 @@
+#include <Logger.h>
+#include <algorithm>
+#include <array>
+
+#include "system/Scheduler.h"
+
+/**
+ * @brief Shortest slice given to a task, below that the call overhead dominates
+ */
+static constexpr uint32_t MIN_SLICE_US = 500;
+
+/**
+ * @brief Window over which the CPU share of the tasks is measured
+ */
+static constexpr uint32_t LOAD_WINDOW_US = 1000000;
+
+static constexpr float PERCENT = 100.0F;
+
+struct SchedulerTask {
+    SchedulerTaskStats stats;
+    SchedulerTaskFn run = nullptr;
+    uint32_t releaseUs = 0;
+    uint32_t windowUs = 0;
+};
+
+static std::array<SchedulerTask, Scheduler::MAX_TASKS> s_tasks;
+static size_t s_taskCount = 0;
+static SchedulerStats s_stats;
+static uint32_t s_windowStartUs = 0;
+static uint32_t s_windowBusyUs = 0;
+
+/**
+ * @brief Whether a task has been released
+ *
+ * @param task Task to check
+ * @param nowUs Current micros()
+ * @return true if the task may run
+ */
+static auto isDue(const SchedulerTask& task, uint32_t nowUs) -> bool {
+    return static_cast<int32_t>(nowUs - task.releaseUs) >= 0;
+}
+
+/**
+ * @brief Whether a due task should run before another due task
+ *
+ * A task past its deadline goes first so low priority work is delayed but never starved, then the higher priority,
+ * then the one released first
+ *
+ * @param task Candidate
+ * @param other Current choice
+ * @param nowUs Current micros()
+ * @return true if task goes before other
+ */
+static auto outranks(const SchedulerTask& task, const SchedulerTask& other, uint32_t nowUs) -> bool {
+    bool taskLate = nowUs - task.releaseUs > task.stats.deadlineUs;
+    bool otherLate = nowUs - other.releaseUs > other.stats.deadlineUs;
+
+    if (taskLate != otherLate) {
+        return taskLate;
+    }
+
+    if (task.stats.priority != other.stats.priority) {
+        return task.stats.priority > other.stats.priority;
+    }
+
+    return static_cast<int32_t>(task.releaseUs - other.releaseUs) < 0;
+}
+
+/**
+ * @brief Register a task, call before the first run()
+ *
+ * @param name Task name, must stay valid
+ * @param priority Higher runs first
+ * @param periodUs Interval between releases, 0 to run whenever nothing more urgent is due
+ * @param deadlineUs Delay after the release past which the start counts as missed
+ * @param budgetUs Longest slice given to the task
+ * @param task Task body
+ * @return true if the task was added
+ */
+auto Scheduler::add(const char* name, uint8_t priority, uint32_t periodUs, uint32_t deadlineUs, uint32_t budgetUs,
+                    SchedulerTaskFn task) -> bool {
+    if (s_taskCount >= MAX_TASKS || task == nullptr) {
+        Logger::error((String("Cannot add task ") + name).c_str(), "Scheduler");
+
+        return false;
+    }
+
+    SchedulerTask& entry = s_tasks[s_taskCount++];
+    entry.stats.name = name;
+    entry.stats.priority = priority;
+    entry.stats.periodUs = periodUs;
+    entry.stats.deadlineUs = deadlineUs;
+    entry.stats.budgetUs = budgetUs;
+    entry.run = task;
+    entry.releaseUs = micros();
+
+    return true;
+}
+
+/**
+ * @brief Run the most urgent due task for one slice, call from loop()
+ *
+ * Returning between tasks lets the SDK serve WiFi, so a pass runs a single task
+ */
+auto Scheduler::run() -> void {
+    const uint32_t nowUs = micros();
+    SchedulerTask* next = nullptr;
+
+    for (size_t i = 0; i < s_taskCount; ++i) {
+        SchedulerTask& task = s_tasks[i];
+        if (isDue(task, nowUs) && (next == nullptr || outranks(task, *next, nowUs))) {
+            next = &task;
+        }
+    }
+
+    if (next != nullptr) {
+        uint32_t slice = next->stats.budgetUs;
+
+        for (size_t i = 0; i < s_taskCount; ++i) {
+            const SchedulerTask& task = s_tasks[i];
+            if (task.stats.priority > next->stats.priority) {
+                auto untilDue = static_cast<int32_t>(task.releaseUs - nowUs);
+                slice = std::min(slice, std::max(static_cast<uint32_t>(std::max(untilDue, 0)), MIN_SLICE_US));
+            }
+        }
+
+        uint32_t latencyUs = nowUs - next->releaseUs;
+        next->stats.maxLatencyUs = std::max(next->stats.maxLatencyUs, latencyUs);
+        if (latencyUs > next->stats.deadlineUs) {
+            next->stats.missed++;
+        }
+
+        const uint32_t startUs = micros();
+        next->run(slice);
+        const uint32_t endUs = micros();
+        const uint32_t elapsedUs = endUs - startUs;
+
+        next->stats.runs++;
+        next->stats.totalUs += elapsedUs;
+        next->stats.maxUs = std::max(next->stats.maxUs, elapsedUs);
+        if (elapsedUs > slice) {
+            next->stats.overruns++;
+        }
+        next->windowUs += elapsedUs;
+        s_windowBusyUs += elapsedUs;
+
+        // a periodic task that fell more than a period behind restarts its cadence instead of running back to back
+        next->releaseUs += next->stats.periodUs;
+        if (next->stats.periodUs == 0 || static_cast<int32_t>(endUs - next->releaseUs) > 0) {
+            next->releaseUs = endUs + next->stats.periodUs;
+        }
+    }
+
+    const uint32_t endUs = micros();
+    s_stats.passes++;
+    s_stats.maxPassUs = std::max(s_stats.maxPassUs, endUs - nowUs);
+
+    const uint32_t windowUs = endUs - s_windowStartUs;
+    if (windowUs >= LOAD_WINDOW_US) {
+        for (size_t i = 0; i < s_taskCount; ++i) {
+            s_tasks[i].stats.load = static_cast<float>(s_tasks[i].windowUs) * PERCENT / static_cast<float>(windowUs);
+            s_tasks[i].windowUs = 0;
+        }
+
+        s_stats.busy = static_cast<float>(s_windowBusyUs) * PERCENT / static_cast<float>(windowUs);
+        s_windowBusyUs = 0;
+        s_windowStartUs = endUs;
+    }
+}
+
+/**
+ * @brief Number of registered tasks
+ *
+ * @return task count
+ */
+auto Scheduler::getTaskCount() -> size_t { return s_taskCount; }
+
+/**
+ * @brief Settings and accounting of a task, load is its share of the last second in percent
+ *
+ * @param index Task index, in registration order
+ * @return task stats, empty if the index is out of range
+ */
+auto Scheduler::getTaskStats(size_t index) -> SchedulerTaskStats {
+    return index < s_taskCount ? s_tasks[index].stats : SchedulerTaskStats();
+}
+
+/**
+ * @brief Accounting of the whole loop, busy is the share of the last second spent in tasks in percent
+ *
+ * @return scheduler stats
+ */
+auto Scheduler::getStats() -> SchedulerStats { return s_stats; }
@@ -1,17 +1,48 @@
 #include <Arduino.h>
 #include <Logger.h>
 #include <ArduinoJson.h>
-#include <ESP8266HTTPUpdateServer.h>
 #include <Updater.h>
+#include <memory>
+#include <utility>
 
 #include "web/Webserver.h"
 #include "web/Api.h"
+#include "web/JsonResponse.h"
+#include "web/UploadWriter.h"
+#include "web/ContentRange.h"
+#include "web/ResumableUpload.h"
+#include "web/FileMd5.h"
+#include "web/OtaStream.h"
+#include "web/FrameStream.h"
 #include "display/DisplayManager.h"
+#include "display/Gif.h"
+#include "display/Q565.h"
+#include "display/Effects.h"
+#include "display/ImageAsset.h"
+#include "display/ColorFx.h"
+#include "display/DisplayList.h"
+#include "config/ConfigManager.h"
+#include "wireless/TimeSync.h"
+#include "system/Scheduler.h"
+
+extern ConfigManager configManager;
 
-ESP8266HTTPUpdateServer httpUpdater;
 static bool otaError = false;
-static size_t otaSize = 0;
 static String otaStatus;
+static OtaStream otaStream;
+static ResumableUpload resumableUpload;
+static constexpr uint32_t DEFAULT_TRANSITION_MS = 600;
+static constexpr size_t CLOCK_TIME_TEXT_MAX = 24;
+static constexpr size_t SCENE_NAME_MAX = 32;
+static constexpr const char* SCENE_DIR = "/scenes";
+static constexpr uint32_t MANIFEST_HASH_SLICE_US = 2000;
+static constexpr const char* LEGACY_UPDATE_PAGE =
+    "<!DOCTYPE html><html><body>"
+    "<form method='POST' action='/api/v1/ota/fw' enctype='multipart/form-data'>"
+    "Firmware: <input type='file' name='firmware'><input type='submit' value='Update'></form>"
+    "<form method='POST' action='/api/v1/ota/fs' enctype='multipart/form-data'>"
+    "Filesystem: <input type='file' name='filesystem'><input type='submit' value='Update'></form>"
+    "</body></html>";
 
 /**
  * @brief Register API endpoints for the webserver
@@ -22,10 +53,14 @@ static String otaStatus;
 void registerApiEndpoints(Webserver* webserver) {
     Logger::info("Registering API endpoints", "API");
 
+    // sendJson() answers in MessagePack when the client asks for it
+    webserver->raw().collectHeader("Accept");
+    webserver->raw().collectHeader("Content-Range");
+
     webserver->raw().on("/api/v1/reboot", HTTP_POST, [webserver]() { handleReboot(webserver); });
 
-    // Just in case for now the old updater endpoint is still here
-    httpUpdater.setup(&webserver->raw(), "/legacyupdate");
+    // Just in case for now the old updater page is still here, it posts to the OTA endpoints below
+    webserver->raw().on("/legacyupdate", HTTP_GET, [webserver]() { handleLegacyUpdatePage(webserver); });
 
     webserver->raw().on(
         "/api/v1/ota/fw", HTTP_POST, [webserver]() { handleOtaFinished(webserver); },
@@ -38,38 +73,92 @@ void registerApiEndpoints(Webserver* webserver) {
         "/api/v1/gif", HTTP_POST, [webserver]() { handleGifUpload(webserver); },
         [webserver]() { handleGifUpload(webserver); });
 
+    webserver->raw().on("/api/v1/upload", HTTP_POST, [webserver]() { handleUploadCreate(webserver); });
+    webserver->raw().on("/api/v1/upload", HTTP_GET, [webserver]() { handleUploadStatus(webserver); });
+    webserver->raw().on("/api/v1/upload", HTTP_PUT, [webserver]() { handleUploadRange(webserver); });
+    webserver->raw().on("/api/v1/upload", HTTP_DELETE, [webserver]() { handleUploadCancel(webserver); });
+    webserver->raw().on("/api/v1/upload/finish", HTTP_POST, [webserver]() { handleUploadFinish(webserver); });
+
+    webserver->raw().on("/api/v1/fs/manifest", HTTP_GET, [webserver]() { handleFsManifest(webserver); });
+    webserver->raw().on("/api/v1/fs/file", HTTP_DELETE, [webserver]() { handleFsDelete(webserver); });
+
     webserver->raw().on("/api/v1/gif/play", HTTP_POST, [webserver]() { handlePlayGif(webserver); });
     webserver->raw().on("/api/v1/gif/stop", HTTP_POST, [webserver]() { handleStopGif(webserver); });
+    webserver->raw().on("/api/v1/gif/fade", HTTP_POST, [webserver]() { handleFadeGif(webserver); });
+    webserver->raw().on("/api/v1/display/command", HTTP_GET, [webserver]() { handleGetCommandStatus(webserver); });
+
+    webserver->raw().on("/api/v1/display/fx", HTTP_GET, [webserver]() { handleGetColorFx(webserver); });
+    webserver->raw().on("/api/v1/display/fx", HTTP_POST, [webserver]() { handleSetColorFx(webserver); });
+
+    webserver->raw().on("/api/v1/display/panel", HTTP_GET, [webserver]() { handleGetPanelProfile(webserver); });
+    webserver->raw().on("/api/v1/display/panel", HTTP_POST, [webserver]() { handleSetPanelProfile(webserver); });
 
     webserver->raw().on("/api/v1/gif", HTTP_GET, [webserver]() { handleListGifs(webserver); });
+    webserver->raw().on("/api/v1/effects", HTTP_GET, [webserver]() { handleListEffects(webserver); });
+
+    webserver->raw().on("/api/v1/viewports", HTTP_GET, [webserver]() { handleGetViewports(webserver); });
+    webserver->raw().on("/api/v1/viewports", HTTP_POST, [webserver]() { handleSetViewports(webserver); });
+
+    webserver->raw().on("/api/v1/image", HTTP_GET, [webserver]() { handleListImages(webserver); });
+    webserver->raw().on("/api/v1/image/draw", HTTP_POST, [webserver]() { handleDrawImage(webserver); });
+
+    webserver->raw().on("/api/v1/console", HTTP_POST, [webserver]() { handleConsolePrint(webserver); });
+
+    webserver->raw().on("/api/v1/draw", HTTP_POST, [webserver]() { handleDrawList(webserver); });
+    webserver->raw().on("/api/v1/scenes", HTTP_GET, [webserver]() { handleListScenes(webserver); });
+    webserver->raw().on("/api/v1/scenes", HTTP_DELETE, [webserver]() { handleDeleteScene(webserver); });
+    webserver->raw().on("/api/v1/scenes/play", HTTP_POST, [webserver]() { handlePlayScene(webserver); });
+
+    webserver->raw().on("/api/v1/stream", HTTP_GET, [webserver]() { handleGetStreamStats(webserver); });
+    webserver->raw().on("/api/v1/scheduler", HTTP_GET, [webserver]() { handleGetSchedulerStats(webserver); });
+
+    webserver->raw().on("/api/v1/clock", HTTP_GET, [webserver]() { handleGetClock(webserver); });
+    webserver->raw().on("/api/v1/clock", HTTP_POST, [webserver]() { handleSetClock(webserver); });
+}
+
+/**
+ * @brief Page size asked with ?limit=, the whole list when absent
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return Maximum number of items to send
+ */
+static auto listLimit(Webserver* webserver) -> size_t {
+    if (!webserver->raw().hasArg("limit")) {
+        return SIZE_MAX;
+    }
+
+    return static_cast<size_t>(std::max(1L, webserver->raw().arg("limit").toInt()));
+}
+
+/**
+ * @brief Whether a directory entry comes after the ?cursor= of a paginated list
+ *
+ * LittleFS lists a directory in name order, so the cursor is the name of the last entry of the previous page
+ *
+ * @param name Entry name
+ * @param cursor Cursor, empty for the first page
+ *
+ * @return true if the entry belongs to the requested page or a later one
+ */
+static auto pastCursor(const String& name, const String& cursor) -> bool {
+    return cursor.isEmpty() || name.compareTo(cursor) > 0;
 }
 
 /**
- * @brief List GIF files and FS info
+ * @brief List GIF files and FS info, paginated with ?limit= and ?cursor=
  * @param webserver Pointer to the Webserver instance
  *
  * @return void
  */
 void handleListGifs(Webserver* webserver) {
-    JsonDocument doc;
-    JsonArray files = doc["files"].to<JsonArray>();
+    JsonDocument head;
 
     size_t usedBytes = 0;
     size_t totalBytes = 0;
+    Dir dir;
 
     if (LittleFS.begin()) {
-        Dir dir = LittleFS.openDir("/gif");
-
-        while (dir.next()) {
-            String name = dir.fileName();
-            if (name.endsWith(".gif") || name.endsWith(".GIF")) {
-                JsonObject fileObj = files.add<JsonObject>();
-
-                fileObj["name"] = name;            // NOLINT(readability-misplaced-array-index)
-                fileObj["size"] = dir.fileSize();  // NOLINT(readability-misplaced-array-index)
-                usedBytes += dir.fileSize();
-            }
-        }
+        dir = LittleFS.openDir("/gif");
 
         FSInfo fs_info;
 
@@ -79,36 +168,108 @@ void handleListGifs(Webserver* webserver) {
         }
     }
 
-    doc["usedBytes"] = usedBytes;
-    doc["totalBytes"] = totalBytes;
-    doc["freeBytes"] = totalBytes > usedBytes ? totalBytes - usedBytes : 0;
+    head["usedBytes"] = usedBytes;
+    head["totalBytes"] = totalBytes;
+    head["freeBytes"] = totalBytes > usedBytes ? totalBytes - usedBytes : 0;
+
+    String after = webserver->raw().arg("cursor");
 
-    String json;
-    serializeJson(doc, json);
-    webserver->raw().send(HTTP_CODE_OK, "application/json", json);
+    sendJsonList(webserver, head, "files", listLimit(webserver),
+                 [dir, after](JsonDocument& item, String& cursor) mutable -> JsonListStep {
+                     while (dir.next()) {
+                         String name = dir.fileName();
+                         if ((name.endsWith(".gif") || name.endsWith(".GIF") || Q565::isQ565Path(name)) &&
+                             pastCursor(name, after)) {
+                             item["name"] = name;
+                             item["size"] = dir.fileSize();
+                             cursor = name;
+
+                             return JsonListStep::Item;
+                         }
+                     }
+
+                     return JsonListStep::End;
+                 });
 }
 
 /**
- * @brief Handle GIF upload start
- * @param currentFilename The current filename being uploaded
- * @param gifFile Reference to the File object for the GIF
- * @param uploadError Reference to the upload error flag
+ * @brief Path an uploaded animation is stored at
+ * @param name File name sent by the client, any directory part is dropped
+ *
+ * @return path in /gif
+ */
+static auto gifUploadPath(const String& name) -> String {
+    String filename = name;
+    filename.replace("\\", "/");
+    filename = filename.substring(filename.lastIndexOf('/') + 1);
+
+    return "/gif/" + filename;
+}
+
+/**
+ * @brief Create /gif before the first upload
  *
  * @return void
  */
-void handleGifUploadStart(const String& currentFilename, File& gifFile, bool& uploadError) {
-    uploadError = false;
-    Logger::info((String("UPLOAD_FILE_START for: ") + currentFilename).c_str(), "API::GIF");
+static void ensureGifDirectory() {
     if (!LittleFS.exists("/gif")) {
         Logger::info("/gif directory does not exist, creating...", "API::GIF");
         if (!LittleFS.mkdir("/gif")) {
             Logger::error("Failed to create /gif directory!", "API::GIF");
         }
     }
-    gifFile = LittleFS.open(currentFilename, "w");
-    if (!gifFile) {
+}
+
+/**
+ * @brief Header check matching the extension of an uploaded animation
+ * @param filename Name of the uploaded file
+ * @param headerSize Receives the number of bytes the check needs
+ *
+ * @return check refusing the upload if the file is not a GIF or a Q565 animation the screen can play
+ */
+static auto uploadHeaderCheck(const String& filename, size_t& headerSize) -> UploadWriter::THeaderCheck {
+    String lower = filename;
+    lower.toLowerCase();
+
+    if (lower.endsWith(".gif")) {
+        headerSize = Gif::HEADER_SIZE;
+
+        return Gif::checkHeader;
+    }
+
+    if (Q565::isQ565Path(lower)) {
+        headerSize = Q565::HEADER_SIZE;
+
+        return Q565::checkHeader;
+    }
+
+    headerSize = 0;
+
+    return [](const uint8_t*, size_t, String& error) {
+        error = "Only .gif and .q565 files can be uploaded";
+
+        return false;
+    };
+}
+
+/**
+ * @brief Handle GIF upload start
+ * @param currentFilename The current filename being uploaded
+ * @param expectedSize Request length announced by the client, checked against the free space
+ * @param gifWriter Reference to the writer of the GIF
+ * @param uploadError Reference to the upload error flag
+ *
+ * @return void
+ */
+void handleGifUploadStart(const String& currentFilename, size_t expectedSize, UploadWriter& gifWriter,
+                          bool& uploadError) {
+    uploadError = false;
+    Logger::info((String("UPLOAD_FILE_START for: ") + currentFilename).c_str(), "API::GIF");
+    ensureGifDirectory();
+    size_t headerSize = 0;
+    UploadWriter::THeaderCheck check = uploadHeaderCheck(currentFilename, headerSize);
+    if (!gifWriter.begin(currentFilename, expectedSize, headerSize, check)) {
         uploadError = true;
-        Logger::error((String("Impossible to open file: ") + currentFilename).c_str(), "API::GIF");
         Logger::error("GIF UPLOAD Failed to open file", "API::GIF");
     } else {
         Logger::info("File opened successfully for writing.", "API::GIF");
@@ -118,27 +279,19 @@ void handleGifUploadStart(const String& currentFilename, File& gifFile, bool& up
 /**
  * @brief Handle GIF upload write
  * @param upload Reference to the HTTPUpload object
- * @param gifFile Reference to the File object for the GIF
+ * @param gifWriter Reference to the writer of the GIF
  * @param uploadError Reference to the upload error flag
  *
  * @return void
  */
-void handleGifUploadWrite(HTTPUpload& upload, File& gifFile, bool& uploadError) {
-    if (!uploadError && gifFile) {
-        size_t total = 0;
-        while (total < upload.currentSize) {
-            size_t remaining = upload.currentSize - total;
-            int toWrite = static_cast<int>(remaining > static_cast<size_t>(INT_MAX) ? INT_MAX : remaining);
-            size_t written = gifFile.write(upload.buf + total, toWrite);
-
-            if (written == 0) {
-                Logger::error("Write returned 0 bytes!", "API::GIF");
-                uploadError = true;
-                break;
-            }
-            total += written;
+void handleGifUploadWrite(HTTPUpload& upload, UploadWriter& gifWriter, bool& uploadError) {
+    if (!uploadError && gifWriter.isOpen()) {
+        if (!gifWriter.write(upload.buf, upload.currentSize)) {
+            Logger::error("Write failed!", "API::GIF");
+            gifWriter.abort();
+            uploadError = true;
         }
-    } else {
+    } else if (!uploadError) {
         Logger::error("Cannot write, file not open or previous error", "API::GIF");
     }
 }
@@ -146,13 +299,14 @@ void handleGifUploadWrite(HTTPUpload& upload, File& gifFile, bool& uploadError)
 /**
  * @brief Handle GIF upload end
  * @param currentFilename The current filename being uploaded
- * @param gifFile Reference to the File object for the GIF
+ * @param gifWriter Reference to the writer of the GIF
+ * @param uploadError Reference to the upload error flag
  *
  * @return void
  */
-void handleGifUploadEnd(const String& currentFilename, File& gifFile) {
-    if (gifFile) {
-        gifFile.close();
+void handleGifUploadEnd(const String& currentFilename, UploadWriter& gifWriter, bool& uploadError) {
+    if (gifWriter.isOpen() && !gifWriter.finish()) {
+        uploadError = true;
     }
 
     Logger::info((String("Gif upload end: ") + currentFilename).c_str(), "API::GIF");
@@ -161,50 +315,77 @@ void handleGifUploadEnd(const String& currentFilename, File& gifFile) {
 /**
  * @brief Handle GIF upload aborted
  * @param currentFilename The current filename being uploaded
- * @param gifFile Reference to the File object for the GIF
+ * @param gifWriter Reference to the writer of the GIF
  * @param uploadError Reference to the upload error flag
  *
  * @return void
  */
-void handleGifUploadAborted(const String& currentFilename, File& gifFile, bool& uploadError) {
+void handleGifUploadAborted(const String& currentFilename, UploadWriter& gifWriter, bool& uploadError) {
     Logger::warn("UPLOAD_FILE_ABORTED", "API::GIF");
-    if (gifFile) {
-        gifFile.close();
-        Logger::warn("File closed after abort", "API::GIF");
-    }
-    if (!currentFilename.isEmpty()) {
-        if (LittleFS.remove(currentFilename)) {
-            Logger::warn((String("Removed incomplete file: ") + currentFilename).c_str(), "API::GIF");
-        } else {
-            Logger::error((String("Failed to remove incomplete file: ") + currentFilename).c_str(), "API::GIF");
-        }
+    if (gifWriter.isOpen()) {
+        gifWriter.abort();
+        Logger::warn((String("Dropped incomplete upload of ") + currentFilename).c_str(), "API::GIF");
     }
     uploadError = true;
 }
 
+/**
+ * @brief HTTP status answering a failed upload
+ * @param failure Why the upload failed
+ *
+ * @return status code
+ */
+static auto uploadFailureCode(UploadFailure failure) -> int {
+    switch (failure) {
+        case UploadFailure::NoSpace:
+            return HTTP_CODE_PAYLOAD_TOO_LARGE;
+        case UploadFailure::Rejected:
+        case UploadFailure::BadChecksum:
+            return HTTP_CODE_BAD_REQUEST;
+        case UploadFailure::NoSession:
+            return HTTP_CODE_NOT_FOUND;
+        case UploadFailure::OutOfRange:
+            return HTTP_CODE_RANGE_NOT_SATISFIABLE;
+        default:
+            return HTTP_CODE_INTERNAL_ERROR;
+    }
+}
+
 /**
  * @brief Send GIF upload result
  * @param webserver Pointer to the Webserver instance
  * @param currentFilename The current filename being uploaded
  * @param uploadError The upload error flag
+ * @param gifWriter Writer of the GIF, gives the statistics or the reason of a failure
  *
  * @return void
  */
-void sendGifUploadResult(Webserver* webserver, const String& currentFilename, bool uploadError) {
+void sendGifUploadResult(Webserver* webserver, const String& currentFilename, bool uploadError,
+                         const UploadWriter& gifWriter) {
     JsonDocument doc;
+    int code = HTTP_CODE_OK;
     if (uploadError) {
+        const String& reason = gifWriter.getError();
+        code = uploadFailureCode(gifWriter.getFailure());
         doc["status"] = "error";
-        doc["message"] = "Error during GIF upload";
+        doc["message"] = reason.isEmpty() ? String("Error during GIF upload") : reason;
         Logger::error("GIF UPLOAD Error during upload", "API::GIF");
     } else {
+        const UploadStats stats = gifWriter.getStats();
         doc["status"] = "success";
         doc["message"] = "GIF uploaded successfully";
         doc["filename"] = currentFilename;
-        Logger::info((String("Gif upload success, filename: ") + currentFilename).c_str(), "API::GIF");
+        doc["bytes"] = stats.bytes;
+        doc["ms"] = stats.elapsedMs;
+        doc["kbps"] = stats.kbps;
+        doc["writes"] = stats.writes;
+        doc["sectorsUsed"] = stats.sectorsUsed;
+        Logger::info((String("Gif upload success, filename: ") + currentFilename + ", " + String(stats.kbps) +
+                      " KiB/s, " + String(stats.writes) + " writes, " + String(stats.sectorsUsed) + " sectors used")
+                         .c_str(),
+                     "API::GIF");
     }
-    String json;
-    serializeJson(doc, json);
-    webserver->raw().send(HTTP_CODE_OK, "application/json", json);
+    sendJson(webserver, code, doc);
 }
 
 /**
@@ -215,37 +396,45 @@ void sendGifUploadResult(Webserver* webserver, const String& currentFilename, bo
  */
 void handleGifUpload(Webserver* webserver) {
     HTTPUpload& upload = webserver->raw().upload();
-    static File gifFile;
+    static UploadWriter gifWriter;
     static bool uploadError = false;
 
-    String filename = upload.filename;
-    filename.replace("\\", "/");
-    filename = filename.substring(filename.lastIndexOf('/') + 1);
-    String currentFilename = "/gif/" + filename;
+    String currentFilename = gifUploadPath(upload.filename);
 
     switch (upload.status) {
         case UPLOAD_FILE_START:
-            handleGifUploadStart(currentFilename, gifFile, uploadError);
+            handleGifUploadStart(currentFilename, upload.contentLength, gifWriter, uploadError);
             break;
         case UPLOAD_FILE_WRITE:
-            handleGifUploadWrite(upload, gifFile, uploadError);
+            handleGifUploadWrite(upload, gifWriter, uploadError);
             break;
         case UPLOAD_FILE_END:
-            handleGifUploadEnd(currentFilename, gifFile);
+            handleGifUploadEnd(currentFilename, gifWriter, uploadError);
             break;
         case UPLOAD_FILE_ABORTED:
-            handleGifUploadAborted(currentFilename, gifFile, uploadError);
+            handleGifUploadAborted(currentFilename, gifWriter, uploadError);
             break;
         default:
             Logger::warn("Unknown upload status.", "API::GIF");
             break;
     }
 
-    if (upload.status == UPLOAD_FILE_END || upload.status == UPLOAD_FILE_ABORTED) {
-        sendGifUploadResult(webserver, currentFilename, uploadError);
+    // a refused header or a lack of space is answered right away, the server then stops reading the body
+    if (uploadError || upload.status == UPLOAD_FILE_END || upload.status == UPLOAD_FILE_ABORTED) {
+        sendGifUploadResult(webserver, currentFilename, uploadError, gifWriter);
     }
 }
 
+/**
+ * @brief Minimal firmware and filesystem upload page, kept for the first flash from the original firmware
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return void
+ */
+void handleLegacyUpdatePage(Webserver* webserver) {
+    webserver->raw().send(HTTP_CODE_OK, "text/html", LEGACY_UPDATE_PAGE);
+}
+
 /**
  * @brief Reboot endpoint
  * @param webserver Pointer to the Webserver instance
@@ -257,17 +446,14 @@ void handleReboot(Webserver* webserver) {
     int constexpr rebootDelayMs = 1000;
 
     doc["status"] = "rebooting";
-    String json;
-    serializeJson(doc, json);
-
-    webserver->raw().send(HTTP_CODE_OK, "application/json", json);
+    sendJson(webserver, HTTP_CODE_OK, doc);
 
     delay(rebootDelayMs);
     ESP.restart();  // NOLINT(readability-static-accessed-through-instance)
 }
 
 /**
- * @brief Handle OTA upload
+ * @brief Handle OTA upload, a plain, gzip or delta image, checked against ?sha256= when given
  * @param webserver Pointer to the Webserver instance
  * @param mode Update mode U_FLASH U_FS
  *
@@ -281,22 +467,11 @@ void handleOtaUpload(Webserver* webserver, int mode) {
             Logger::info(("OTA start: " + upload.filename).c_str(), "API::OTA");
 
             otaError = false;
-            otaSize = 0;
             otaStatus = "";
-            int constexpr security_space = 0x1000;
-            u_int constexpr bin_mask = 0xFFFFF000;
-
-            FSInfo fs_info;
-            LittleFS.info(fs_info);
-            size_t fsSize = fs_info.totalBytes;
-            size_t maxSketchSpace =
-                (ESP.getFreeSketchSpace() - security_space) &  // NOLINT(readability-static-accessed-through-instance)
-                bin_mask;
-            size_t place = (mode == U_FS) ? fsSize : maxSketchSpace;
-
-            if (!Update.begin(place, mode)) {
+
+            if (!otaStream.begin(mode, webserver->raw().arg("sha256"))) {
                 otaError = true;
-                otaStatus = Update.getErrorString();
+                otaStatus = otaStream.getError();
                 Logger::error(("Update.begin failed: " + otaStatus).c_str(), "API::OTA");
             }
 
@@ -304,13 +479,10 @@ void handleOtaUpload(Webserver* webserver, int mode) {
         }
 
         case UPLOAD_FILE_WRITE: {
-            if (!otaError) {
-                if (Update.write(upload.buf, upload.currentSize) != upload.currentSize) {
-                    otaError = true;
-                    otaStatus = Update.getErrorString();
-                    Logger::error(("Write failed: " + otaStatus).c_str(), "API::OTA");
-                }
-                otaSize += upload.currentSize;
+            if (!otaError && !otaStream.write(upload.buf, upload.currentSize)) {
+                otaError = true;
+                otaStatus = otaStream.getError();
+                Logger::error(("Write failed: " + otaStatus).c_str(), "API::OTA");
             }
 
             break;
@@ -318,17 +490,21 @@ void handleOtaUpload(Webserver* webserver, int mode) {
 
         case UPLOAD_FILE_END: {
             if (!otaError) {
-                if (Update.end(true)) {
+                if (otaStream.end()) {
                     if (mode == U_FS) {
                         Logger::info("OTA FS update complete, mounting file system...", "API::OTA");
                         LittleFS.begin();
                     }
 
-                    otaStatus = "Update OK (" + String(otaSize) + " bytes)";
-                    Logger::info(otaStatus.c_str(), "API::OTA");
+                    otaStatus = "Update OK (" + String(otaStream.getWritten()) + " bytes)";
+                    Logger::info((otaStatus + ", " + String(otaStream.getReceived()) + " bytes received as " +
+                                  OtaStream::formatName(otaStream.getFormat()) + " in " +
+                                  String(otaStream.getElapsedMs()) + " ms")
+                                     .c_str(),
+                                 "API::OTA");
                 } else {
                     otaError = true;
-                    otaStatus = Update.getErrorString();
+                    otaStatus = otaStream.getError();
                 }
             }
 
@@ -336,7 +512,7 @@ void handleOtaUpload(Webserver* webserver, int mode) {
         }
 
         case UPLOAD_FILE_ABORTED: {
-            Update.end();
+            otaStream.abort();
             otaError = true;
             otaStatus = "Update aborted";
 
@@ -357,17 +533,24 @@ void handleOtaUpload(Webserver* webserver, int mode) {
 void handleOtaFinished(Webserver* webserver) {
     JsonDocument doc;
     int constexpr rebootDelayMs = 5000;
+    float constexpr bytesPerKb = 1024.0F;
+    float constexpr msPerS = 1000.0F;
 
     doc["status"] = "Upload successful";
     doc["message"] = otaStatus;
+    doc["format"] = OtaStream::formatName(otaStream.getFormat());
+    doc["received"] = otaStream.getReceived();
+    doc["written"] = otaStream.getWritten();
+    doc["ms"] = otaStream.getElapsedMs();
+    doc["kbps"] = otaStream.getElapsedMs() > 0 ? static_cast<float>(otaStream.getReceived()) / bytesPerKb * msPerS /
+                                                     static_cast<float>(otaStream.getElapsedMs())
+                                               : 0.0F;
 
     if (otaError) {
         doc["status"] = "Error";
     }
 
-    String json;
-    serializeJson(doc, json);
-    webserver->raw().send(HTTP_CODE_OK, "application/json", json);
+    sendJson(webserver, HTTP_CODE_OK, doc);
 
     if (!otaError) {
         delay(rebootDelayMs);
@@ -376,96 +559,1281 @@ void handleOtaFinished(Webserver* webserver) {
 }
 
 /**
- * @brief Play a GIF from LittleFS full screen
+ * @brief Whether a path sent by a sync client can be written or deleted
+ * @param path Absolute path
  *
+ * @return false for relative paths, parent references, directories and the files of the upload machinery
+ */
+static auto isSyncPath(const String& path) -> bool {
+    return path.startsWith("/") && !path.endsWith("/") && path.indexOf("..") < 0 && path.indexOf("//") < 0 &&
+           !path.endsWith(UploadWriter::TEMP_SUFFIX) && path != ResumableUpload::SESSION_PATH;
+}
+
+/**
+ * @brief Answer with the state of the upload session, or the failure of the last call
  * @param webserver Pointer to the Webserver instance
+ * @param success Whether the call succeeded
  *
  * @return void
  */
-void handlePlayGif(Webserver* webserver) {
-    String body = webserver->raw().arg("plain");
+static void sendUploadSession(Webserver* webserver, bool success) {
     JsonDocument doc;
-    DeserializationError err = deserializeJson(doc, body);
-
-    if (err) {
-        JsonDocument resp;
+    int code = HTTP_CODE_OK;
 
-        resp["status"] = "error";
-        resp["message"] = "invalid json";
-
-        String jsonOut;
+    if (success) {
+        doc["status"] = "ok";
+    } else {
+        code = uploadFailureCode(resumableUpload.getFailure());
+        doc["status"] = "error";
+        doc["message"] = resumableUpload.getError();
+    }
 
-        serializeJson(resp, jsonOut);
+    if (resumableUpload.isActive()) {
+        doc["id"] = resumableUpload.getId();
+        doc["offset"] = resumableUpload.getOffset();
+        doc["size"] = resumableUpload.getSize();
+    }
 
-        webserver->raw().send(HTTP_CODE_INTERNAL_ERROR, "application/json", jsonOut);
+    sendJson(webserver, code, doc);
+}
 
+/**
+ * @brief Create a resumable upload session, or find the one of the same upload to resume it
+ *
+ * Body: {"target": "gif" | "file" | "firmware" | "filesystem", "name": file name for gif, "path": absolute path for
+ * file, "size": bytes}. A file target can write anywhere on LittleFS, it is how the file system is synced
+ *
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return void
+ */
+void handleUploadCreate(Webserver* webserver) {
+    JsonDocument doc;
+    if (readJsonBody(webserver, doc)) {
+        JsonDocument resp;
+        resp["status"] = "error";
+        resp["message"] = "Invalid JSON";
+        sendJson(webserver, HTTP_CODE_BAD_REQUEST, resp);
         return;
     }
 
-    const char* name = doc["name"];
-    if (name == nullptr || strlen(name) == 0) {
+    const String target = doc["target"] | "gif";
+    const String name = doc["name"] | "";
+    const String path = doc["path"] | "";
+    const size_t size = doc["size"] | static_cast<size_t>(0);
+    bool created = false;
+
+    if (target == "firmware" || target == "filesystem") {
+        const UploadTarget kind = target == "firmware" ? UploadTarget::Firmware : UploadTarget::Filesystem;
+        created = resumableUpload.create(kind, String(), size);
+    } else if (target == "file" && isSyncPath(path)) {
+        created = resumableUpload.create(UploadTarget::File, path, size);
+    } else if (target == "gif" && !name.isEmpty()) {
+        const String gifPath = gifUploadPath(name);
+        size_t headerSize = 0;
+        UploadWriter::THeaderCheck check = uploadHeaderCheck(gifPath, headerSize);
+        ensureGifDirectory();
+        created = resumableUpload.create(UploadTarget::File, gifPath, size, headerSize, check);
+    } else {
         JsonDocument resp;
         resp["status"] = "error";
-        resp["message"] = "missing name";
+        resp["message"] = "target must be gif (with a name), file (with a path), firmware or filesystem";
+        sendJson(webserver, HTTP_CODE_BAD_REQUEST, resp);
+        return;
+    }
 
-        String jsonOut;
-        serializeJson(resp, jsonOut);
-        webserver->raw().send(HTTP_CODE_INTERNAL_ERROR, "application/json", jsonOut);
+    sendUploadSession(webserver, created);
+}
 
+/**
+ * @brief State of the upload session, offset is where the next range starts
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return void
+ */
+void handleUploadStatus(Webserver* webserver) {
+    if (!resumableUpload.isActive()) {
+        JsonDocument resp;
+        resp["status"] = "error";
+        resp["message"] = "No upload session";
+        sendJson(webserver, HTTP_CODE_NOT_FOUND, resp);
         return;
     }
 
-    String filename(name);
-    filename.replace("\\", "/");
-    filename = filename.substring(filename.lastIndexOf('/') + 1);
+    sendUploadSession(webserver, true);
+}
 
-    String path1 = String("/gifs/") + filename;
-    String path2 = String("/gif/") + filename;
-    String foundPath;
+/**
+ * @brief Write one range of the upload, PUT /api/v1/upload?id= with Content-Range and the raw bytes as body
+ *
+ * A range has to start at the committed offset and fit in a request body (HttpServer::MAX_BODY), otherwise the
+ * answer is 416 with the offset to continue from
+ *
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return void
+ */
+void handleUploadRange(Webserver* webserver) {
+    const String& body = webserver->raw().body();
+    ContentRange range;
 
-    if (LittleFS.exists(path1)) {
-        foundPath = path1;
-    } else if (LittleFS.exists(path2)) {
-        foundPath = path2;
-    } else {
+    if (!ContentRange::parse(webserver->raw().header("Content-Range").c_str(), range) ||
+        range.end - range.start != body.length() ||
+        (resumableUpload.isActive() && range.total != resumableUpload.getSize())) {
         JsonDocument resp;
-
         resp["status"] = "error";
-        resp["message"] = "file not found";
+        resp["message"] = "Content-Range must be bytes first-last/size and match the body";
+        sendJson(webserver, HTTP_CODE_BAD_REQUEST, resp);
+        return;
+    }
+
+    const bool written = resumableUpload.write(webserver->raw().arg("id"), range.start,
+                                               reinterpret_cast<const uint8_t*>(body.c_str()), body.length());
+
+    sendUploadSession(webserver, written);
+}
+
+/**
+ * @brief Check the MD5 of the complete upload and install it, body {"md5": hex digest}
+ *
+ * A GIF replaces the file of the same name, a firmware or file system image is activated and the device reboots
+ *
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return void
+ */
+void handleUploadFinish(Webserver* webserver) {
+    JsonDocument doc;
+    readJsonBody(webserver, doc);
 
-        String jsonOut;
-        serializeJson(resp, jsonOut);
+    const UploadTarget target = resumableUpload.getTarget();
+    const String path = resumableUpload.getPath();
+    const bool installed = resumableUpload.finish(webserver->raw().arg("id"), doc["md5"] | "");
 
-        webserver->raw().send(HTTP_CODE_NOT_FOUND, "application/json", jsonOut);
+    if (!installed) {
+        sendUploadSession(webserver, false);
+        return;
+    }
 
+    JsonDocument resp;
+    resp["status"] = "success";
+    if (target == UploadTarget::File) {
+        resp["filename"] = path;
+        sendJson(webserver, HTTP_CODE_OK, resp);
         return;
     }
 
-    bool playOk = DisplayManager::playGifFullScreen(foundPath);
+    int constexpr rebootDelayMs = 5000;
+
+    resp["message"] = "Update OK, rebooting";
+    sendJson(webserver, HTTP_CODE_OK, resp);
+
+    delay(rebootDelayMs);
+    ESP.restart();  // NOLINT(readability-static-accessed-through-instance)
+}
 
+/**
+ * @brief Drop the upload session ?id= and what it wrote
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return void
+ */
+void handleUploadCancel(Webserver* webserver) {
     JsonDocument resp;
+    const bool cancelled = resumableUpload.cancel(webserver->raw().arg("id"));
 
-    resp["status"] = playOk ? "playing" : "error";
-    resp["file"] = foundPath;
+    resp["status"] = cancelled ? "deleted" : "error";
+
+    sendJson(webserver, cancelled ? HTTP_CODE_OK : HTTP_CODE_NOT_FOUND, resp);
+}
 
-    String jsonOut;
+/**
+ * @brief Walk of the file system for the manifest, carried across the calls of the list producer
+ */
+struct ManifestWalk {
+    std::vector<std::pair<String, Dir>> stack;  // depth first, one directory handle per level
+    FileMd5 hash;                               // file whose entry is sent once its digest is ready
+    size_t size = 0;
+    bool hashing = false;
+};
+
+/**
+ * @brief Move the walk to the next file to list and start hashing it
+ * @param walk Manifest walk
+ *
+ * @return false once every directory is done
+ */
+static auto nextManifestFile(ManifestWalk& walk) -> bool {
+    while (!walk.stack.empty()) {
+        Dir& dir = walk.stack.back().second;
+        if (!dir.next()) {
+            walk.stack.pop_back();
+            continue;
+        }
+
+        const String path = walk.stack.back().first + "/" + dir.fileName();
+        if (dir.isDirectory()) {
+            walk.stack.emplace_back(path, LittleFS.openDir(path));
+            continue;
+        }
+
+        if (!isSyncPath(path)) {
+            continue;
+        }
+
+        walk.size = dir.fileSize();
+        (void)walk.hash.begin(path);  // a file that cannot be read is listed with an empty md5
 
-    serializeJson(resp, jsonOut);
-    webserver->raw().send(HTTP_CODE_OK, "application/json", jsonOut);
+        return true;
+    }
+
+    return false;
 }
 
 /**
- * @brief Stop currently playing GIF
+ * @brief Every file of LittleFS with its size and MD5, under ?dir= if given, for a client to sync the file system
+ *
+ * The list is streamed and the files are hashed in slices of MANIFEST_HASH_SLICE_US, one per pass of the HTTP task:
+ * a large GIF delays its own entry, not the frames or the other clients. Partial uploads are left out
+ *
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return void
  */
-void handleStopGif(Webserver* webserver) {
+void handleFsManifest(Webserver* webserver) {
+    JsonDocument head;
+    FSInfo info;
+    if (LittleFS.info(info)) {
+        head["total"] = info.totalBytes;
+        head["used"] = info.usedBytes;
+    }
+
+    String root = webserver->raw().arg("dir");
+    while (root.endsWith("/")) {
+        root.remove(root.length() - 1);
+    }
+
+    auto walk = std::make_shared<ManifestWalk>();
+    walk->stack.emplace_back(root, LittleFS.openDir(root.isEmpty() ? String("/") : root));
+
+    sendJsonList(webserver, head, "files", SIZE_MAX, [walk](JsonDocument& item, String& cursor) -> JsonListStep {
+        if (!walk->hashing && !nextManifestFile(*walk)) {
+            return JsonListStep::End;
+        }
+
+        walk->hashing = !walk->hash.step(MANIFEST_HASH_SLICE_US);
+        if (walk->hashing) {
+            return JsonListStep::Pending;
+        }
+
+        item["path"] = walk->hash.getPath();
+        item["size"] = walk->size;
+        item["md5"] = walk->hash.getDigest();
+        cursor = walk->hash.getPath();
+
+        return JsonListStep::Item;
+    });
+}
+
+/**
+ * @brief Delete the file ?path=, empty directories go with their last file
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return void
+ */
+void handleFsDelete(Webserver* webserver) {
     JsonDocument resp;
+    const String path = webserver->raw().arg("path");
+
+    if (!isSyncPath(path)) {
+        resp["status"] = "error";
+        resp["message"] = "Invalid path";
+        sendJson(webserver, HTTP_CODE_BAD_REQUEST, resp);
+        return;
+    }
+
+    const bool removed = LittleFS.remove(path);
+    if (removed) {
+        Logger::info((String("Deleted ") + path).c_str(), "API::FS");
+    }
+
+    resp["status"] = removed ? "deleted" : "error";
+
+    sendJson(webserver, removed ? HTTP_CODE_OK : HTTP_CODE_NOT_FOUND, resp);
+}
+
+/**
+ * @brief Read colour effect settings from a JSON object, missing keys keep the base value
+ *
+ * @param obj JSON object with optional brightness, temperature and greyscale keys
+ * @param base Settings to start from
+ *
+ * @return merged settings
+ */
+static auto readColorFxSettings(JsonVariantConst obj, ColorFxSettings base) -> ColorFxSettings {
+    base.brightness = obj["brightness"] | base.brightness;
+    base.temperature = obj["temperature"] | base.temperature;
+    base.greyscale = obj["greyscale"] | base.greyscale;
 
-    const bool stopped = DisplayManager::stopGif();
+    return base;
+}
+
+/**
+ * @brief Queue a display command and answer with its id, the screen changes on the next display update
+ *
+ * @param webserver Pointer to the Webserver instance
+ * @param command Command to queue
+ * @param resp Response with the command specific fields already set
+ *
+ * @return void
+ */
+static void sendQueuedCommand(Webserver* webserver, DisplayCommand& command, JsonDocument& resp) {
+    const uint32_t commandId = DisplayManager::queueCommand(command);
+    int code = HTTP_CODE_ACCEPTED;
 
-    resp["status"] = stopped ? "stopped" : "error";
+    if (commandId == 0) {
+        resp.clear();
+        resp["status"] = "error";
+        resp["message"] = "display busy";
+        code = HTTP_CODE_SERVICE_UNAVAILABLE;
+    } else {
+        resp["status"] = "queued";
+        resp["id"] = commandId;
+    }
 
-    String jsonOut;
-    serializeJson(resp, jsonOut);
+    sendJson(webserver, code, resp);
+}
 
-    webserver->raw().send(HTTP_CODE_OK, "application/json", jsonOut);
-}
\ No newline at end of file
+/**
+ * @brief Queue a procedural effect and send the play response
+ *
+ * @param webserver Pointer to the Webserver instance
+ * @param name Effect name
+ *
+ * @return void
+ */
+static void playEffect(Webserver* webserver, const String& name) {
+    JsonDocument resp;
+    DisplayCommand command;
+
+    command.type = DisplayCommandType::PlayEffect;
+
+    if (!Effects::parseType(name, command.effect)) {
+        resp["status"] = "error";
+        resp["message"] = "unknown effect";
+
+        sendJson(webserver, HTTP_CODE_BAD_REQUEST, resp);
+
+        return;
+    }
+
+    resp["effect"] = Effects::typeName(command.effect);
+    sendQueuedCommand(webserver, command, resp);
+}
+
+/**
+ * @brief Play a GIF from LittleFS full screen, or a procedural effect when the body has "effect" instead of "name"
+ *
+ * The file is checked here, the playback itself is queued: the answer carries the command id for
+ * GET /api/v1/display/command?id=
+ *
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return void
+ */
+void handlePlayGif(Webserver* webserver) {
+    JsonDocument doc;
+    DeserializationError err = readJsonBody(webserver, doc);
+
+    if (err) {
+        JsonDocument resp;
+
+        resp["status"] = "error";
+        resp["message"] = "invalid json";
+
+        sendJson(webserver, HTTP_CODE_INTERNAL_ERROR, resp);
+
+        return;
+    }
+
+    if (doc["effect"].is<const char*>()) {
+        playEffect(webserver, doc["effect"].as<String>());
+
+        return;
+    }
+
+    const char* name = doc["name"];
+    if (name == nullptr || strlen(name) == 0) {
+        JsonDocument resp;
+        resp["status"] = "error";
+        resp["message"] = "missing name";
+
+        sendJson(webserver, HTTP_CODE_INTERNAL_ERROR, resp);
+
+        return;
+    }
+
+    String filename(name);
+    filename.replace("\\", "/");
+    filename = filename.substring(filename.lastIndexOf('/') + 1);
+
+    String path1 = String("/gifs/") + filename;
+    String path2 = String("/gif/") + filename;
+    String foundPath;
+
+    if (LittleFS.exists(path1)) {
+        foundPath = path1;
+    } else if (LittleFS.exists(path2)) {
+        foundPath = path2;
+    } else {
+        JsonDocument resp;
+
+        resp["status"] = "error";
+        resp["message"] = "file not found";
+
+        sendJson(webserver, HTTP_CODE_NOT_FOUND, resp);
+
+        return;
+    }
+
+    DisplayCommand command;
+
+    command.type = DisplayCommandType::PlayGif;
+    command.path = foundPath;
+    command.hasFx = doc["fx"].is<JsonObjectConst>();
+    if (command.hasFx) {
+        command.fx = readColorFxSettings(doc["fx"], DisplayManager::getConfiguredColorFx());
+    }
+    command.fadeFrames = doc["fadeIn"] | 0;
+    command.fadeToWhite = strcmp(doc["fadeColor"] | "black", "white") == 0;
+
+    JsonDocument resp;
+
+    resp["file"] = foundPath;
+    sendQueuedCommand(webserver, command, resp);
+}
+
+/**
+ * @brief Stop currently playing GIF
+ */
+void handleStopGif(Webserver* webserver) {
+    JsonDocument resp;
+    DisplayCommand command;
+
+    command.type = DisplayCommandType::StopGif;
+    sendQueuedCommand(webserver, command, resp);
+}
+
+/**
+ * @brief Status of a display command queued by the endpoints that change the screen
+ *
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return void
+ */
+void handleGetCommandStatus(Webserver* webserver) {
+    JsonDocument resp;
+    const uint32_t commandId = static_cast<uint32_t>(webserver->raw().arg("id").toInt());
+    const DisplayCommandStatus status = DisplayManager::getCommandStatus(commandId);
+
+    resp["id"] = commandId;
+    resp["status"] = DisplayCommandQueue::statusName(status);
+
+    sendJson(webserver, status == DisplayCommandStatus::Unknown ? HTTP_CODE_NOT_FOUND : HTTP_CODE_OK, resp);
+}
+
+/**
+ * @brief List compressed images in /img with their decode time counters, paginated with ?limit= and ?cursor=
+ *
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return void
+ */
+void handleListImages(Webserver* webserver) {
+    JsonDocument head;
+    Dir dir = LittleFS.openDir("/img");
+    String after = webserver->raw().arg("cursor");
+
+    sendJsonList(webserver, head, "files", listLimit(webserver),
+                 [dir, after](JsonDocument& item, String& cursor) mutable -> JsonListStep {
+                     while (dir.next()) {
+                         String name = dir.fileName();
+
+                         if (!ImageAsset::isImagePath(name) || !pastCursor(name, after)) {
+                             continue;
+                         }
+
+                         item["name"] = name;
+                         item["size"] = dir.fileSize();
+                         cursor = name;
+
+                         for (const auto& stats : DisplayManager::getImageStats()) {
+                             if (stats.path == "/img/" + name) {
+                                 item["draws"] = stats.draws;
+                                 item["lastUs"] = stats.lastUs;
+                                 item["maxUs"] = stats.maxUs;
+                                 item["avgUs"] = stats.draws > 0 ? stats.totalUs / stats.draws : 0;
+                             }
+                         }
+
+                         return JsonListStep::Item;
+                     }
+
+                     return JsonListStep::End;
+                 });
+}
+
+/**
+ * @brief Queue the drawing of a compressed image from /img at a given position
+ *
+ * Body: {"name": "logo.gmi", "x": 0, "y": 0}, optional "transition" ("crossfade", "wipe", "dissolve") and
+ * "durationMs" replace the current picture progressively instead of clearing the screen first
+ *
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return void
+ */
+void handleDrawImage(Webserver* webserver) {
+    JsonDocument doc;
+    JsonDocument resp;
+
+    if (readJsonBody(webserver, doc)) {
+        resp["status"] = "error";
+        resp["message"] = "invalid json";
+        sendJson(webserver, HTTP_CODE_BAD_REQUEST, resp);
+
+        return;
+    }
+
+    String filename = doc["name"] | "";
+    filename.replace("\\", "/");
+    filename = filename.substring(filename.lastIndexOf('/') + 1);
+
+    const String path = "/img/" + filename;
+
+    if (filename.isEmpty() || !LittleFS.exists(path)) {
+        resp["status"] = "error";
+        resp["message"] = "file not found";
+        sendJson(webserver, HTTP_CODE_NOT_FOUND, resp);
+
+        return;
+    }
+
+    DisplayCommand command;
+
+    command.type = DisplayCommandType::DrawImage;
+    command.path = path;
+    command.xPos = doc["x"] | 0;
+    command.yPos = doc["y"] | 0;
+    command.transition = Transition::parseType(doc["transition"] | "");
+    command.durationMs = doc["durationMs"] | DEFAULT_TRANSITION_MS;
+
+    resp["file"] = path;
+    sendQueuedCommand(webserver, command, resp);
+}
+
+/**
+ * @brief Queue text for the hardware scrolled on-screen console
+ *
+ * Body: {"text": "line one\nline two"}
+ *
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return void
+ */
+void handleConsolePrint(Webserver* webserver) {
+    JsonDocument doc;
+    JsonDocument resp;
+
+    if (readJsonBody(webserver, doc)) {
+        resp["status"] = "error";
+        resp["message"] = "invalid json";
+        sendJson(webserver, HTTP_CODE_BAD_REQUEST, resp);
+
+        return;
+    }
+
+    DisplayCommand command;
+
+    command.type = DisplayCommandType::ConsolePrint;
+    command.text = doc["text"] | "";
+
+    sendQueuedCommand(webserver, command, resp);
+}
+
+/**
+ * @brief Counters of the remote frame stream (UDP)
+ *
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return void
+ */
+void handleGetStreamStats(Webserver* webserver) {
+    JsonDocument resp;
+    const FrameStreamStats stats = FrameStream::getStats();
+
+    resp["port"] = stats.port;
+    resp["active"] = stats.active;
+    resp["packets"] = stats.packets;
+    resp["frames"] = stats.frames;
+    resp["bytes"] = stats.bytes;
+    resp["dropped"] = stats.dropped;
+    resp["errors"] = stats.errors;
+    resp["fps"] = stats.fps;
+    resp["lastLatencyUs"] = stats.lastLatencyUs;
+    resp["maxLatencyUs"] = stats.maxLatencyUs;
+
+    sendJson(webserver, HTTP_CODE_OK, resp);
+}
+
+/**
+ * @brief Runtime accounting of the main loop tasks
+ *
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return void
+ */
+void handleGetSchedulerStats(Webserver* webserver) {
+    JsonDocument resp;
+    const SchedulerStats stats = Scheduler::getStats();
+
+    resp["passes"] = stats.passes;
+    resp["busy"] = stats.busy;
+    resp["maxPassUs"] = stats.maxPassUs;
+
+    JsonArray tasks = resp["tasks"].to<JsonArray>();
+    for (size_t i = 0; i < Scheduler::getTaskCount(); ++i) {
+        const SchedulerTaskStats task = Scheduler::getTaskStats(i);
+        JsonObject obj = tasks.add<JsonObject>();
+
+        obj["name"] = task.name;
+        obj["priority"] = task.priority;
+        obj["periodUs"] = task.periodUs;
+        obj["deadlineUs"] = task.deadlineUs;
+        obj["budgetUs"] = task.budgetUs;
+        obj["runs"] = task.runs;
+        obj["totalMs"] = static_cast<uint32_t>(task.totalUs / 1000);  // NOLINT(readability-magic-numbers)
+        obj["maxUs"] = task.maxUs;
+        obj["overruns"] = task.overruns;
+        obj["missed"] = task.missed;
+        obj["maxLatencyUs"] = task.maxLatencyUs;
+        obj["load"] = task.load;
+    }
+
+    sendJson(webserver, HTTP_CODE_OK, resp);
+}
+
+/**
+ * @brief Clock state and current time
+ *
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return void
+ */
+void handleGetClock(Webserver* webserver) {
+    JsonDocument resp;
+    struct tm local {};
+
+    resp["running"] = DisplayManager::isClockRunning();
+    resp["synced"] = TimeSync::getLocalTime(local);
+    resp["server"] = configManager.getNtpServer();
+    resp["timezone"] = configManager.getTimezone();
+
+    if (resp["synced"].as<bool>()) {
+        char text[CLOCK_TIME_TEXT_MAX];
+
+        strftime(text, sizeof(text), "%Y-%m-%d %H:%M:%S", &local);
+        resp["time"] = text;
+    }
+
+    sendJson(webserver, HTTP_CODE_OK, resp);
+}
+
+/**
+ * @brief Queue showing or leaving the clock face
+ *
+ * Body: {"enabled": true}, disabling it clears the screen
+ *
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return void
+ */
+void handleSetClock(Webserver* webserver) {
+    JsonDocument doc;
+    JsonDocument resp;
+
+    if (readJsonBody(webserver, doc)) {
+        resp["status"] = "error";
+        resp["message"] = "invalid json";
+        sendJson(webserver, HTTP_CODE_BAD_REQUEST, resp);
+
+        return;
+    }
+
+    DisplayCommand command;
+
+    command.type = DisplayCommandType::Clock;
+    command.enabled = doc["enabled"] | true;
+
+    resp["enabled"] = command.enabled;
+    sendQueuedCommand(webserver, command, resp);
+}
+
+/**
+ * @brief Fade the current animation out to black or white
+ *
+ * Body: {"frames": 15, "color": "black"}. The picture stays black/white until the next play
+ *
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return void
+ */
+void handleFadeGif(Webserver* webserver) {
+    JsonDocument doc;
+    JsonDocument resp;
+
+    readJsonBody(webserver, doc);
+
+    DisplayCommand command;
+
+    command.type = DisplayCommandType::Fade;
+    command.fadeFrames = doc["frames"] | 15;
+    command.fadeToWhite = strcmp(doc["color"] | "black", "white") == 0;
+
+    resp["frames"] = command.fadeFrames;
+    sendQueuedCommand(webserver, command, resp);
+}
+
+/**
+ * @brief Send the global colour effect settings
+ *
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return void
+ */
+void handleGetColorFx(Webserver* webserver) {
+    JsonDocument resp;
+
+    resp["brightness"] = configManager.getFxBrightness();
+    resp["temperature"] = configManager.getFxTemperature();
+    resp["greyscale"] = configManager.getFxGreyscale();
+
+    sendJson(webserver, HTTP_CODE_OK, resp);
+}
+
+/**
+ * @brief Change the global colour effect settings (night mode, tint...) until reboot
+ *
+ * Body: {"brightness": 40, "temperature": 60, "greyscale": false}, missing keys are unchanged. The settings are
+ * stored right away and applied to the screen by a queued command, after the changes requested before
+ *
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return void
+ */
+void handleSetColorFx(Webserver* webserver) {
+    JsonDocument doc;
+
+    if (readJsonBody(webserver, doc)) {
+        JsonDocument resp;
+
+        resp["status"] = "error";
+        resp["message"] = "invalid json";
+        sendJson(webserver, HTTP_CODE_BAD_REQUEST, resp);
+
+        return;
+    }
+
+    ColorFxSettings current;
+    current.brightness = configManager.getFxBrightness();
+    current.temperature = configManager.getFxTemperature();
+    current.greyscale = configManager.getFxGreyscale();
+
+    const ColorFxSettings settings = readColorFxSettings(doc.as<JsonVariantConst>(), current);
+
+    configManager.setFx(settings.brightness, settings.temperature, settings.greyscale);
+
+    JsonDocument resp;
+    DisplayCommand command;
+
+    command.type = DisplayCommandType::ApplyColorFx;
+
+    resp["brightness"] = settings.brightness;
+    resp["temperature"] = settings.temperature;
+    resp["greyscale"] = settings.greyscale;
+    sendQueuedCommand(webserver, command, resp);
+}
+
+/**
+ * @brief Send the animated viewports with their frame rate
+ *
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return void
+ */
+void handleGetViewports(Webserver* webserver) {
+    JsonDocument resp;
+    JsonArray viewports = resp["viewports"].to<JsonArray>();
+
+    for (const auto& stats : DisplayManager::getViewportStats()) {
+        JsonObject obj = viewports.add<JsonObject>();
+
+        obj["name"] = stats.path;        // NOLINT(readability-misplaced-array-index)
+        obj["x"] = stats.xPos;           // NOLINT(readability-misplaced-array-index)
+        obj["y"] = stats.yPos;           // NOLINT(readability-misplaced-array-index)
+        obj["w"] = stats.width;          // NOLINT(readability-misplaced-array-index)
+        obj["h"] = stats.height;         // NOLINT(readability-misplaced-array-index)
+        obj["playing"] = stats.playing;  // NOLINT(readability-misplaced-array-index)
+        obj["frames"] = stats.frames;    // NOLINT(readability-misplaced-array-index)
+        obj["fps"] = stats.fps;          // NOLINT(readability-misplaced-array-index)
+    }
+
+    sendJson(webserver, HTTP_CODE_OK, resp);
+}
+
+/**
+ * @brief List the procedural effects and the frame rate of the current one
+ *
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return void
+ */
+void handleListEffects(Webserver* webserver) {
+    JsonDocument resp;
+    JsonArray effects = resp["effects"].to<JsonArray>();
+    const EffectStats stats = DisplayManager::getEffectStats();
+
+    for (uint8_t i = 0; i < Effects::EFFECT_COUNT; i++) {
+        effects.add(Effects::typeName(static_cast<EffectType>(i)));
+    }
+
+    resp["current"] = stats.playing ? stats.name : String();
+    resp["frames"] = stats.frames;
+    resp["fps"] = stats.fps;
+
+    sendJson(webserver, HTTP_CODE_OK, resp);
+}
+
+/**
+ * @brief Queue replacing the screen with several animations, each one in its own viewport
+ *
+ * Body: {"viewports": [{"name": "clock.gif", "x": 0, "y": 0, "w": 120, "h": 120}, ...]}, an empty list stops them.
+ * Missing files are answered in "failed" and left out, a viewport the display refuses fails the command
+ *
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return void
+ */
+void handleSetViewports(Webserver* webserver) {
+    JsonDocument doc;
+    JsonDocument resp;
+
+    if (readJsonBody(webserver, doc)) {
+        resp["status"] = "error";
+        resp["message"] = "invalid json";
+        sendJson(webserver, HTTP_CODE_BAD_REQUEST, resp);
+
+        return;
+    }
+
+    DisplayCommand command;
+    JsonArray failed = resp["failed"].to<JsonArray>();
+
+    command.type = DisplayCommandType::SetViewports;
+
+    for (JsonObjectConst viewport : doc["viewports"].as<JsonArrayConst>()) {
+        String filename = viewport["name"] | "";
+        filename.replace("\\", "/");
+        filename = filename.substring(filename.lastIndexOf('/') + 1);
+
+        DisplayOp op;
+
+        op.type = DisplayOpType::Gif;
+        op.xPos = viewport["x"] | 0;
+        op.yPos = viewport["y"] | 0;
+        op.width = viewport["w"] | 0;
+        op.height = viewport["h"] | 0;
+        op.text = String("/gif/") + filename;
+        if (!LittleFS.exists(op.text)) {
+            op.text = String("/gifs/") + filename;
+        }
+
+        if (filename.isEmpty() || !LittleFS.exists(op.text) || !command.list.add(op)) {
+            failed.add(filename);
+        }
+    }
+
+    resp["count"] = command.list.getOps().size();
+    sendQueuedCommand(webserver, command, resp);
+}
+
+/**
+ * @brief Send the panel picture settings (backlight level, gamma and contrast steps)
+ *
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return void
+ */
+void handleGetPanelProfile(Webserver* webserver) {
+    JsonDocument resp;
+
+    resp["backlight"] = configManager.getLCDBacklightLevel();
+    resp["gamma"] = configManager.getLCDGamma();
+    resp["contrast"] = configManager.getLCDContrast();
+
+    sendJson(webserver, HTTP_CODE_OK, resp);
+}
+
+/**
+ * @brief Change the backlight level and the gamma tables without re-initializing the panel
+ *
+ * Body: {"backlight": 60, "gamma": 2, "contrast": -1}, missing keys are unchanged
+ *
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return void
+ */
+void handleSetPanelProfile(Webserver* webserver) {
+    JsonDocument doc;
+
+    if (readJsonBody(webserver, doc)) {
+        JsonDocument resp;
+
+        resp["status"] = "error";
+        resp["message"] = "invalid json";
+        sendJson(webserver, HTTP_CODE_BAD_REQUEST, resp);
+
+        return;
+    }
+
+    const uint8_t backlight = doc["backlight"] | configManager.getLCDBacklightLevel();
+    const int8_t gamma = doc["gamma"] | configManager.getLCDGamma();
+    const int8_t contrast = doc["contrast"] | configManager.getLCDContrast();
+
+    DisplayManager::setPanelProfile(backlight, gamma, contrast);
+
+    handleGetPanelProfile(webserver);
+}
+
+/**
+ * @brief Read a colour given as an RGB565 number or as an "#RRGGBB" string
+ *
+ * @param value JSON value
+ * @param fallback Colour returned when the value is missing or malformed
+ *
+ * @return RGB565 colour
+ */
+static auto readColor(JsonVariantConst value, uint16_t fallback) -> uint16_t {
+    if (value.is<uint16_t>()) {
+        return value.as<uint16_t>();
+    }
+
+    const char* text = value | "";
+
+    if (text[0] != '#' || strlen(text) != 7) {
+        return fallback;
+    }
+
+    char* end = nullptr;
+    const uint32_t rgb = strtoul(text + 1, &end, 16);
+
+    if (*end != '\0') {
+        return fallback;
+    }
+
+    return static_cast<uint16_t>(((rgb >> 8) & 0xF800) | ((rgb >> 5) & 0x07E0) | ((rgb >> 3) & 0x001F));
+}
+
+/**
+ * @brief Path of a stored scene
+ *
+ * @param name Scene name, 1 to 32 letters, digits, '-' or '_'
+ * @param path Receives /scenes/<name>.dl
+ *
+ * @return false if the name is invalid
+ */
+static auto scenePath(const String& name, String& path) -> bool {
+    if (name.isEmpty() || name.length() > SCENE_NAME_MAX) {
+        return false;
+    }
+
+    for (size_t i = 0; i < name.length(); i++) {
+        if (!isalnum(name[i]) && name[i] != '-' && name[i] != '_') {
+            return false;
+        }
+    }
+
+    path = String(SCENE_DIR) + "/" + name + ".dl";
+
+    return true;
+}
+
+/**
+ * @brief Decode one compact operation of a display list
+ *
+ * ["fill", x, y, w, h, color], ["rect", x, y, w, h, color], ["line", x0, y0, x1, y1, color],
+ * ["text", x, y, "text", size, color, bg], ["image", x, y, "name.gmi"], ["gif", x, y, w, h, "name.gif"].
+ * Colours are RGB565 numbers or "#RRGGBB" strings, a text without bg is drawn transparent
+ *
+ * @param item JSON array of the operation
+ * @param op Receives the operation
+ * @param error Receives the reason of a failure
+ *
+ * @return false if the operation is unknown or refers to a missing file
+ */
+static auto readDisplayOp(JsonArrayConst item, DisplayOp& op, String& error) -> bool {
+    const String name = item[0] | "";
+
+    if (!DisplayList::parseType(name, op.type)) {
+        error = "unknown op " + name;
+
+        return false;
+    }
+
+    op.xPos = item[1] | 0;
+    op.yPos = item[2] | 0;
+
+    switch (op.type) {
+        case DisplayOpType::Fill:
+        case DisplayOpType::Rect:
+        case DisplayOpType::Line:
+            op.width = item[3] | 0;
+            op.height = item[4] | 0;
+            op.color = readColor(item[5], LCD_WHITE);
+
+            return true;
+
+        case DisplayOpType::Text:
+            op.text = item[3] | "";
+            op.size = item[4] | 1;
+            op.color = readColor(item[5], LCD_WHITE);
+            op.bgColor = readColor(item[6], op.color);
+
+            return true;
+
+        case DisplayOpType::Image: {
+            String filename = item[3] | "";
+            filename = filename.substring(filename.lastIndexOf('/') + 1);
+            op.text = "/img/" + filename;
+
+            if (!ImageAsset::isImagePath(filename) || !LittleFS.exists(op.text)) {
+                error = "image not found " + filename;
+
+                return false;
+            }
+
+            return true;
+        }
+
+        case DisplayOpType::Gif: {
+            String filename = item[5] | "";
+            filename = filename.substring(filename.lastIndexOf('/') + 1);
+            op.width = item[3] | 0;
+            op.height = item[4] | 0;
+            op.text = "/gif/" + filename;
+
+            if (!LittleFS.exists(op.text)) {
+                op.text = "/gifs/" + filename;
+            }
+
+            if (filename.isEmpty() || !LittleFS.exists(op.text)) {
+                error = "gif not found " + filename;
+
+                return false;
+            }
+
+            return true;
+        }
+
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief Queue the drawing of a list and answer with the command id
+ *
+ * @param webserver Pointer to the Webserver instance
+ * @param list Optimized display list, moved into the command
+ * @param resp Response with the request specific fields already set
+ *
+ * @return void
+ */
+static void sendQueuedList(Webserver* webserver, DisplayList& list, JsonDocument& resp) {
+    DisplayCommand command;
+
+    command.type = DisplayCommandType::DrawList;
+    command.list = std::move(list);
+
+    resp["executed"] = command.list.getOps().size();
+    sendQueuedCommand(webserver, command, resp);
+}
+
+/**
+ * @brief Queue a batch of operations drawn in one display update, optionally stored as a named scene
+ *
+ * Body: {"clear": "#000000", "ops": [["fill", 0, 0, 240, 60, "#202040"], ["text", 8, 20, "CPU 42%", 2, "#FFFFFF"]],
+ * "save": "status"}. "clear" fills the whole screen first, "save" stores the optimized list for
+ * POST /api/v1/scenes/play. Without "clear" the operations draw over the current screen
+ *
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return void
+ */
+void handleDrawList(Webserver* webserver) {
+    JsonDocument doc;
+    JsonDocument resp;
+
+    if (readJsonBody(webserver, doc)) {
+        resp["status"] = "error";
+        resp["message"] = "invalid json";
+        sendJson(webserver, HTTP_CODE_BAD_REQUEST, resp);
+
+        return;
+    }
+
+    DisplayList list;
+    String error;
+    String path;
+    const String sceneName = doc["save"] | "";
+
+    if (!sceneName.isEmpty() && !scenePath(sceneName, path)) {
+        error = "invalid scene name";
+    }
+
+    if (error.isEmpty() && !doc["clear"].isNull()) {
+        DisplayOp clear;
+        const Arduino_GFX* gfx = DisplayManager::getGfx();
+
+        clear.width = static_cast<int16_t>(gfx != nullptr ? gfx->width() : 0);
+        clear.height = static_cast<int16_t>(gfx != nullptr ? gfx->height() : 0);
+        clear.color = readColor(doc["clear"], LCD_BLACK);
+        list.add(clear);
+    }
+
+    for (JsonArrayConst item : doc["ops"].as<JsonArrayConst>()) {
+        DisplayOp op;
+
+        if (!error.isEmpty()) {
+            break;
+        }
+
+        if (readDisplayOp(item, op, error) && !list.add(op)) {
+            error = "too many ops, max " + String(DisplayList::MAX_OPS);
+        }
+    }
+
+    if (!error.isEmpty()) {
+        resp["status"] = "error";
+        resp["message"] = error;
+        sendJson(webserver, HTTP_CODE_BAD_REQUEST, resp);
+
+        return;
+    }
+
+    const size_t received = list.getOps().size();
+
+    list.optimize();
+
+    resp["ops"] = received;
+    resp["merged"] = list.getMerged();
+    resp["culled"] = list.getCulled();
+
+    if (!path.isEmpty()) {
+        if (!LittleFS.exists(SCENE_DIR)) {
+            LittleFS.mkdir(SCENE_DIR);
+        }
+
+        if (!list.save(path)) {
+            resp["status"] = "error";
+            resp["message"] = "scene not saved";
+            sendJson(webserver, HTTP_CODE_INTERNAL_ERROR, resp);
+
+            return;
+        }
+
+        resp["scene"] = sceneName;
+    }
+
+    sendQueuedList(webserver, list, resp);
+}
+
+/**
+ * @brief List the stored scenes, paginated with ?limit= and ?cursor=
+ *
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return void
+ */
+void handleListScenes(Webserver* webserver) {
+    JsonDocument head;
+    Dir dir = LittleFS.openDir(SCENE_DIR);
+    String after = webserver->raw().arg("cursor");
+
+    sendJsonList(webserver, head, "scenes", listLimit(webserver),
+                 [dir, after](JsonDocument& item, String& cursor) mutable -> JsonListStep {
+                     while (dir.next()) {
+                         String name = dir.fileName();
+
+                         if (!name.endsWith(".dl") || !pastCursor(name, after)) {
+                             continue;
+                         }
+
+                         item["name"] = name.substring(0, name.length() - 3);
+                         item["size"] = dir.fileSize();
+                         cursor = name;
+
+                         return JsonListStep::Item;
+                     }
+
+                     return JsonListStep::End;
+                 });
+}
+
+/**
+ * @brief Queue the replay of a stored scene, the list is read back already optimized
+ *
+ * Body: {"name": "status"}
+ *
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return void
+ */
+void handlePlayScene(Webserver* webserver) {
+    JsonDocument doc;
+    JsonDocument resp;
+    String path;
+
+    readJsonBody(webserver, doc);
+
+    DisplayList list;
+
+    if (!scenePath(doc["name"] | "", path) || !list.load(path)) {
+        resp["status"] = "error";
+        resp["message"] = "scene not found";
+        sendJson(webserver, HTTP_CODE_NOT_FOUND, resp);
+
+        return;
+    }
+
+    resp["scene"] = doc["name"];
+    sendQueuedList(webserver, list, resp);
+}
+
+/**
+ * @brief Delete a stored scene, DELETE /api/v1/scenes?name=status
+ *
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return void
+ */
+void handleDeleteScene(Webserver* webserver) {
+    JsonDocument resp;
+    String path;
+
+    const bool removed = scenePath(webserver->raw().arg("name"), path) && LittleFS.remove(path);
+
+    resp["status"] = removed ? "deleted" : "error";
+
+    sendJson(webserver, removed ? HTTP_CODE_OK : HTTP_CODE_NOT_FOUND, resp);
+}
@@ -0,0 +1,65 @@
+#include <cstring>
+#include <limits>
+
+#include "web/ContentRange.h"
+
+/**
+ * @brief Read a decimal number up to the separator
+ *
+ * @param text Cursor, moved past the separator
+ * @param separator Character ending the number, '\0' for the end of the header
+ * @param value Receives the number
+ * @return false if there is no digit, another character or the number does not fit in a size_t
+ */
+static auto readNumber(const char*& text, char separator, size_t& value) -> bool {
+    const char* digit = text;
+    value = 0;
+
+    for (; *digit >= '0' && *digit <= '9'; ++digit) {
+        const auto figure = static_cast<size_t>(*digit - '0');
+
+        if (value > (std::numeric_limits<size_t>::max() - figure) / 10) {
+            return false;
+        }
+        value = (value * 10) + figure;
+    }
+
+    if (digit == text || *digit != separator) {
+        return false;
+    }
+
+    text = (separator == '\0') ? digit : digit + 1;
+
+    return true;
+}
+
+/**
+ * @brief Parse a Content-Range request header, bytes first-last/total
+ *
+ * @param value Header value, may be null
+ * @param range Receives the range, only written when the header is well formed
+ * @return true if the header is well formed
+ */
+auto ContentRange::parse(const char* value, ContentRange& range) -> bool {
+    static constexpr const char* UNIT = "bytes ";
+
+    if (value == nullptr || strncmp(value, UNIT, strlen(UNIT)) != 0) {
+        return false;
+    }
+
+    const char* text = value + strlen(UNIT);
+    size_t first = 0;
+    size_t last = 0;
+    size_t size = 0;
+
+    if (!readNumber(text, '-', first) || !readNumber(text, '/', last) || !readNumber(text, '\0', size) ||
+        last < first || size <= last) {
+        return false;
+    }
+
+    range.start = first;
+    range.end = last + 1;
+    range.total = size;
+
+    return true;
+}
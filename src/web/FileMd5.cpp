@@ -0,0 +1,84 @@
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <array>
+#include <limits>
+
+#include "web/FileMd5.h"
+
+static constexpr size_t HASH_BUFFER = 512;
+
+/**
+ * @brief Open a file and start hashing it
+ *
+ * @param path File to hash
+ * @return false if the file cannot be opened, step() then ends at once with an empty digest
+ */
+auto FileMd5::begin(const String& path) -> bool {
+    m_path = path;
+    m_digest = String();
+    m_file = LittleFS.open(path, "r");
+    m_hash.begin();
+
+    return static_cast<bool>(m_file);
+}
+
+/**
+ * @brief Hash the next part of the file
+ *
+ * @param budgetUs Time allowed for this call, at least one buffer is hashed
+ * @return true once the whole file is hashed and getDigest() is set
+ */
+auto FileMd5::step(uint32_t budgetUs) -> bool {
+    if (!m_file) {
+        return true;
+    }
+
+    std::array<uint8_t, HASH_BUFFER> buffer{};
+    const uint32_t startUs = micros();
+
+    do {
+        const size_t len = m_file.read(buffer.data(), buffer.size());
+
+        if (len == 0) {
+            m_file.close();
+            m_hash.calculate();
+            m_digest = m_hash.toString();
+
+            return true;
+        }
+
+        m_hash.add(buffer.data(), len);
+        yield();  // a large file takes a while, keep the watchdog fed
+    } while ((micros() - startUs) < budgetUs);
+
+    return false;
+}
+
+/**
+ * @brief Path given to begin()
+ *
+ * @return file path
+ */
+auto FileMd5::getPath() const -> const String& { return m_path; }
+
+/**
+ * @brief MD5 of the file once step() returned true
+ *
+ * @return 32 lowercase hexadecimal digits, empty if the file cannot be read
+ */
+auto FileMd5::getDigest() const -> const String& { return m_digest; }
+
+/**
+ * @brief MD5 of a whole file in one call
+ *
+ * @param path File to hash
+ * @return 32 lowercase hexadecimal digits, empty if the file cannot be read
+ */
+auto FileMd5::of(const String& path) -> String {
+    FileMd5 hasher;
+
+    (void)hasher.begin(path);
+    (void)hasher.step(std::numeric_limits<uint32_t>::max());  // no budget: the whole file in one step
+
+    return hasher.getDigest();
+}
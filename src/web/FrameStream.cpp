@@ -0,0 +1,517 @@
+#include <Logger.h>
+#include <lwip/pbuf.h>
+#include <lwip/udp.h>
+#include <array>
+#include <cstring>
+
+#include "web/FrameStream.h"
+#include "display/DisplayManager.h"
+
+static constexpr uint16_t FRAME_STREAM_MAGIC = 0x4647;  // "GF"
+static constexpr uint16_t FRAME_ACK_MAGIC = 0x4147;     // "GA"
+static constexpr uint8_t FRAME_FLAG_END = 0x01;
+static constexpr size_t FRAME_QUEUE_SIZE = 8;
+static constexpr size_t FRAME_ACK_SIZE = 12;
+static constexpr size_t FRAME_PALETTE_SIZE = 256;
+static constexpr size_t FRAME_LINE_SIZE = 240;
+static constexpr uint32_t FRAME_IDLE_MS = 3000;
+static constexpr uint32_t FRAME_FPS_WINDOW_MS = 2000;
+
+/**
+ * @brief Datagram waiting in the receive queue, the pbuf is freed once drawn
+ */
+struct FramePacket {
+    pbuf* buf;
+    uint32_t receivedUs;
+    ip_addr_t addr;
+    uint16_t port;
+};
+
+/**
+ * @brief Decoded packet header
+ */
+struct FrameHeader {
+    uint8_t format;
+    uint8_t flags;
+    uint16_t frame;
+    uint16_t xPos;
+    uint16_t yPos;
+    uint16_t width;
+    uint16_t height;
+};
+
+/**
+ * @brief Forward cursor over the payload of a pbuf chain
+ *
+ * A datagram larger than the MTU is reassembled by lwIP into several chained pbufs, runs and pixels may straddle two
+ * of them
+ */
+class PbufReader {
+   public:
+    PbufReader(const pbuf* buf, size_t offset) : m_seg(buf), m_offset(offset) { skipEmpty(); }
+
+    auto readByte(uint8_t& out) -> bool {
+        if (m_seg == nullptr) {
+            return false;
+        }
+
+        out = static_cast<const uint8_t*>(m_seg->payload)[m_offset++];
+        skipEmpty();
+
+        return true;
+    }
+
+    /**
+     * @brief Take the rest of the current segment, at most maxLen bytes
+     */
+    auto slice(const uint8_t*& data, size_t& len, size_t maxLen) -> bool {
+        if (m_seg == nullptr) {
+            return false;
+        }
+
+        data = static_cast<const uint8_t*>(m_seg->payload) + m_offset;
+        len = m_seg->len - m_offset;
+
+        if (len > maxLen) {
+            len = maxLen;
+        }
+
+        m_offset += len;
+        skipEmpty();
+
+        return true;
+    }
+
+   private:
+    const pbuf* m_seg;
+    size_t m_offset;
+
+    auto skipEmpty() -> void {
+        while (m_seg != nullptr && m_offset >= m_seg->len) {
+            m_offset -= m_seg->len;
+            m_seg = m_seg->next;
+        }
+    }
+};
+
+static udp_pcb* s_pcb = nullptr;
+static std::array<FramePacket, FRAME_QUEUE_SIZE> s_queue{};
+static size_t s_queueHead = 0;
+static size_t s_queueCount = 0;
+static FrameStreamStats s_stats;
+static bool s_frameOpen = false;
+static uint32_t s_frameStartUs = 0;
+static uint32_t s_lastPacketMs = 0;
+static uint32_t s_windowStartMs = 0;
+static uint32_t s_windowFrames = 0;
+static std::array<uint16_t, FRAME_PALETTE_SIZE> s_palette{};
+static std::array<uint16_t, FRAME_LINE_SIZE> s_lineBuf{};
+
+/**
+ * @brief lwIP receive callback, queues the datagram for update()
+ *
+ * lwIP callbacks run from the system context between two loop() iterations, never while update() runs, so the queue
+ * needs no lock. When the queue is full the newest datagram is dropped
+ */
+static void frameStreamReceive(void*, udp_pcb*, pbuf* buf, const ip_addr_t* addr, u16_t port) {
+    if (buf == nullptr) {
+        return;
+    }
+
+    if (s_queueCount >= FRAME_QUEUE_SIZE) {
+        s_stats.dropped++;
+        pbuf_free(buf);
+
+        return;
+    }
+
+    FramePacket& packet = s_queue[(s_queueHead + s_queueCount) % FRAME_QUEUE_SIZE];
+
+    packet.buf = buf;
+    packet.receivedUs = micros();
+    packet.addr = *addr;
+    packet.port = port;
+    s_queueCount++;
+}
+
+/**
+ * @brief Parse and check the header of a datagram
+ *
+ * @param buf Received datagram
+ * @param header Receives the decoded header
+ *
+ * @return false if the magic, format or rectangle is invalid
+ */
+static auto frameReadHeader(const pbuf* buf, FrameHeader& header) -> bool {
+    std::array<uint8_t, FRAME_STREAM_HEADER_SIZE> raw{};
+
+    if (pbuf_copy_partial(buf, raw.data(), raw.size(), 0) != raw.size()) {
+        return false;
+    }
+
+    auto readU16 = [&raw](size_t pos) -> uint16_t { return static_cast<uint16_t>(raw[pos] | (raw[pos + 1] << 8)); };
+
+    header.format = raw[2];
+    header.flags = raw[3];
+    header.frame = readU16(4);
+    header.xPos = readU16(6);
+    header.yPos = readU16(8);
+    header.width = readU16(10);
+    header.height = readU16(12);
+
+    if (readU16(0) != FRAME_STREAM_MAGIC || header.format > static_cast<uint8_t>(FrameStreamFormat::Palette)) {
+        return false;
+    }
+
+    if (static_cast<FrameStreamFormat>(header.format) == FrameStreamFormat::Palette) {
+        return header.xPos + header.width <= FRAME_PALETTE_SIZE;
+    }
+
+    const Arduino_GFX* gfx = DisplayManager::getGfx();
+
+    return header.width > 0 && header.height > 0 && header.xPos + header.width <= gfx->width() &&
+           header.yPos + header.height <= gfx->height();
+}
+
+/**
+ * @brief Stream raw big endian RGB565 bytes from the pbuf chain to the bus
+ *
+ * The SPI FIFO is filled 32 bits at a time from the source pointer, so only the few bytes before and after the 32 bit
+ * aligned part of each segment go through a bounce buffer
+ *
+ * @param bus Panel data bus, inside an open address window
+ * @param reader Payload cursor
+ * @param size Number of bytes to write
+ *
+ * @return false if the payload is shorter than size
+ */
+static auto frameWriteRaw(Arduino_DataBus* bus, PbufReader& reader, size_t size) -> bool {
+    alignas(4) std::array<uint8_t, 4> bounce{};
+    const uint8_t* data = nullptr;
+    size_t len = 0;
+
+    while (size > 0) {
+        if (!reader.slice(data, len, size)) {
+            return false;
+        }
+
+        size -= len;
+
+        const size_t lead = (4 - (reinterpret_cast<uintptr_t>(data) & 3U)) & 3U;
+        const size_t head = (lead < len) ? lead : len;
+
+        if (head > 0) {
+            memcpy(bounce.data(), data, head);
+            bus->writeBytes(bounce.data(), head);
+        }
+
+        const size_t aligned = (len - head) & ~static_cast<size_t>(3);
+
+        if (aligned > 0) {
+            bus->writeBytes(const_cast<uint8_t*>(data + head), aligned);
+        }
+
+        const size_t tail = len - head - aligned;
+
+        if (tail > 0) {
+            memcpy(bounce.data(), data + head + aligned, tail);
+            bus->writeBytes(bounce.data(), tail);
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Decode the payload of one rectangle packet into the open address window
+ *
+ * @param bus Panel data bus
+ * @param header Packet header
+ * @param reader Payload cursor, positioned after the header
+ * @param payload Payload size in bytes
+ *
+ * @return false if the payload does not match the rectangle
+ */
+static auto frameWritePixels(Arduino_DataBus* bus, const FrameHeader& header, PbufReader& reader, size_t payload)
+    -> bool {
+    const uint32_t total = static_cast<uint32_t>(header.width) * header.height;
+    uint32_t written = 0;
+
+    switch (static_cast<FrameStreamFormat>(header.format)) {
+        case FrameStreamFormat::Raw565:
+            return payload == total * 2 && frameWriteRaw(bus, reader, payload);
+
+        case FrameStreamFormat::Indexed8: {
+            if (payload != total) {
+                return false;
+            }
+
+            const uint8_t* data = nullptr;
+            size_t len = 0;
+
+            while (written < total && reader.slice(data, len, s_lineBuf.size())) {
+                for (size_t i = 0; i < len; i++) {
+                    s_lineBuf[i] = s_palette[data[i]];
+                }
+
+                bus->writePixels(s_lineBuf.data(), len);
+                written += len;
+            }
+
+            return written == total;
+        }
+
+        case FrameStreamFormat::Rle565:
+        case FrameStreamFormat::Rle8: {
+            const bool indexed = static_cast<FrameStreamFormat>(header.format) == FrameStreamFormat::Rle8;
+            uint8_t count = 0;
+            uint8_t high = 0;
+            uint8_t low = 0;
+
+            while (written < total && reader.readByte(count)) {
+                uint16_t color = 0;
+
+                if (indexed) {
+                    if (!reader.readByte(low)) {
+                        return false;
+                    }
+
+                    color = s_palette[low];
+                } else {
+                    if (!reader.readByte(high) || !reader.readByte(low)) {
+                        return false;
+                    }
+
+                    color = static_cast<uint16_t>((high << 8) | low);
+                }
+
+                const uint32_t run = count + 1U;
+
+                if (written + run > total) {
+                    return false;
+                }
+
+                bus->writeRepeat(color, run);
+                written += run;
+            }
+
+            return written == total;
+        }
+
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief Store palette entries, x is the first index and w the number of big endian RGB565 colours
+ *
+ * @param header Packet header
+ * @param reader Payload cursor
+ *
+ * @return false if the payload is too short
+ */
+static auto frameReadPalette(const FrameHeader& header, PbufReader& reader) -> bool {
+    uint8_t high = 0;
+    uint8_t low = 0;
+
+    for (uint16_t i = 0; i < header.width; i++) {
+        if (!reader.readByte(high) || !reader.readByte(low)) {
+            return false;
+        }
+
+        s_palette[header.xPos + i] = static_cast<uint16_t>((high << 8) | low);
+    }
+
+    return true;
+}
+
+/**
+ * @brief Acknowledge the end of a frame: magic, frame id, device latency in us, dropped datagrams
+ *
+ * @param packet Datagram that closed the frame
+ * @param frame Frame id
+ * @param latencyUs Time from the reception of the first datagram of the frame to the end of the last SPI write
+ *
+ * @return void
+ */
+static void frameSendAck(const FramePacket& packet, uint16_t frame, uint32_t latencyUs) {
+    pbuf* out = pbuf_alloc(PBUF_TRANSPORT, FRAME_ACK_SIZE, PBUF_RAM);
+
+    if (out == nullptr) {
+        return;
+    }
+
+    auto* ack = static_cast<uint8_t*>(out->payload);
+    const uint32_t dropped = s_stats.dropped;
+
+    ack[0] = FRAME_ACK_MAGIC & 0xFF;
+    ack[1] = FRAME_ACK_MAGIC >> 8;
+    ack[2] = frame & 0xFF;
+    ack[3] = frame >> 8;
+
+    for (size_t i = 0; i < 4; i++) {
+        ack[4 + i] = static_cast<uint8_t>(latencyUs >> (8 * i));
+        ack[8 + i] = static_cast<uint8_t>(dropped >> (8 * i));
+    }
+
+    udp_sendto(s_pcb, out, &packet.addr, packet.port);
+    pbuf_free(out);
+}
+
+/**
+ * @brief Draw one queued datagram
+ *
+ * @param packet Datagram to draw
+ *
+ * @return void
+ */
+static void frameProcess(const FramePacket& packet) {
+    FrameHeader header{};
+
+    s_stats.packets++;
+    s_stats.bytes += packet.buf->tot_len;
+
+    if (!DisplayManager::isReady() || !frameReadHeader(packet.buf, header)) {
+        s_stats.errors++;
+
+        return;
+    }
+
+    if (!s_stats.active) {
+        DisplayManager::stopGif();
+        s_stats.active = true;
+        s_windowStartMs = millis();
+        s_windowFrames = 0;
+
+        Logger::info((String("Remote frame stream started from ") + ipaddr_ntoa(&packet.addr)).c_str(),
+                     "FrameStream");
+    }
+
+    s_lastPacketMs = millis();
+
+    if (!s_frameOpen) {
+        s_frameOpen = true;
+        s_frameStartUs = packet.receivedUs;
+    }
+
+    PbufReader reader(packet.buf, FRAME_STREAM_HEADER_SIZE);
+    const size_t payload = packet.buf->tot_len - FRAME_STREAM_HEADER_SIZE;
+    bool drawOk = true;
+
+    if (static_cast<FrameStreamFormat>(header.format) == FrameStreamFormat::Palette) {
+        drawOk = frameReadPalette(header, reader);
+    } else {
+        auto* tft = reinterpret_cast<Arduino_TFT*>(DisplayManager::getGfx());
+
+        tft->startWrite();
+        tft->writeAddrWindow(static_cast<int16_t>(header.xPos), static_cast<int16_t>(header.yPos), header.width,
+                             header.height);
+        drawOk = frameWritePixels(DisplayManager::getBus(), header, reader, payload);
+        tft->endWrite();
+    }
+
+    if (!drawOk) {
+        s_stats.errors++;
+    }
+
+    if ((header.flags & FRAME_FLAG_END) == 0) {
+        return;
+    }
+
+    const uint32_t latencyUs = micros() - s_frameStartUs;
+
+    s_frameOpen = false;
+    s_stats.frames++;
+    s_stats.lastLatencyUs = latencyUs;
+    s_stats.maxLatencyUs = (latencyUs > s_stats.maxLatencyUs) ? latencyUs : s_stats.maxLatencyUs;
+    s_windowFrames++;
+
+    const uint32_t windowMs = millis() - s_windowStartMs;
+
+    if (windowMs >= FRAME_FPS_WINDOW_MS) {
+        s_stats.fps = static_cast<float>(s_windowFrames) * 1000.0F / static_cast<float>(windowMs);
+        s_windowFrames = 0;
+        s_windowStartMs = millis();
+    }
+
+    frameSendAck(packet, header.frame, latencyUs);
+}
+
+/**
+ * @brief Listen for frame datagrams
+ *
+ * @param port UDP port
+ *
+ * @return true if the port could be bound
+ */
+auto FrameStream::begin(uint16_t port) -> bool {
+    if (s_pcb != nullptr) {
+        return true;
+    }
+
+    s_pcb = udp_new();
+
+    if (s_pcb == nullptr) {
+        return false;
+    }
+
+    if (udp_bind(s_pcb, IP_ANY_TYPE, port) != ERR_OK) {
+        Logger::error(("Cannot bind UDP port " + String(port)).c_str(), "FrameStream");
+        udp_remove(s_pcb);
+        s_pcb = nullptr;
+
+        return false;
+    }
+
+    udp_recv(s_pcb, frameStreamReceive, nullptr);
+    s_stats.port = port;
+
+    Logger::info(("Listening for frames on UDP port " + String(port)).c_str(), "FrameStream");
+
+    return true;
+}
+
+/**
+ * @brief Draw the queued datagrams within the budget given by the scheduler, the rest waits for the next slice
+ *
+ * The stream gives the screen back (stays inactive until the next datagram) after 3 s without data
+ *
+ * @param budgetUs Time allowed for this call
+ * @return void
+ */
+auto FrameStream::update(uint32_t budgetUs) -> void {
+    const uint32_t startUs = micros();
+
+    // a stream that starts while screen changes are still queued waits for the display update to run them first
+    if (!s_stats.active && DisplayManager::hasQueuedCommands()) {
+        return;
+    }
+
+    while (s_queueCount > 0 && (micros() - startUs) < budgetUs) {
+        const FramePacket packet = s_queue[s_queueHead];
+
+        s_queueHead = (s_queueHead + 1) % FRAME_QUEUE_SIZE;
+        s_queueCount--;
+
+        frameProcess(packet);
+        pbuf_free(packet.buf);
+    }
+
+    if (s_stats.active && (millis() - s_lastPacketMs) > FRAME_IDLE_MS) {
+        s_stats.active = false;
+        s_frameOpen = false;
+
+        Logger::info((String(s_stats.frames) + " frames received, " + String(s_stats.dropped) + " dropped, " +
+                      String(s_stats.errors) + " errors")
+                         .c_str(),
+                     "FrameStream");
+    }
+}
+
+/**
+ * @brief Counters of the stream since boot
+ *
+ * @return stream stats, fps is averaged over two seconds
+ */
+auto FrameStream::getStats() -> FrameStreamStats { return s_stats; }
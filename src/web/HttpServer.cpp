@@ -0,0 +1,1679 @@
+#include <Arduino.h>
+#include <Logger.h>
+#include <lwip/tcp.h>
+#include <algorithm>
+#include <cstring>
+
+#include "web/HttpServer.h"
+#include "web/Webserver.h"
+
+/**
+ * @brief End of a kept alive response head, the timeout matches HttpServer::IDLE_TIMEOUT_MS
+ */
+static constexpr const char* KEEP_ALIVE_HEADER = "Connection: keep-alive\r\nKeep-Alive: timeout=5\r\n\r\n";
+
+/**
+ * @brief Print appending to a String, lets a body writer fill the transmit buffer directly
+ */
+class StringPrint : public Print {
+   public:
+    explicit StringPrint(String& target) : m_target(target) {}
+
+    auto write(uint8_t value) -> size_t override {
+        m_target += static_cast<char>(value);
+        return 1;
+    }
+
+    auto write(const uint8_t* buffer, size_t size) -> size_t override {
+        m_target.concat(reinterpret_cast<const char*>(buffer), size);
+        return size;
+    }
+
+   private:
+    String& m_target;
+};
+
+enum class HttpParseState : uint8_t {
+    RequestLine,
+    Headers,
+    Body,
+    Preamble,
+    BoundaryLine,
+    PartHeaders,
+    PartData,
+    Epilogue,
+    Dispatch,
+    Responding
+};
+
+/**
+ * @brief Read a quoted parameter of a multipart Content-Disposition header
+ * @param line Header line, e.g. Content-Disposition: form-data; name="file"; filename="a.gif"
+ * @param key Parameter name
+ *
+ * @return The parameter value, empty if missing
+ */
+static auto dispositionParam(const String& line, const String& key) -> String {
+    String pattern = key + "=\"";
+    int start = line.indexOf(pattern);
+
+    // "name=" also matches the end of "filename="
+    while (start > 0 && line[start - 1] != ' ' && line[start - 1] != ';') {
+        start = line.indexOf(pattern, start + 1);
+    }
+
+    if (start < 0) {
+        return {};
+    }
+
+    start += static_cast<int>(pattern.length());
+    int end = line.indexOf('"', start);
+
+    return line.substring(start, end < 0 ? line.length() : end);
+}
+
+/**
+ * @brief State of one client connection, the request being parsed and the response being sent
+ */
+struct HttpServer::Connection {
+    tcp_pcb* pcb = nullptr;
+    pbuf* rx = nullptr;
+    pbuf* seg = nullptr;
+    size_t segOffset = 0;
+    size_t consumed = 0;
+    bool remoteClosed = false;
+    bool closing = false;
+    bool reused = false;
+    uint32_t lastActivityMs = 0;
+
+    HttpParseState state = HttpParseState::RequestLine;
+    String line;
+    HTTPMethod method = HTTP_GET;
+    String uri;
+    bool keepAlive = true;
+    std::vector<std::pair<String, String>> args;
+    std::vector<std::pair<String, String>> requestHeaders;
+    String contentType;
+    String body;
+    size_t bodyReserved = 0;
+    bool hasBody = false;
+    size_t contentLength = 0;
+    size_t bodyRead = 0;
+    bool inBody = false;
+    const Route* route = nullptr;
+
+    String delimiter;
+    size_t matched = 0;
+    String partName;
+    String partFile;
+    String partType;
+    String partValue;
+    bool uploading = false;
+
+    bool responded = false;
+    String headers;
+    size_t contentLengthOverride = CONTENT_LENGTH_UNKNOWN;
+    String tx;
+    size_t txOffset = 0;
+    File txFile;
+    size_t txFileRemaining = 0;
+    const uint8_t* txFlash = nullptr;
+    size_t txFlashRemaining = 0;
+    TChunkFunction txProducer;
+
+    /**
+     * @brief Contiguous received bytes at the read position, limited to the request body while reading it
+     * @param data Set to the first byte
+     *
+     * @return Number of bytes available at data
+     */
+    auto span(const uint8_t*& data) -> size_t {
+        while (seg != nullptr && segOffset >= seg->len) {
+            seg = seg->next;
+            segOffset = 0;
+        }
+
+        if (seg == nullptr) {
+            return 0;
+        }
+
+        data = static_cast<const uint8_t*>(seg->payload) + segOffset;
+        size_t len = seg->len - segOffset;
+
+        return inBody ? std::min(len, contentLength - bodyRead) : len;
+    }
+
+    /**
+     * @brief Consume bytes returned by span(), the pbuf chain is released and its window reopened once fully read
+     * @param len Number of bytes consumed
+     *
+     * @return void
+     */
+    auto advance(size_t len) -> void {
+        segOffset += len;
+        consumed += len;
+
+        if (inBody) {
+            bodyRead += len;
+        }
+
+        if (rx != nullptr && consumed >= rx->tot_len) {
+            if (pcb != nullptr) {
+                tcp_recved(pcb, rx->tot_len);
+            }
+
+            pbuf_free(rx);
+            rx = nullptr;
+            seg = nullptr;
+            segOffset = 0;
+            consumed = 0;
+        }
+    }
+
+    /**
+     * @brief Forget the previous request before parsing the next one on a kept alive connection
+     *
+     * @return void
+     */
+    auto resetRequest() -> void {
+        state = HttpParseState::RequestLine;
+        line = "";
+        uri = "";
+        args.clear();
+        requestHeaders.clear();
+        contentType = "";
+        body = String();  // release the buffer, a kept alive connection may idle for a while
+        bodyReserved = 0;
+        hasBody = false;
+        contentLength = 0;
+        bodyRead = 0;
+        inBody = false;
+        route = nullptr;
+        delimiter = "";
+        matched = 0;
+        responded = false;
+        headers = "";
+        contentLengthOverride = CONTENT_LENGTH_UNKNOWN;
+        tx = "";
+        txOffset = 0;
+        txFileRemaining = 0;
+        txFlash = nullptr;
+        txFlashRemaining = 0;
+        txProducer = nullptr;
+    }
+
+    /**
+     * @brief Whether the connection is kept alive after a response, with nothing received or pending since
+     *
+     * @return true if closing it loses nothing
+     */
+    auto isIdle() const -> bool {
+        return reused && state == HttpParseState::RequestLine && line.isEmpty() && rx == nullptr && !closing;
+    }
+
+    /**
+     * @brief Whether response bytes remain to be handed to lwIP
+     *
+     * @return true while sending
+     */
+    auto sending() const -> bool { return txOffset < tx.length() || bodyPending(); }
+
+    /**
+     * @brief Whether body bytes remain after the transmit buffer
+     *
+     * @return true while a file, a flash body or a chunk producer is pending
+     */
+    auto bodyPending() const -> bool { return txFile || txFlashRemaining > 0 || txProducer; }
+};
+
+/**
+ * @brief Construct a new HttpServer object
+ * @param port Port number to listen on
+ */
+HttpServer::HttpServer(uint16_t port) : m_port(port) {}
+
+/**
+ * @brief Close every connection and the listener
+ */
+HttpServer::~HttpServer() {
+    for (size_t slot = 0; slot < MAX_CONNECTIONS; ++slot) {
+        close(slot);
+    }
+
+    if (m_listener != nullptr) {
+        tcp_arg(m_listener, nullptr);
+        tcp_accept(m_listener, nullptr);
+        tcp_close(m_listener);
+    }
+}
+
+/**
+ * @brief Start listening
+ *
+ * @return void
+ */
+auto HttpServer::begin() -> void {
+    tcp_pcb* pcb = tcp_new();
+    if (pcb == nullptr) {
+        Logger::error("Failed to allocate the listening socket", "HttpServer");
+        return;
+    }
+
+    if (tcp_bind(pcb, IP_ANY_TYPE, m_port) != ERR_OK) {
+        Logger::error(("Failed to bind port " + String(m_port)).c_str(), "HttpServer");
+        tcp_close(pcb);
+        return;
+    }
+
+    m_listener = tcp_listen(pcb);
+    if (m_listener == nullptr) {
+        Logger::error("Failed to listen", "HttpServer");
+        tcp_close(pcb);
+        return;
+    }
+
+    tcp_arg(m_listener, this);
+    tcp_accept(m_listener, &HttpServer::onAccept);
+
+    Logger::info(("Listening on port " + String(m_port)).c_str(), "HttpServer");
+}
+
+/**
+ * @brief lwIP accept callback, takes a free connection slot, or the slot of the longest idle kept alive connection,
+ * or refuses the client
+ *
+ * @return ERR_OK, or ERR_MEM to let lwIP abort the connection when every slot is busy
+ */
+auto HttpServer::onAccept(void* arg, tcp_pcb* pcb, int8_t err) -> int8_t {
+    auto* server = static_cast<HttpServer*>(arg);
+    if (server == nullptr || err != ERR_OK || pcb == nullptr) {
+        return ERR_VAL;
+    }
+
+    auto* freeSlot = std::find(server->m_connections.begin(), server->m_connections.end(), nullptr);
+    if (freeSlot == server->m_connections.end()) {
+        // a browser opens several connections for a page and keeps them, a new client beats one waiting for nothing
+        const uint32_t nowMs = millis();
+        size_t idle = MAX_CONNECTIONS;
+        uint32_t idleMs = 0;
+        for (size_t slot = 0; slot < MAX_CONNECTIONS; ++slot) {
+            const Connection* conn = server->m_connections[slot];
+            if (conn->isIdle() && (idle == MAX_CONNECTIONS || nowMs - conn->lastActivityMs > idleMs)) {
+                idle = slot;
+                idleMs = nowMs - conn->lastActivityMs;
+            }
+        }
+
+        if (idle == MAX_CONNECTIONS) {
+            return ERR_MEM;
+        }
+
+        server->close(idle);
+        freeSlot = &server->m_connections[idle];
+    }
+
+    auto* conn = new Connection();
+    conn->pcb = pcb;
+    conn->lastActivityMs = millis();
+    *freeSlot = conn;
+
+    tcp_arg(pcb, conn);
+    tcp_recv(pcb, &HttpServer::onReceive);
+    tcp_err(pcb, &HttpServer::onError);
+    tcp_nagle_disable(pcb);
+
+    return ERR_OK;
+}
+
+/**
+ * @brief lwIP receive callback, only queues the data; a null pbuf means the peer closed its side
+ *
+ * @return ERR_OK
+ */
+auto HttpServer::onReceive(void* arg, tcp_pcb* pcb, pbuf* buf, int8_t err) -> int8_t {
+    auto* conn = static_cast<Connection*>(arg);
+    (void)pcb;
+
+    if (buf == nullptr) {
+        if (conn != nullptr) {
+            conn->remoteClosed = true;
+        }
+        return ERR_OK;
+    }
+
+    if (conn == nullptr || err != ERR_OK) {
+        pbuf_free(buf);
+        return ERR_OK;
+    }
+
+    if (conn->rx == nullptr) {
+        conn->rx = buf;
+        conn->seg = buf;
+        conn->segOffset = 0;
+        conn->consumed = 0;
+    } else {
+        pbuf_cat(conn->rx, buf);
+    }
+
+    conn->lastActivityMs = millis();
+
+    return ERR_OK;
+}
+
+/**
+ * @brief lwIP error callback, the pcb is already freed so the connection is only marked for cleanup
+ *
+ * @return void
+ */
+auto HttpServer::onError(void* arg, int8_t err) -> void {
+    auto* conn = static_cast<Connection*>(arg);
+    (void)err;
+
+    if (conn != nullptr) {
+        conn->pcb = nullptr;
+    }
+}
+
+/**
+ * @brief Parse pending requests, run handlers and push pending responses
+ * @param budgetUs Time shared by all connections, checked between parsing steps
+ *
+ * @return void
+ */
+auto HttpServer::handleClient(uint32_t budgetUs) -> void {
+    uint32_t startUs = micros();
+
+    for (size_t i = 0; i < MAX_CONNECTIONS; ++i) {
+        size_t slot = (m_next + i) % MAX_CONNECTIONS;
+        Connection* conn = m_connections[slot];
+        if (conn == nullptr) {
+            continue;
+        }
+
+        if (conn->pcb != nullptr && !conn->closing) {
+            service(*conn, startUs, budgetUs);
+        }
+
+        // a peer that closed its side while no response is pending has nothing more to receive
+        bool abandoned = conn->remoteClosed && conn->rx == nullptr && conn->state != HttpParseState::Responding;
+        if (conn->pcb == nullptr || conn->closing || abandoned || millis() - conn->lastActivityMs > IDLE_TIMEOUT_MS) {
+            close(slot);
+        }
+    }
+
+    m_next = (m_next + 1) % MAX_CONNECTIONS;
+}
+
+/**
+ * @brief Advance the state machine of one connection until it blocks or the budget is spent
+ * @param conn Connection to service
+ * @param startUs micros() at the start of this handleClient() pass
+ * @param budgetUs Budget of the handleClient() pass
+ *
+ * @return void
+ */
+auto HttpServer::service(Connection& conn, uint32_t startUs, uint32_t budgetUs) -> void {
+    bool progress = true;
+
+    while (progress && conn.pcb != nullptr && !conn.closing && micros() - startUs < budgetUs) {
+        switch (conn.state) {
+            case HttpParseState::RequestLine:
+            case HttpParseState::Headers:
+            case HttpParseState::BoundaryLine:
+            case HttpParseState::PartHeaders:
+                progress = readLine(conn);
+                break;
+            case HttpParseState::Body:
+                progress = readBody(conn);
+                break;
+            case HttpParseState::Preamble:
+            case HttpParseState::PartData:
+            case HttpParseState::Epilogue:
+                progress = readMultipart(conn);
+                break;
+            case HttpParseState::Dispatch:
+                dispatch(conn);
+                progress = true;
+                break;
+            case HttpParseState::Responding:
+                progress = pump(conn);
+                if (!conn.sending()) {
+                    finishResponse(conn);
+                    progress = conn.state != HttpParseState::Responding;
+                }
+                break;
+        }
+
+        if (conn.inBody && conn.bodyRead >= conn.contentLength) {
+            completeBody(conn);
+        }
+    }
+
+    // a response sent early (from an upload callback or a rejection) drains while the request is still arriving
+    if (conn.state != HttpParseState::Responding && conn.responded) {
+        pump(conn);
+    }
+}
+
+/**
+ * @brief Accumulate one CRLF terminated line and handle it
+ * @param conn Connection to read from
+ *
+ * @return true if bytes were consumed
+ */
+auto HttpServer::readLine(Connection& conn) -> bool {
+    const uint8_t* data = nullptr;
+    size_t len = conn.span(data);
+    if (len == 0) {
+        return false;
+    }
+
+    const auto* newline = static_cast<const uint8_t*>(memchr(data, '\n', len));
+    size_t take = newline != nullptr ? static_cast<size_t>(newline - data) + 1 : len;
+
+    if (conn.line.length() + take > MAX_LINE) {
+        reject(conn, HTTP_CODE_BAD_REQUEST);
+        return false;
+    }
+
+    conn.line.concat(reinterpret_cast<const char*>(data), newline != nullptr ? take - 1 : take);
+    conn.advance(take);
+
+    if (newline != nullptr) {
+        if (conn.line.endsWith("\r")) {
+            conn.line.remove(conn.line.length() - 1);
+        }
+        handleLine(conn);
+        conn.line = "";
+    }
+
+    return true;
+}
+
+/**
+ * @brief Handle a complete line of the request head or of a multipart part head
+ * @param conn Connection the line belongs to
+ *
+ * @return void
+ */
+auto HttpServer::handleLine(Connection& conn) -> void {
+    const String& line = conn.line;
+
+    switch (conn.state) {
+        case HttpParseState::RequestLine: {
+            if (line.isEmpty()) {
+                return;  // stray CRLF between pipelined requests
+            }
+
+            int firstSpace = line.indexOf(' ');
+            int lastSpace = line.lastIndexOf(' ');
+            if (firstSpace <= 0 || lastSpace <= firstSpace) {
+                reject(conn, HTTP_CODE_BAD_REQUEST);
+                return;
+            }
+
+            String methodName = line.substring(0, firstSpace);
+            String target = line.substring(firstSpace + 1, lastSpace);
+            String version = line.substring(lastSpace + 1);
+
+            static constexpr std::array<std::pair<const char*, HTTPMethod>, 7> methods = {{
+                {"GET", HTTP_GET},
+                {"HEAD", HTTP_HEAD},
+                {"POST", HTTP_POST},
+                {"PUT", HTTP_PUT},
+                {"PATCH", HTTP_PATCH},
+                {"DELETE", HTTP_DELETE},
+                {"OPTIONS", HTTP_OPTIONS},
+            }};
+            const auto* found = std::find_if(methods.begin(), methods.end(), [&methodName](const auto& entry) {
+                return methodName.equals(entry.first);
+            });
+            if (found == methods.end() || !version.startsWith("HTTP/1.")) {
+                reject(conn, HTTP_CODE_BAD_REQUEST);
+                return;
+            }
+
+            conn.method = found->second;
+            conn.keepAlive = version != "HTTP/1.0";
+
+            int query = target.indexOf('?');
+            if (query >= 0) {
+                parseArgs(conn, target.substring(query + 1));
+                target.remove(query);
+            }
+            conn.uri = urlDecode(target);
+            conn.state = HttpParseState::Headers;
+            return;
+        }
+
+        case HttpParseState::Headers: {
+            if (line.isEmpty()) {
+                beginBody(conn);
+                return;
+            }
+
+            int colon = line.indexOf(':');
+            if (colon <= 0) {
+                reject(conn, HTTP_CODE_BAD_REQUEST);
+                return;
+            }
+
+            String value = line.substring(colon + 1);
+            value.trim();
+            handleHeader(conn, line.substring(0, colon), value);
+            return;
+        }
+
+        case HttpParseState::BoundaryLine:
+            conn.state = line.startsWith("--") ? HttpParseState::Epilogue : HttpParseState::PartHeaders;
+            conn.partName = "";
+            conn.partFile = "";
+            conn.partType = "";
+            conn.partValue = "";
+            return;
+
+        case HttpParseState::PartHeaders: {
+            if (line.isEmpty()) {
+                conn.state = HttpParseState::PartData;
+                return;
+            }
+
+            String lower = line;
+            lower.toLowerCase();
+
+            if (lower.startsWith("content-type:")) {
+                conn.partType = line.substring(strlen("content-type:"));
+                conn.partType.trim();
+                return;
+            }
+
+            if (!lower.startsWith("content-disposition:")) {
+                return;
+            }
+
+            conn.partName = dispositionParam(line, "name");
+            conn.partFile = dispositionParam(line, "filename");
+            return;
+        }
+
+        default:
+            return;
+    }
+}
+
+/**
+ * @brief Store the request headers the server needs
+ * @param conn Connection being parsed
+ * @param name Header name
+ * @param value Trimmed header value
+ *
+ * @return void
+ */
+auto HttpServer::handleHeader(Connection& conn, const String& name, const String& value) -> void {
+    if (name.equalsIgnoreCase("Content-Length")) {
+        conn.contentLength = static_cast<size_t>(std::max(0L, value.toInt()));
+        conn.hasBody = true;
+    } else if (name.equalsIgnoreCase("Content-Type")) {
+        conn.contentType = value;
+    } else if (name.equalsIgnoreCase("Connection")) {
+        if (value.equalsIgnoreCase("close")) {
+            conn.keepAlive = false;
+        } else if (value.equalsIgnoreCase("keep-alive")) {
+            conn.keepAlive = true;
+        }
+    } else if (name.equalsIgnoreCase("Transfer-Encoding")) {
+        reject(conn, HTTP_CODE_BAD_REQUEST);  // chunked request bodies are not supported
+    }
+
+    for (const String& collected : m_collected) {
+        if (name.equalsIgnoreCase(collected)) {
+            conn.requestHeaders.emplace_back(collected, value);
+        }
+    }
+}
+
+/**
+ * @brief End of the request head: pick the route and decide how the body is read
+ * @param conn Connection being parsed
+ *
+ * @return void
+ */
+auto HttpServer::beginBody(Connection& conn) -> void {
+    for (const Route& route : m_routes) {
+        if (route.uri == conn.uri && (route.method == HTTP_ANY || route.method == conn.method)) {
+            conn.route = &route;
+            break;
+        }
+    }
+
+    if (conn.contentLength == 0) {
+        conn.state = HttpParseState::Dispatch;
+        return;
+    }
+
+    conn.inBody = true;
+
+    String lower = conn.contentType;
+    lower.toLowerCase();
+    if (lower.startsWith("multipart/form-data")) {
+        conn.hasBody = false;  // parts are exposed as arguments and uploads, not as "plain"
+
+        int boundary = lower.indexOf("boundary=");
+        String value = boundary < 0 ? String() : conn.contentType.substring(boundary + strlen("boundary="));
+        value.trim();
+        if (value.startsWith("\"")) {
+            value = value.substring(1, value.lastIndexOf('"'));
+        }
+
+        if (value.isEmpty()) {
+            reject(conn, HTTP_CODE_BAD_REQUEST);
+            return;
+        }
+
+        // the stream is treated as if preceded by CRLF so the first boundary matches the delimiter too
+        conn.delimiter = "\r\n--" + value;
+        conn.matched = 2;
+        conn.state = HttpParseState::Preamble;
+        return;
+    }
+
+    if (conn.contentLength > MAX_BODY) {
+        reject(conn, HTTP_CODE_PAYLOAD_TOO_LARGE);
+        return;
+    }
+
+    // bodies are buffered whole, their sum is capped so concurrent requests cannot exhaust the heap
+    if (bufferedBodies() + conn.contentLength > MAX_BODIES || !conn.body.reserve(conn.contentLength)) {
+        reject(conn, HTTP_CODE_SERVICE_UNAVAILABLE);
+        return;
+    }
+
+    conn.bodyReserved = conn.contentLength;
+    conn.state = HttpParseState::Body;
+}
+
+/**
+ * @brief Buffer a plain request body
+ * @param conn Connection being parsed
+ *
+ * @return true if bytes were consumed
+ */
+auto HttpServer::readBody(Connection& conn) -> bool {
+    const uint8_t* data = nullptr;
+    size_t len = conn.span(data);
+    if (len == 0) {
+        return false;
+    }
+
+    if (!conn.body.concat(reinterpret_cast<const char*>(data), len)) {
+        reject(conn, HTTP_CODE_SERVICE_UNAVAILABLE);
+        return false;
+    }
+
+    conn.advance(len);
+
+    return true;
+}
+
+/**
+ * @brief Scan multipart data for the boundary delimiter, the bytes before it go to the current part
+ *
+ * A held partial match is released when the next byte does not continue it. CR only appears at the start of the
+ * delimiter, so the byte that broke the match only has to be checked against that start again
+ *
+ * @param conn Connection being parsed
+ *
+ * @return true if bytes were consumed
+ */
+auto HttpServer::readMultipart(Connection& conn) -> bool {
+    if (conn.state == HttpParseState::PartData && !conn.uploading && !conn.partFile.isEmpty() && !beginPart(conn)) {
+        return false;
+    }
+
+    const uint8_t* data = nullptr;
+    size_t len = conn.span(data);
+    if (len == 0) {
+        return false;
+    }
+
+    if (conn.state == HttpParseState::Epilogue) {
+        conn.advance(len);
+        return true;
+    }
+
+    const auto* delimiter = reinterpret_cast<const uint8_t*>(conn.delimiter.c_str());
+    size_t pos = 0;
+
+    // the upload handler may answer from emitPart(), the rest of the body is then left unread
+    while (pos < len && conn.state != HttpParseState::Responding) {
+        if (conn.matched == 0) {
+            const auto* carriage = static_cast<const uint8_t*>(memchr(data + pos, '\r', len - pos));
+            size_t run = carriage != nullptr ? static_cast<size_t>(carriage - data) - pos : len - pos;
+            emitPart(conn, data + pos, run);
+            pos += run;
+
+            if (carriage == nullptr) {
+                break;
+            }
+
+            conn.matched = 1;
+            ++pos;
+            continue;
+        }
+
+        if (data[pos] != delimiter[conn.matched]) {
+            emitPart(conn, delimiter, conn.matched);
+            conn.matched = 0;
+            continue;
+        }
+
+        ++pos;
+        if (++conn.matched == conn.delimiter.length()) {
+            conn.matched = 0;
+            conn.advance(pos);
+            endPart(conn);
+            return true;
+        }
+    }
+
+    conn.advance(pos);
+
+    return true;
+}
+
+/**
+ * @brief Start delivering a file part to the upload handler, one upload at a time across connections
+ * @param conn Connection being parsed
+ *
+ * @return false while another connection owns the upload buffer
+ */
+auto HttpServer::beginPart(Connection& conn) -> bool {
+    if (m_uploadOwner != nullptr && m_uploadOwner != &conn) {
+        return false;
+    }
+
+    m_uploadOwner = &conn;
+    conn.uploading = true;
+
+    m_upload.filename = conn.partFile;
+    m_upload.name = conn.partName;
+    m_upload.type = conn.partType;
+    m_upload.totalSize = 0;
+    m_upload.currentSize = 0;
+    m_upload.contentLength = conn.contentLength;
+    callUpload(conn, UPLOAD_FILE_START);
+
+    return true;
+}
+
+/**
+ * @brief Append part data, file data is handed to the upload handler every HTTP_UPLOAD_BUFLEN bytes
+ * @param conn Connection being parsed
+ * @param data Part bytes
+ * @param len Number of bytes
+ *
+ * @return void
+ */
+auto HttpServer::emitPart(Connection& conn, const uint8_t* data, size_t len) -> void {
+    if (conn.state != HttpParseState::PartData || len == 0) {
+        return;
+    }
+
+    if (!conn.uploading) {
+        size_t room = MAX_LINE - std::min(MAX_LINE, static_cast<size_t>(conn.partValue.length()));
+        conn.partValue.concat(reinterpret_cast<const char*>(data), std::min(len, room));
+        return;
+    }
+
+    while (len > 0) {
+        size_t take = std::min(len, static_cast<size_t>(HTTP_UPLOAD_BUFLEN) - m_upload.currentSize);
+        memcpy(m_upload.buf + m_upload.currentSize, data, take);
+        m_upload.currentSize += take;
+        m_upload.totalSize += take;
+        data += take;
+        len -= take;
+
+        if (m_upload.currentSize == HTTP_UPLOAD_BUFLEN) {
+            callUpload(conn, UPLOAD_FILE_WRITE);
+            m_upload.currentSize = 0;
+        }
+    }
+}
+
+/**
+ * @brief A delimiter closed the current part: finish the upload or store the form field
+ * @param conn Connection being parsed
+ *
+ * @return void
+ */
+auto HttpServer::endPart(Connection& conn) -> void {
+    if (conn.uploading) {
+        if (m_upload.currentSize > 0) {
+            callUpload(conn, UPLOAD_FILE_WRITE);
+            m_upload.currentSize = 0;
+        }
+        if (!conn.uploading) {
+            return;  // refused by the upload handler
+        }
+        callUpload(conn, UPLOAD_FILE_END);
+        conn.uploading = false;
+        m_uploadOwner = nullptr;
+    } else if (conn.state == HttpParseState::PartData && !conn.partName.isEmpty()) {
+        conn.args.emplace_back(conn.partName, conn.partValue);
+    }
+
+    conn.state = HttpParseState::BoundaryLine;
+}
+
+/**
+ * @brief Tell the upload handler that the upload of this connection will not complete
+ * @param conn Connection being parsed or closed
+ *
+ * @return void
+ */
+auto HttpServer::abortUpload(Connection& conn) -> void {
+    if (!conn.uploading) {
+        return;
+    }
+
+    callUpload(conn, UPLOAD_FILE_ABORTED);
+    conn.uploading = false;
+    m_uploadOwner = nullptr;
+}
+
+/**
+ * @brief Run the upload handler of the request route
+ *
+ * A handler answering while the file is still arriving refuses it: as with reject(), the rest of the body is not read
+ * and the connection closes once the answer is sent, so a refused upload is not received in vain
+ *
+ * @param conn Connection the upload belongs to
+ * @param status Upload status to report
+ *
+ * @return void
+ */
+auto HttpServer::callUpload(Connection& conn, HTTPUploadStatus status) -> void {
+    m_upload.status = status;
+
+    if (conn.route == nullptr || !conn.route->upload) {
+        return;
+    }
+
+    const bool receiving = status == UPLOAD_FILE_START || status == UPLOAD_FILE_WRITE;
+    const bool keepAlive = conn.keepAlive;
+
+    Connection* previous = m_current;
+    m_current = &conn;
+    conn.keepAlive = keepAlive && !receiving;  // what an answer given now announces
+    conn.route->upload();
+    m_current = previous;
+
+    if (!conn.responded || !receiving) {
+        conn.keepAlive = keepAlive;
+        return;
+    }
+
+    conn.uploading = false;
+    m_uploadOwner = nullptr;
+    conn.inBody = false;
+    conn.state = HttpParseState::Responding;
+}
+
+/**
+ * @brief The whole body was read: expose it to the handler and queue the dispatch
+ * @param conn Connection being parsed
+ *
+ * @return void
+ */
+auto HttpServer::completeBody(Connection& conn) -> void {
+    conn.inBody = false;
+
+    if (conn.state == HttpParseState::Body) {
+        String lower = conn.contentType;
+        lower.toLowerCase();
+        if (lower.startsWith("application/x-www-form-urlencoded")) {
+            parseArgs(conn, conn.body);
+        }
+    } else {
+        abortUpload(conn);  // body ended before the closing boundary
+    }
+
+    if (conn.state != HttpParseState::Responding) {
+        conn.state = HttpParseState::Dispatch;
+    }
+}
+
+/**
+ * @brief Run the handler of a complete request, a handler that does not answer gets a 500
+ * @param conn Connection with a complete request
+ *
+ * @return void
+ */
+auto HttpServer::dispatch(Connection& conn) -> void {
+    Connection* previous = m_current;
+    m_current = &conn;
+
+    if (conn.route != nullptr) {
+        conn.route->handler();
+    } else if (m_notFound) {
+        m_notFound();
+    } else {
+        send(HTTP_CODE_NOT_FOUND, "text/plain", "Not found");
+    }
+
+    if (!conn.responded) {
+        send(HTTP_CODE_INTERNAL_ERROR, "text/plain", "No response");
+    }
+
+    m_current = previous;
+    conn.state = HttpParseState::Responding;
+}
+
+/**
+ * @brief Answer a request that cannot be parsed or accepted and close the connection once sent
+ * @param conn Connection being parsed
+ * @param code HTTP status code
+ *
+ * @return void
+ */
+auto HttpServer::reject(Connection& conn, int code) -> void {
+    abortUpload(conn);
+
+    Connection* previous = m_current;
+    m_current = &conn;
+    conn.keepAlive = false;
+    conn.inBody = false;
+    send(code, "text/plain", reasonPhrase(code));
+    m_current = previous;
+
+    conn.state = HttpParseState::Responding;
+}
+
+/**
+ * @brief Register a handler for every method of a route
+ * @param uri The URI path to handle
+ * @param handler The function to call when the route is accessed
+ *
+ * @return void
+ */
+auto HttpServer::on(const String& uri, THandlerFunction handler) -> void { on(uri, HTTP_ANY, std::move(handler)); }
+
+/**
+ * @brief Register a handler for a route
+ * @param uri The URI path to handle
+ * @param method The HTTP method to handle
+ * @param handler The function to call when the route is accessed
+ *
+ * @return void
+ */
+auto HttpServer::on(const String& uri, HTTPMethod method, THandlerFunction handler) -> void {
+    on(uri, method, std::move(handler), nullptr);
+}
+
+/**
+ * @brief Register a handler for a route receiving multipart file uploads
+ * @param uri The URI path to handle
+ * @param method The HTTP method to handle
+ * @param handler The function to call once the request is complete
+ * @param uploadHandler The function to call for every chunk of an uploaded file, see upload()
+ *
+ * @return void
+ */
+auto HttpServer::on(const String& uri, HTTPMethod method, THandlerFunction handler, THandlerFunction uploadHandler)
+    -> void {
+    m_routes.push_back({uri, method, std::move(handler), std::move(uploadHandler)});
+}
+
+/**
+ * @brief Register the handler of requests that match no route
+ * @param handler The function to call
+ *
+ * @return void
+ */
+auto HttpServer::onNotFound(THandlerFunction handler) -> void { m_notFound = std::move(handler); }
+
+/**
+ * @brief Path of the request being handled
+ *
+ * @return The decoded path without query string
+ */
+auto HttpServer::uri() const -> String { return m_current != nullptr ? m_current->uri : String(); }
+
+/**
+ * @brief Method of the request being handled
+ *
+ * @return The request method
+ */
+auto HttpServer::method() const -> HTTPMethod { return m_current != nullptr ? m_current->method : HTTP_GET; }
+
+/**
+ * @brief Query, form or multipart field of the request being handled, "plain" is the raw body
+ * @param name Argument name
+ *
+ * @return The value, empty if missing
+ */
+auto HttpServer::arg(const String& name) const -> String {
+    if (m_current == nullptr) {
+        return {};
+    }
+
+    if (name == "plain" && m_current->hasBody) {
+        return m_current->body;
+    }
+
+    for (const auto& entry : m_current->args) {
+        if (entry.first == name) {
+            return entry.second;
+        }
+    }
+
+    return {};
+}
+
+/**
+ * @brief Whether the request being handled carries an argument
+ * @param name Argument name
+ *
+ * @return true if present
+ */
+auto HttpServer::hasArg(const String& name) const -> bool {
+    if (m_current == nullptr) {
+        return false;
+    }
+
+    if (name == "plain") {
+        return m_current->hasBody;
+    }
+
+    return std::any_of(m_current->args.begin(), m_current->args.end(),
+                       [&name](const auto& entry) { return entry.first == name; });
+}
+
+/**
+ * @brief Raw body of the request being handled, without the copy arg("plain") makes
+ *
+ * @return The body, empty for a multipart request or outside a handler
+ */
+auto HttpServer::body() const -> const String& {
+    static const String empty;
+
+    return m_current != nullptr ? m_current->body : empty;
+}
+
+/**
+ * @brief Content-Type of the request being handled
+ *
+ * @return The header value, empty if absent
+ */
+auto HttpServer::contentType() const -> const String& {
+    static const String empty;
+
+    return m_current != nullptr ? m_current->contentType : empty;
+}
+
+/**
+ * @brief Keep a request header for the handlers, the others are dropped while parsing
+ * @param name Header name, case insensitive
+ *
+ * @return void
+ */
+auto HttpServer::collectHeader(const String& name) -> void {
+    for (const String& collected : m_collected) {
+        if (collected.equalsIgnoreCase(name)) {
+            return;
+        }
+    }
+
+    m_collected.push_back(name);
+}
+
+/**
+ * @brief Value of a request header registered with collectHeader()
+ * @param name Header name, case insensitive
+ *
+ * @return The header value, empty if absent or not collected
+ */
+auto HttpServer::header(const String& name) const -> String {
+    if (m_current == nullptr) {
+        return {};
+    }
+
+    for (const auto& header : m_current->requestHeaders) {
+        if (header.first.equalsIgnoreCase(name)) {
+            return header.second;
+        }
+    }
+
+    return {};
+}
+
+/**
+ * @brief Add a header to the next response
+ * @param name Header name
+ * @param value Header value
+ * @param first Put the header before the ones already added
+ *
+ * @return void
+ */
+auto HttpServer::sendHeader(const String& name, const String& value, bool first) -> void {
+    if (m_current == nullptr) {
+        return;
+    }
+
+    String header = name + ": " + value + "\r\n";
+    m_current->headers = first ? header + m_current->headers : m_current->headers + header;
+}
+
+/**
+ * @brief Override the Content-Length of the next streamFile()
+ * @param length Length in bytes
+ *
+ * @return void
+ */
+auto HttpServer::setContentLength(size_t length) -> void {
+    if (m_current != nullptr) {
+        m_current->contentLengthOverride = length;
+    }
+}
+
+/**
+ * @brief Answer the request being handled, only the first answer of a request is sent
+ * @param code HTTP status code
+ * @param contentType Content type
+ * @param content Response body
+ *
+ * @return void
+ */
+auto HttpServer::send(int code, const char* contentType, const String& content) -> void {
+    Connection* conn = m_current;
+    if (conn == nullptr || conn->responded) {
+        return;
+    }
+
+    conn->responded = true;
+    conn->tx = buildHead(*conn, code, contentType != nullptr ? String(contentType) : String(), content.length());
+    if (conn->method != HTTP_HEAD && !conn->tx.concat(content)) {
+        sendUnavailable(*conn);
+    }
+
+    // write what fits right away, a handler may restart the device right after answering
+    pump(*conn);
+}
+
+/**
+ * @brief Answer the request being handled, only the first answer of a request is sent
+ * @param code HTTP status code
+ * @param contentType Content type
+ * @param content Response body
+ *
+ * @return void
+ */
+auto HttpServer::send(int code, const String& contentType, const String& content) -> void {
+    send(code, contentType.c_str(), content);
+}
+
+/**
+ * @brief Answer the request being handled with a body written straight into the transmit buffer
+ * @param code HTTP status code
+ * @param contentType Content type
+ * @param length Exact number of bytes body writes
+ * @param body Writes the body, called once
+ *
+ * @return void
+ */
+auto HttpServer::send(int code, const char* contentType, size_t length, const TBodyFunction& body) -> void {
+    Connection* conn = m_current;
+    if (conn == nullptr || conn->responded) {
+        return;
+    }
+
+    conn->responded = true;
+    conn->tx = buildHead(*conn, code, contentType != nullptr ? String(contentType) : String(), length);
+    if (conn->method != HTTP_HEAD) {
+        // Content-Length is announced, a body cut short by a failed allocation would leave the client waiting
+        if (conn->tx.reserve(conn->tx.length() + length)) {
+            StringPrint out(conn->tx);
+            body(out);
+        } else {
+            sendUnavailable(*conn);
+        }
+    }
+
+    pump(*conn);
+}
+
+/**
+ * @brief Answer the request being handled with a body of unknown length, sent with chunked transfer encoding
+ *
+ * The producer is called from the main loop whenever the connection has drained what it wrote before, so only a
+ * chunk is held in memory whatever the body size. It runs after the handler returned and must not use the request
+ * accessors, it captures what it needs
+ *
+ * @param code HTTP status code
+ * @param contentType Content type
+ * @param producer Writes the next part of the body, returns false once it wrote the last one. Writing nothing and
+ * returning true means nothing is ready yet, the producer is called again on the next pass
+ *
+ * @return void
+ */
+auto HttpServer::sendChunked(int code, const char* contentType, TChunkFunction producer) -> void {
+    Connection* conn = m_current;
+    if (conn == nullptr || conn->responded) {
+        return;
+    }
+
+    conn->responded = true;
+    conn->tx = buildHead(*conn, code, contentType != nullptr ? String(contentType) : String(), CONTENT_LENGTH_UNKNOWN);
+    if (conn->method != HTTP_HEAD) {
+        conn->txProducer = std::move(producer);
+    }
+
+    pump(*conn);
+}
+
+/**
+ * @brief Answer the request being handled with a file, streamed from the main loop as the send buffer drains
+ * @param file Open file, the server shares the handle and closes it once sent, the caller must not close it
+ * @param contentType Content type
+ *
+ * @return Number of bytes that will be sent
+ */
+auto HttpServer::streamFile(File& file, const String& contentType) -> size_t {
+    Connection* conn = m_current;
+    if (conn == nullptr || conn->responded) {
+        return 0;
+    }
+
+    size_t length =
+        conn->contentLengthOverride != CONTENT_LENGTH_UNKNOWN ? conn->contentLengthOverride : file.size();
+
+    conn->responded = true;
+    conn->tx = buildHead(*conn, HTTP_CODE_OK, contentType, length);
+    if (conn->method != HTTP_HEAD && length > 0) {
+        conn->txFile = file;
+        conn->txFileRemaining = length;
+    }
+
+    pump(*conn);
+
+    return length;
+}
+
+/**
+ * @brief Answer the request being handled with a body stored in flash, copied out as the send buffer drains
+ * @param code HTTP status code
+ * @param contentType Content type
+ * @param content PROGMEM body, must stay valid (a static array)
+ * @param length Body length
+ *
+ * @return void
+ */
+auto HttpServer::send_P(int code, const char* contentType, const uint8_t* content, size_t length) -> void {
+    Connection* conn = m_current;
+    if (conn == nullptr || conn->responded) {
+        return;
+    }
+
+    conn->responded = true;
+    conn->tx = buildHead(*conn, code, contentType != nullptr ? String(contentType) : String(), length);
+    if (conn->method != HTTP_HEAD && length > 0) {
+        conn->txFlash = content;
+        conn->txFlashRemaining = length;
+    }
+
+    pump(*conn);
+}
+
+/**
+ * @brief Replace a response that does not fit in memory by a 503, the connection is closed once it is sent
+ * @param conn Connection answered
+ *
+ * @return void
+ */
+auto HttpServer::sendUnavailable(Connection& conn) -> void {
+    const char* reason = reasonPhrase(HTTP_CODE_SERVICE_UNAVAILABLE);
+
+    conn.keepAlive = false;
+    conn.headers = "";  // they describe the response that was dropped
+    conn.tx = String();
+    conn.tx = buildHead(conn, HTTP_CODE_SERVICE_UNAVAILABLE, "text/plain", strlen(reason));
+    conn.tx += reason;
+}
+
+/**
+ * @brief Bytes reserved for plain request bodies over all connections
+ *
+ * @return Reserved bytes
+ */
+auto HttpServer::bufferedBodies() const -> size_t {
+    size_t total = 0;
+
+    for (const Connection* conn : m_connections) {
+        if (conn != nullptr) {
+            total += conn->bodyReserved;
+        }
+    }
+
+    return total;
+}
+
+/**
+ * @brief Number of open client connections
+ *
+ * @return Connection count
+ */
+auto HttpServer::getConnectionCount() const -> size_t {
+    return std::count_if(m_connections.begin(), m_connections.end(), [](const Connection* conn) {
+        return conn != nullptr;
+    });
+}
+
+/**
+ * @brief Build the status line and headers of a response
+ * @param conn Connection answered
+ * @param code HTTP status code
+ * @param contentType Content type, omitted if empty
+ * @param length Content length
+ *
+ * @return The response head including the blank line
+ */
+auto HttpServer::buildHead(Connection& conn, int code, const String& contentType, size_t length) const -> String {
+    String head;
+    head.reserve(96 + conn.headers.length() + contentType.length());  // NOLINT(readability-magic-numbers)
+
+    head += "HTTP/1.1 ";
+    head += String(code);
+    head += " ";
+    head += reasonPhrase(code);
+    head += "\r\n";
+
+    if (contentType.length() > 0) {
+        head += "Content-Type: " + contentType + "\r\n";
+    }
+
+    // a 304 has no body, a Content-Length there would describe the cached representation
+    if (length == CONTENT_LENGTH_UNKNOWN) {
+        head += "Transfer-Encoding: chunked\r\n";
+    } else if (code != HTTP_CODE_NOT_MODIFIED) {
+        head += "Content-Length: " + String(static_cast<unsigned long>(length)) + "\r\n";
+    }
+    head += conn.headers;
+    // announcing the idle timeout keeps the browser from reusing a connection the server is about to close
+    head += conn.keepAlive ? KEEP_ALIVE_HEADER : "Connection: close\r\n\r\n";
+
+    return head;
+}
+
+/**
+ * @brief Hand pending response bytes to lwIP as far as the send buffer allows
+ * @param conn Connection to write to
+ *
+ * @return true if anything was written
+ */
+auto HttpServer::pump(Connection& conn) -> bool {
+    if (conn.pcb == nullptr) {
+        return false;
+    }
+
+    bool wrote = false;
+
+    while (tcp_sndbuf(conn.pcb) > 0) {
+        size_t room = tcp_sndbuf(conn.pcb);
+
+        if (conn.txOffset < conn.tx.length()) {
+            size_t len = std::min(room, conn.tx.length() - conn.txOffset);
+            uint8_t flags = TCP_WRITE_FLAG_COPY | (conn.bodyPending() ? TCP_WRITE_FLAG_MORE : 0);
+            if (tcp_write(conn.pcb, conn.tx.c_str() + conn.txOffset, static_cast<uint16_t>(len), flags) != ERR_OK) {
+                break;
+            }
+
+            conn.txOffset += len;
+            wrote = true;
+            if (conn.txOffset >= conn.tx.length()) {
+                conn.tx = "";
+                conn.txOffset = 0;
+            }
+            continue;
+        }
+
+        if (conn.txProducer) {
+            nextChunk(conn);
+            if (conn.tx.length() == 0 && conn.txProducer) {
+                break;  // nothing ready yet, the next pass asks again
+            }
+            continue;
+        }
+
+        if (conn.txFlashRemaining > 0) {
+            // flash only allows aligned word reads, so the body goes through RAM
+            size_t len = std::min({room, m_chunk.size(), conn.txFlashRemaining});
+            memcpy_P(m_chunk.data(), conn.txFlash, len);
+            if (tcp_write(conn.pcb, m_chunk.data(), static_cast<uint16_t>(len), TCP_WRITE_FLAG_COPY) != ERR_OK) {
+                break;
+            }
+
+            conn.txFlash += len;
+            conn.txFlashRemaining -= len;
+            wrote = true;
+            continue;
+        }
+
+        if (!conn.txFile) {
+            break;
+        }
+
+        size_t len = conn.txFile.read(m_chunk.data(), std::min({room, m_chunk.size(), conn.txFileRemaining}));
+        if (len == 0) {
+            conn.keepAlive = false;  // file shorter than announced, the length can no longer be honoured
+            conn.txFile.close();
+            break;
+        }
+
+        if (tcp_write(conn.pcb, m_chunk.data(), static_cast<uint16_t>(len), TCP_WRITE_FLAG_COPY) != ERR_OK) {
+            conn.txFile.seek(conn.txFile.position() - len);
+            break;
+        }
+
+        wrote = true;
+        conn.txFileRemaining -= len;
+        if (conn.txFileRemaining == 0) {
+            conn.txFile.close();
+        }
+    }
+
+    if (wrote) {
+        tcp_output(conn.pcb);
+        conn.lastActivityMs = millis();
+    }
+
+    return wrote;
+}
+
+/**
+ * @brief Fill the transmit buffer with the next chunk of a sendChunked() body, and the last chunk once it is done
+ * @param conn Connection answered
+ *
+ * @return void
+ */
+auto HttpServer::nextChunk(Connection& conn) -> void {
+    String data;
+    data.reserve(CHUNK_TARGET + CHUNK_TARGET / 2);
+    StringPrint out(data);
+
+    // gather small writes up to about CHUNK_TARGET, every chunk costs a size line and a TCP write. A call that writes
+    // nothing has nothing ready yet: the producer is called again on the next pass instead of spinning here
+    bool more = true;
+    size_t before = 0;
+    do {
+        before = data.length();
+        more = conn.txProducer(out);
+    } while (more && data.length() > before && data.length() < CHUNK_TARGET);
+
+    conn.tx = "";
+    conn.txOffset = 0;
+
+    if (more && data.length() == 0) {
+        conn.lastActivityMs = millis();  // the producer is busy, the connection is not idle
+
+        return;
+    }
+
+    if (data.length() > 0) {
+        conn.tx.reserve(data.length() + 12);  // NOLINT(readability-magic-numbers)
+        conn.tx += String(static_cast<unsigned long>(data.length()), HEX);
+        conn.tx += "\r\n";
+        conn.tx += data;
+        conn.tx += "\r\n";
+    }
+
+    if (!more) {
+        conn.tx += "0\r\n\r\n";
+        conn.txProducer = nullptr;
+    }
+}
+
+/**
+ * @brief The response is handed to lwIP: wait for the next request or close
+ * @param conn Connection answered
+ *
+ * @return void
+ */
+auto HttpServer::finishResponse(Connection& conn) -> void {
+    if (conn.keepAlive && !conn.remoteClosed) {
+        conn.resetRequest();
+        conn.reused = true;
+        conn.lastActivityMs = millis();
+        return;
+    }
+
+    conn.closing = true;
+}
+
+/**
+ * @brief Release a connection slot, queued response data is still delivered by lwIP before the FIN
+ * @param slot Slot index
+ *
+ * @return void
+ */
+auto HttpServer::close(size_t slot) -> void {
+    Connection* conn = m_connections[slot];
+    if (conn == nullptr) {
+        return;
+    }
+
+    abortUpload(*conn);
+
+    if (conn->pcb != nullptr) {
+        tcp_arg(conn->pcb, nullptr);
+        tcp_recv(conn->pcb, nullptr);
+        tcp_err(conn->pcb, nullptr);
+
+        if (conn->rx != nullptr) {
+            tcp_recved(conn->pcb, conn->rx->tot_len);
+        }
+
+        if (tcp_close(conn->pcb) != ERR_OK) {
+            tcp_abort(conn->pcb);
+        }
+    }
+
+    if (conn->rx != nullptr) {
+        pbuf_free(conn->rx);
+    }
+
+    if (m_current == conn) {
+        m_current = nullptr;
+    }
+
+    delete conn;
+    m_connections[slot] = nullptr;
+}
+
+/**
+ * @brief Add the arguments of a query string or urlencoded form
+ * @param conn Connection to add to
+ * @param query "a=1&b=2" formatted arguments
+ *
+ * @return void
+ */
+auto HttpServer::parseArgs(Connection& conn, const String& query) -> void {
+    int start = 0;
+
+    while (start < static_cast<int>(query.length())) {
+        int end = query.indexOf('&', start);
+        if (end < 0) {
+            end = static_cast<int>(query.length());
+        }
+
+        String pair = query.substring(start, end);
+        if (!pair.isEmpty()) {
+            int equals = pair.indexOf('=');
+            if (equals < 0) {
+                conn.args.emplace_back(urlDecode(pair), String());
+            } else {
+                conn.args.emplace_back(urlDecode(pair.substring(0, equals)), urlDecode(pair.substring(equals + 1)));
+            }
+        }
+
+        start = end + 1;
+    }
+}
+
+/**
+ * @brief Decode %XX escapes and '+' of a URL component
+ * @param text Encoded text
+ *
+ * @return The decoded text
+ */
+auto HttpServer::urlDecode(const String& text) -> String {
+    String decoded;
+    decoded.reserve(text.length());
+
+    for (size_t i = 0; i < text.length(); ++i) {
+        char current = text[i];
+
+        if (current == '+') {
+            decoded += ' ';
+        } else if (current == '%' && i + 2 < text.length() && isxdigit(text[i + 1]) != 0 &&
+                   isxdigit(text[i + 2]) != 0) {
+            char hex[3] = {text[i + 1], text[i + 2], '\0'};
+            decoded += static_cast<char>(strtol(hex, nullptr, 16));  // NOLINT(readability-magic-numbers)
+            i += 2;
+        } else {
+            decoded += current;
+        }
+    }
+
+    return decoded;
+}
+
+/**
+ * @brief Reason phrase of the status codes the firmware answers with
+ * @param code HTTP status code
+ *
+ * @return The reason phrase
+ */
+auto HttpServer::reasonPhrase(int code) -> const char* {
+    switch (code) {
+        case HTTP_CODE_OK:
+            return "OK";
+        case HTTP_CODE_ACCEPTED:
+            return "Accepted";
+        case HTTP_CODE_NOT_MODIFIED:
+            return "Not Modified";
+        case HTTP_CODE_BAD_REQUEST:
+            return "Bad Request";
+        case HTTP_CODE_NOT_FOUND:
+            return "Not Found";
+        case HTTP_CODE_PAYLOAD_TOO_LARGE:
+            return "Payload Too Large";
+        case HTTP_CODE_RANGE_NOT_SATISFIABLE:
+            return "Range Not Satisfiable";
+        case HTTP_CODE_INTERNAL_ERROR:
+            return "Internal Server Error";
+        case HTTP_CODE_SERVICE_UNAVAILABLE:
+            return "Service Unavailable";
+        default:
+            return "";
+    }
+}
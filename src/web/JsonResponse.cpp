@@ -0,0 +1,129 @@
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <memory>
+
+#include "web/JsonResponse.h"
+#include "web/JsonListWriter.h"
+
+/**
+ * @brief Progress of a streamed JSON list, shared by the chunk producer across main loop passes
+ */
+struct JsonListState {
+    JsonListState(const String& head, const char* key, size_t limit) : writer(head.c_str(), key, limit) {}
+
+    JsonListWriter writer;
+    bool headSent = false;
+    JsonListNextFn next;
+    JsonDocument item;
+};
+
+static constexpr const char* MSGPACK_TYPE = "application/msgpack";
+
+/**
+ * @brief Whether a Content-Type or Accept value names MessagePack
+ * @param value Header value
+ *
+ * @return true for application/msgpack or application/x-msgpack
+ */
+static auto isMsgPack(const String& value) -> bool {
+    return value.indexOf(MSGPACK_TYPE) >= 0 || value.indexOf("application/x-msgpack") >= 0;
+}
+
+/**
+ * @brief Parse the request body, MessagePack when the Content-Type says so and JSON otherwise
+ *
+ * The body is read in place from the server buffer, both encodings fill the same document so the handlers do not
+ * care which one the client used
+ *
+ * @param webserver Pointer to the Webserver instance
+ * @param doc Document to fill
+ *
+ * @return The parse error, Ok on success
+ */
+auto readJsonBody(Webserver* webserver, JsonDocument& doc) -> DeserializationError {
+    const String& body = webserver->raw().body();
+
+    if (isMsgPack(webserver->raw().contentType())) {
+        return deserializeMsgPack(doc, body.c_str(), body.length());
+    }
+
+    return deserializeJson(doc, body.c_str(), body.length());
+}
+
+/**
+ * @brief Send a document, serialised straight into the response without an intermediate String
+ *
+ * The answer is MessagePack when the Accept header of the request asks for it (the header is collected by
+ * registerApiEndpoints()), JSON otherwise
+ *
+ * @param webserver Pointer to the Webserver instance
+ * @param code HTTP status code
+ * @param doc Document to send
+ *
+ * @return void
+ */
+void sendJson(Webserver* webserver, int code, const JsonDocument& doc) {
+    HttpServer& server = webserver->raw();
+    server.sendHeader("Vary", "Accept");
+
+    if (isMsgPack(server.header("Accept"))) {
+        server.send(code, MSGPACK_TYPE, measureMsgPack(doc), [&doc](Print& out) { serializeMsgPack(doc, out); });
+
+        return;
+    }
+
+    server.send(code, "application/json", measureJson(doc), [&doc](Print& out) { serializeJson(doc, out); });
+}
+
+/**
+ * @brief Send {<head members>, "<key>": [items], "next": cursor} with chunked transfer encoding, one item at a time
+ *
+ * The items are pulled from next as the connection drains, so the memory used does not depend on the list length.
+ * "next" is the cursor of the last item sent when limit cut the list, null once the list is complete. A list is
+ * always JSON: a MessagePack array starts with its length, which is unknown until the end
+ *
+ * @param webserver Pointer to the Webserver instance
+ * @param head Object whose members come before the list, computed up front
+ * @param key Name of the list member
+ * @param limit Maximum number of items, SIZE_MAX for all
+ * @param next Item producer, called from the main loop after the handler returned
+ *
+ * @return void
+ */
+void sendJsonList(Webserver* webserver, const JsonDocument& head, const char* key, size_t limit, JsonListNextFn next) {
+    String headJson;
+    serializeJson(head, headJson);
+
+    auto state = std::make_shared<JsonListState>(headJson, key, limit);
+    state->next = std::move(next);
+
+    webserver->raw().sendChunked(HTTP_CODE_OK, "application/json", [state](Print& out) -> bool {
+        if (!state->headSent) {
+            state->writer.writeHead(out);
+            state->headSent = true;
+
+            return true;
+        }
+
+        state->item.clear();
+        String cursor;
+        const JsonListStep step = state->next(state->item, cursor);
+
+        if (step == JsonListStep::Pending) {
+            return true;  // nothing written, the server calls again on its next pass
+        }
+
+        const bool hasItem = step == JsonListStep::Item;
+
+        if (hasItem && state->writer.beginItem(out, cursor.c_str())) {
+            serializeJson(state->item, out);
+
+            return true;
+        }
+
+        // an item left over means the limit cut the list, the client resumes after the last one sent
+        state->writer.writeEnd(out, hasItem);
+
+        return false;
+    });
+}
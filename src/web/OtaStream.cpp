@@ -0,0 +1,531 @@
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <Logger.h>
+#include <Updater.h>
+#include <cstring>
+
+#include "web/OtaStream.h"
+
+static constexpr size_t SKETCH_RESERVE = 0x1000;
+static constexpr uint32_t SKETCH_MASK = 0xFFFFF000;
+static constexpr uint8_t DELTA_VERSION = 1;
+static constexpr uint8_t DELTA_OP_COPY = 0x00;
+static constexpr uint8_t DELTA_OP_DATA = 0x01;
+static constexpr uint8_t VARINT_MAX_SHIFT = 28;
+static constexpr size_t MD5_SIZE = 16;
+static constexpr uint8_t GZIP_MAGIC_0 = 0x1F;
+static constexpr uint8_t GZIP_MAGIC_1 = 0x8B;
+
+// Updater has no abort, end() refuses an image whose MD5 does not match and forgets it
+static constexpr const char* DISCARD_MD5 = "00000000000000000000000000000000";
+
+/**
+ * @brief Read a little endian 32 bit value
+ *
+ * @param data First byte
+ * @return value
+ */
+static auto readU32(const uint8_t* data) -> uint32_t {
+    return static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8) |
+           (static_cast<uint32_t>(data[2]) << 16) | (static_cast<uint32_t>(data[3]) << 24);
+}
+
+/**
+ * @brief Decode a hexadecimal digest
+ *
+ * @param hex Digest as hexadecimal digits
+ * @param out Receives the bytes
+ * @param size Expected number of bytes
+ * @return true if hex holds exactly size bytes
+ */
+static auto parseHex(const String& hex, uint8_t* out, size_t size) -> bool {
+    if (hex.length() != size * 2) {
+        return false;
+    }
+
+    for (size_t i = 0; i < size * 2; i++) {
+        const char digit = hex[i];
+        uint8_t value = 0;
+
+        if (digit >= '0' && digit <= '9') {
+            value = digit - '0';
+        } else if (digit >= 'a' && digit <= 'f') {
+            value = digit - 'a' + 10;
+        } else if (digit >= 'A' && digit <= 'F') {
+            value = digit - 'A' + 10;
+        } else {
+            return false;
+        }
+
+        out[i / 2] = (i % 2 == 0) ? static_cast<uint8_t>(value << 4) : static_cast<uint8_t>(out[i / 2] | value);
+    }
+
+    return true;
+}
+
+/**
+ * @brief Start an update
+ *
+ * @param mode U_FLASH or U_FS
+ * @param sha256 Expected SHA-256 of the image as written, 64 hexadecimal digits, empty to skip the check
+ * @return true if Updater is ready
+ */
+auto OtaStream::begin(int mode, const String& sha256) -> bool {
+    m_mode = mode;
+    m_format = OtaFormat::Unknown;
+    m_received = 0;
+    m_written = 0;
+    m_startMs = millis();
+    m_elapsedMs = 0;
+    m_failed = false;
+    m_error = String();
+    m_state = DeltaState::Header;
+    m_headerFill = 0;
+    m_sourcePos = 0;
+
+    m_verify = !sha256.isEmpty();
+    if (m_verify && !parseHex(sha256, m_expected.data(), m_expected.size())) {
+        return fail("sha256 must be 64 hexadecimal digits");
+    }
+    br_sha256_init(&m_sha);
+
+    if (!Update.begin(available(mode), mode)) {
+        return fail(Update.getErrorString());
+    }
+
+    return true;
+}
+
+/**
+ * @brief Feed the next bytes of the upload
+ *
+ * @param data Uploaded bytes
+ * @param len Number of bytes
+ * @return false once the update failed, the rest of the upload is then ignored
+ */
+auto OtaStream::write(const uint8_t* data, size_t len) -> bool {
+    if (m_failed) {
+        return false;
+    }
+
+    if (m_format == OtaFormat::Unknown && !detect(data, len)) {
+        return false;
+    }
+
+    m_received += len;
+
+    return m_format == OtaFormat::Delta ? writeDelta(data, len) : emit(data, len);
+}
+
+/**
+ * @brief Check the image and activate it for the next boot
+ *
+ * @return true if the image is installed
+ */
+auto OtaStream::end() -> bool {
+    m_elapsedMs = millis() - m_startMs;
+
+    if (m_failed) {
+        return false;
+    }
+
+    if (m_format == OtaFormat::Delta && (m_state != DeltaState::Op || m_written != m_targetSize)) {
+        discard();
+
+        return fail("Incomplete delta, " + String(m_written) + " of " + String(m_targetSize) + " bytes rebuilt");
+    }
+
+    if (m_verify) {
+        std::array<uint8_t, SHA256_SIZE> digest{};
+        br_sha256_out(&m_sha, digest.data());
+
+        if (digest != m_expected) {
+            discard();
+
+            return fail("SHA-256 mismatch, the image was dropped");
+        }
+    }
+
+    if (!Update.end(true)) {
+        return fail(Update.getErrorString());
+    }
+
+    return true;
+}
+
+/**
+ * @brief Drop the update
+ *
+ * @return void
+ */
+auto OtaStream::abort() -> void {
+    m_elapsedMs = millis() - m_startMs;
+    discard();
+    fail("Update aborted");
+}
+
+/**
+ * @brief Form the upload was recognised as
+ *
+ * @return format, Unknown before the first bytes
+ */
+auto OtaStream::getFormat() const -> OtaFormat { return m_format; }
+
+/**
+ * @brief Bytes received over the network
+ *
+ * @return byte count
+ */
+auto OtaStream::getReceived() const -> size_t { return m_received; }
+
+/**
+ * @brief Bytes handed to Updater, the rebuilt firmware for a delta
+ *
+ * @return byte count
+ */
+auto OtaStream::getWritten() const -> size_t { return m_written; }
+
+/**
+ * @brief Duration of the update from begin() to end() or abort()
+ *
+ * @return milliseconds
+ */
+auto OtaStream::getElapsedMs() const -> uint32_t { return m_elapsedMs; }
+
+/**
+ * @brief Why the update failed
+ *
+ * @return message, empty without failure
+ */
+auto OtaStream::getError() const -> const String& { return m_error; }
+
+/**
+ * @brief API name of an upload format
+ *
+ * @param format Upload format
+ * @return name
+ */
+auto OtaStream::formatName(OtaFormat format) -> const char* {
+    switch (format) {
+        case OtaFormat::Raw:
+            return "bin";
+        case OtaFormat::Gzip:
+            return "gzip";
+        case OtaFormat::Delta:
+            return "delta";
+        default:
+            return "unknown";
+    }
+}
+
+/**
+ * @brief Largest image Updater can take
+ *
+ * @param mode U_FLASH or U_FS
+ * @return bytes
+ */
+auto OtaStream::available(int mode) -> size_t {
+    if (mode == U_FS) {
+        FSInfo info;
+
+        return LittleFS.info(info) ? info.totalBytes : 0;
+    }
+
+    return (ESP.getFreeSketchSpace() - SKETCH_RESERVE) &  // NOLINT(readability-static-accessed-through-instance)
+           SKETCH_MASK;
+}
+
+/**
+ * @brief Stop Updater without activating what it received, even a complete image
+ *
+ * @return void
+ */
+auto OtaStream::discard() -> void {
+    if (!Update.isRunning()) {
+        return;
+    }
+
+    Update.setMD5(DISCARD_MD5);
+    Update.end();
+    Update.clearError();
+}
+
+/**
+ * @brief Recognise the format from the first bytes
+ *
+ * @param data First uploaded bytes
+ * @param len Number of bytes
+ * @return false if the format is not allowed for this update
+ */
+auto OtaStream::detect(const uint8_t* data, size_t len) -> bool {
+    if (len >= 2 && data[0] == GZIP_MAGIC_0 && data[1] == GZIP_MAGIC_1) {
+        m_format = OtaFormat::Gzip;
+    } else if (len >= 4 && memcmp(data, "GDLT", 4) == 0) {
+        m_format = OtaFormat::Delta;
+    } else {
+        m_format = OtaFormat::Raw;
+    }
+
+    if (m_mode == U_FS && m_format != OtaFormat::Raw) {
+        discard();
+
+        return fail("File system images are only accepted uncompressed");
+    }
+
+    Logger::info((String("OTA image format: ") + formatName(m_format)).c_str(), "OtaStream");
+
+    return true;
+}
+
+/**
+ * @brief Hand image bytes to Updater
+ *
+ * @param data Image bytes
+ * @param len Number of bytes
+ * @return true if Updater took them
+ */
+auto OtaStream::emit(const uint8_t* data, size_t len) -> bool {
+    if (m_verify) {
+        br_sha256_update(&m_sha, data, len);
+    }
+
+    if (Update.write(const_cast<uint8_t*>(data), len) != len) {
+        return fail(Update.getErrorString());
+    }
+
+    m_written += len;
+
+    return true;
+}
+
+/**
+ * @brief Run the delta operations contained in the next uploaded bytes
+ *
+ * @param data Uploaded bytes
+ * @param len Number of bytes
+ * @return false if the delta is invalid or Updater failed
+ */
+auto OtaStream::writeDelta(const uint8_t* data, size_t len) -> bool {
+    while (len > 0) {
+        switch (m_state) {
+            case DeltaState::Header: {
+                const size_t take = std::min(len, DELTA_HEADER_SIZE - m_headerFill);
+                memcpy(m_header.data() + m_headerFill, data, take);
+                m_headerFill += take;
+                data += take;
+                len -= take;
+
+                if (m_headerFill == DELTA_HEADER_SIZE && !checkDeltaHeader()) {
+                    return false;
+                }
+                break;
+            }
+
+            case DeltaState::Op:
+                if (m_written == m_targetSize) {
+                    discard();
+
+                    return fail("Data after the end of the delta");
+                }
+
+                m_op = *data;
+                if (m_op != DELTA_OP_COPY && m_op != DELTA_OP_DATA) {
+                    discard();
+
+                    return fail("Unknown delta operation " + String(m_op));
+                }
+
+                m_varintIndex = 0;
+                m_varint = 0;
+                m_varintShift = 0;
+                m_state = DeltaState::Varint;
+                data++;
+                len--;
+                break;
+
+            case DeltaState::Varint: {
+                const uint8_t byte = *data;
+                data++;
+                len--;
+
+                if (takeVarint(byte) && !endVarint()) {
+                    return false;
+                }
+                break;
+            }
+
+            case DeltaState::Data: {
+                const size_t take = std::min(len, m_remaining);
+                if (!emit(data, take)) {
+                    return false;
+                }
+
+                data += take;
+                len -= take;
+                m_remaining -= take;
+                if (m_remaining == 0) {
+                    m_state = DeltaState::Op;
+                }
+                break;
+            }
+        }
+
+        if (m_failed) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Check that the delta was made against the running sketch
+ *
+ * @return true if it can be applied
+ */
+auto OtaStream::checkDeltaHeader() -> bool {
+    m_sourceSize = readU32(m_header.data() + 8);
+    m_targetSize = readU32(m_header.data() + 12);
+
+    const String sketchMd5 = ESP.getSketchMD5();  // NOLINT(readability-static-accessed-through-instance)
+    std::array<uint8_t, MD5_SIZE> running{};
+    const bool knownSketch = parseHex(sketchMd5, running.data(), running.size());
+
+    if (memcmp(m_header.data(), "GDLT", 4) != 0 || m_header[4] != DELTA_VERSION) {
+        discard();
+
+        return fail("Unsupported delta version");
+    }
+
+    if (!knownSketch || m_sourceSize != ESP.getSketchSize() ||  // NOLINT(readability-static-accessed-through-instance)
+        memcmp(m_header.data() + 16, running.data(), running.size()) != 0) {
+        discard();
+
+        return fail("The delta was made for another firmware than the running one");
+    }
+
+    if (m_targetSize == 0 || m_targetSize > available(m_mode)) {
+        discard();
+
+        return fail("Unsupported firmware size " + String(m_targetSize));
+    }
+
+    m_state = DeltaState::Op;
+
+    return true;
+}
+
+/**
+ * @brief Accumulate one byte of a varint
+ *
+ * @param byte Next byte
+ * @return true once the varint is complete
+ */
+auto OtaStream::takeVarint(uint8_t byte) -> bool {
+    if (m_varintShift > VARINT_MAX_SHIFT) {
+        fail("Invalid varint in the delta");
+
+        return true;
+    }
+
+    m_varint |= static_cast<uint32_t>(byte & 0x7F) << m_varintShift;
+    m_varintShift += 7;
+
+    return (byte & 0x80) == 0;
+}
+
+/**
+ * @brief Use a complete varint: the source offset change or the length of the operation
+ *
+ * @return false if the operation is invalid
+ */
+auto OtaStream::endVarint() -> bool {
+    if (m_failed) {
+        discard();
+
+        return false;
+    }
+
+    const uint32_t value = m_varint;
+    m_varint = 0;
+    m_varintShift = 0;
+
+    if (m_op == DELTA_OP_COPY && m_varintIndex == 0) {
+        // zigzag: 0, -1, 1, -2... are 0, 1, 2, 3...
+        m_copyChange = static_cast<int32_t>(value >> 1) ^ -static_cast<int32_t>(value & 1);
+        m_varintIndex = 1;
+
+        return true;
+    }
+
+    m_remaining = value;
+    if (m_remaining == 0 || m_written + m_remaining > m_targetSize) {
+        discard();
+
+        return fail("Delta operation past the end of the firmware");
+    }
+
+    if (m_op == DELTA_OP_DATA) {
+        m_state = DeltaState::Data;
+
+        return true;
+    }
+
+    const int64_t source = static_cast<int64_t>(m_sourcePos) + m_copyChange;
+    if (source < 0 || static_cast<size_t>(source) + m_remaining > m_sourceSize) {
+        discard();
+
+        return fail("Delta copy outside the running firmware");
+    }
+
+    m_sourcePos = static_cast<size_t>(source);
+    m_state = DeltaState::Op;
+
+    return copySource();
+}
+
+/**
+ * @brief Copy m_remaining bytes of the running sketch from m_sourcePos
+ *
+ * @return true if Updater took them
+ */
+auto OtaStream::copySource() -> bool {
+    std::array<uint8_t, COPY_BUFFER> buffer{};
+
+    while (m_remaining > 0) {
+        const size_t take = std::min(m_remaining, buffer.size());
+
+        // the sketch starts at offset 0 of the flash
+        if (!ESP.flashRead(m_sourcePos, buffer.data(), take)) {  // NOLINT(readability-static-accessed-through-instance)
+            discard();
+
+            return fail("Cannot read the running firmware");
+        }
+
+        if (!emit(buffer.data(), take)) {
+            return false;
+        }
+
+        m_sourcePos += take;
+        m_remaining -= take;
+
+        // a long copy erases many sectors, keep the watchdog and the network fed
+        yield();
+    }
+
+    return true;
+}
+
+/**
+ * @brief Record a failure
+ *
+ * @param error Message for the client
+ * @return false, for the caller to return
+ */
+auto OtaStream::fail(const String& error) -> bool {
+    m_failed = true;
+    m_error = error;
+    Logger::error(error.c_str(), "OtaStream");
+
+    return false;
+}
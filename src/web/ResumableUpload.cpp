@@ -0,0 +1,489 @@
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <LittleFS.h>
+#include <Logger.h>
+#include <Updater.h>
+
+#include "web/ResumableUpload.h"
+#include "web/FileMd5.h"
+#include "web/OtaStream.h"
+
+static constexpr size_t MD5_HEX_LENGTH = 32;
+
+/**
+ * @brief Start an upload session, or return the running one if it is the same upload
+ *
+ * @param target Where the data goes
+ * @param path Final path of a file target, ignored for firmware and file system images
+ * @param size Total size of the upload in bytes
+ * @param headerSize Bytes the first range must hold for check, at most UploadWriter::BUFFER_SIZE
+ * @param check Check of the first range before anything is written, nullptr to accept any content
+ * @return true if the session is ready, getOffset() tells where the next range starts
+ */
+auto ResumableUpload::create(UploadTarget target, const String& path, size_t size, size_t headerSize,
+                             UploadWriter::THeaderCheck check) -> bool {
+    restore();
+    m_failure = UploadFailure::None;
+    m_error = String();
+
+    // the same upload asked again resumes where it stopped
+    if (m_active && m_target == target && m_path == path && m_size == size) {
+        if (m_offset == 0) {
+            m_headerSize = std::min(headerSize, UploadWriter::BUFFER_SIZE);
+            m_check = std::move(check);
+        }
+
+        return true;
+    }
+
+    if (m_active) {
+        cancel(m_id);
+    }
+
+    // an empty file needs no range, an image or a checked file cannot be empty
+    if (size == 0 && (target != UploadTarget::File || check)) {
+        return fail(UploadFailure::Rejected, "Empty upload");
+    }
+
+    m_target = target;
+    m_path = path;
+    m_size = size;
+    m_offset = 0;
+    m_headerSize = std::min(headerSize, UploadWriter::BUFFER_SIZE);
+    m_check = std::move(check);
+    m_id = String(ESP.random(), HEX);  // NOLINT(readability-static-accessed-through-instance)
+
+    if (target != UploadTarget::File) {
+        if (!beginUpdate()) {
+            clear();
+
+            return false;
+        }
+
+        m_active = true;
+
+        return true;
+    }
+
+    FSInfo info;
+    if (LittleFS.info(info) && size > info.totalBytes - info.usedBytes) {
+        clear();
+
+        return fail(UploadFailure::NoSpace, "Not enough space on the file system");
+    }
+
+    File part = LittleFS.open(tempPath(), "w");
+    if (!part) {
+        clear();
+
+        return fail(UploadFailure::WriteFailed, "Cannot create the file");
+    }
+    part.close();
+
+    m_active = true;
+    if (!save()) {
+        LittleFS.remove(tempPath());
+        clear();
+
+        return fail(UploadFailure::WriteFailed, "Cannot save the upload session");
+    }
+
+    Logger::info((String("Upload session ") + m_id + " for " + m_path + ", " + String(m_size) + " bytes").c_str(),
+                 "ResumableUpload");
+
+    return true;
+}
+
+/**
+ * @brief Write one range, it has to start at the committed offset
+ *
+ * @param uploadId Session id
+ * @param start Offset of the first byte of the range
+ * @param data Bytes of the range
+ * @param len Number of bytes
+ * @return true once the range is committed, getOffset() is then the end of the range
+ */
+auto ResumableUpload::write(const String& uploadId, size_t start, const uint8_t* data, size_t len) -> bool {
+    if (!session(uploadId)) {
+        return false;
+    }
+
+    if (start != m_offset || len == 0 || start + len > m_size) {
+        return fail(UploadFailure::OutOfRange, "Expected a range starting at " + String(m_offset));
+    }
+
+    if (m_offset == 0 && m_check) {
+        if (len < m_headerSize && len < m_size) {
+            return fail(UploadFailure::Rejected, "The first range has to hold the file header");
+        }
+
+        String error;
+        if (!m_check(data, len, error)) {
+            cancel(m_id);
+
+            return fail(UploadFailure::Rejected, error);
+        }
+
+        m_check = nullptr;
+    }
+
+    if (m_target == UploadTarget::File) {
+        return writeFile(data, len);
+    }
+
+    if (Update.write(const_cast<uint8_t*>(data), len) != len) {
+        const String error = Update.getErrorString();
+        cancel(m_id);
+
+        return fail(UploadFailure::WriteFailed, error);
+    }
+
+    m_offset += len;
+
+    return true;
+}
+
+/**
+ * @brief Check the MD5 of the complete upload and install it
+ *
+ * A file replaces its target, an image is activated for the next boot. A checksum mismatch drops the session
+ *
+ * @param uploadId Session id
+ * @param md5 MD5 of the whole upload, 32 hexadecimal digits
+ * @return true if the upload is installed
+ */
+auto ResumableUpload::finish(const String& uploadId, const String& md5) -> bool {
+    if (!session(uploadId)) {
+        return false;
+    }
+
+    if (m_offset != m_size) {
+        return fail(UploadFailure::OutOfRange,
+                    "Incomplete upload, " + String(m_offset) + " of " + String(m_size) + " bytes received");
+    }
+
+    if (md5.length() != MD5_HEX_LENGTH) {
+        return fail(UploadFailure::BadChecksum, "The MD5 of the upload is required");
+    }
+
+    return m_target == UploadTarget::File ? finishFile(md5) : finishUpdate(md5);
+}
+
+/**
+ * @brief Drop a session and what it wrote
+ *
+ * @param uploadId Session id
+ * @return true if the session existed
+ */
+auto ResumableUpload::cancel(const String& uploadId) -> bool {
+    if (!session(uploadId)) {
+        return false;
+    }
+
+    if (m_target == UploadTarget::File) {
+        LittleFS.remove(tempPath());
+        LittleFS.remove(SESSION_PATH);
+    } else {
+        OtaStream::discard();
+    }
+
+    Logger::info((String("Upload session ") + m_id + " cancelled").c_str(), "ResumableUpload");
+    clear();
+
+    return true;
+}
+
+/**
+ * @brief Whether a session is open, including one saved before a reboot
+ *
+ * @return true if a session is open
+ */
+auto ResumableUpload::isActive() -> bool {
+    restore();
+
+    return m_active;
+}
+
+/**
+ * @brief Id of the session, the client sends it with every range
+ *
+ * @return id, empty without session
+ */
+auto ResumableUpload::getId() const -> const String& { return m_id; }
+
+/**
+ * @brief Where the session writes
+ *
+ * @return target
+ */
+auto ResumableUpload::getTarget() const -> UploadTarget { return m_target; }
+
+/**
+ * @brief Final path of a file upload
+ *
+ * @return path, empty for images
+ */
+auto ResumableUpload::getPath() const -> const String& { return m_path; }
+
+/**
+ * @brief Total size announced at creation
+ *
+ * @return size in bytes
+ */
+auto ResumableUpload::getSize() const -> size_t { return m_size; }
+
+/**
+ * @brief Bytes committed so far, the next range starts there
+ *
+ * @return offset in bytes
+ */
+auto ResumableUpload::getOffset() const -> size_t { return m_offset; }
+
+/**
+ * @brief Why the last call failed
+ *
+ * @return None if it succeeded
+ */
+auto ResumableUpload::getFailure() const -> UploadFailure { return m_failure; }
+
+/**
+ * @brief Message of the last failure, for the client
+ *
+ * @return message, empty without failure
+ */
+auto ResumableUpload::getError() const -> const String& { return m_error; }
+
+/**
+ * @brief Reload the session saved before a reboot, once
+ *
+ * The committed offset is the size of the partial file, LittleFS only makes a write durable when the file is closed
+ *
+ * @return void
+ */
+auto ResumableUpload::restore() -> void {
+    if (m_restored) {
+        return;
+    }
+    m_restored = true;
+
+    File file = LittleFS.open(SESSION_PATH, "r");
+    if (!file) {
+        return;
+    }
+
+    JsonDocument doc;
+    const DeserializationError error = deserializeJson(doc, file);
+    file.close();
+
+    m_id = doc["id"] | "";
+    m_path = doc["path"] | "";
+    m_size = doc["size"] | 0;
+
+    File part = error || m_id.isEmpty() || m_path.isEmpty() ? File() : LittleFS.open(tempPath(), "r");
+    if (!part || part.size() > m_size) {
+        Logger::warn("Dropping an unusable upload session", "ResumableUpload");
+        if (!m_path.isEmpty()) {
+            LittleFS.remove(tempPath());
+        }
+        LittleFS.remove(SESSION_PATH);
+        clear();
+
+        return;
+    }
+
+    m_offset = part.size();
+    part.close();
+    m_target = UploadTarget::File;
+    m_active = true;
+
+    Logger::info((String("Upload session ") + m_id + " for " + m_path + " resumes at " + String(m_offset)).c_str(),
+                 "ResumableUpload");
+}
+
+/**
+ * @brief Save the session of a file upload, the offset is not saved, see restore()
+ *
+ * @return true if saved
+ */
+auto ResumableUpload::save() const -> bool {
+    JsonDocument doc;
+    doc["id"] = m_id;
+    doc["path"] = m_path;
+    doc["size"] = m_size;
+
+    File file = LittleFS.open(SESSION_PATH, "w");
+    if (!file) {
+        return false;
+    }
+
+    const size_t written = serializeJson(doc, file);
+    file.close();
+
+    return written > 0;
+}
+
+/**
+ * @brief Partial file of a file upload
+ *
+ * @return path + UploadWriter::TEMP_SUFFIX
+ */
+auto ResumableUpload::tempPath() const -> String { return m_path + UploadWriter::TEMP_SUFFIX; }
+
+/**
+ * @brief Check that a request belongs to the open session
+ *
+ * @param uploadId Session id sent by the client
+ * @return true if it does
+ */
+auto ResumableUpload::session(const String& uploadId) -> bool {
+    restore();
+
+    if (!m_active || uploadId.isEmpty() || uploadId != m_id) {
+        return fail(UploadFailure::NoSession, "No upload session " + uploadId);
+    }
+
+    m_failure = UploadFailure::None;
+    m_error = String();
+
+    return true;
+}
+
+/**
+ * @brief Start Updater for a firmware or file system image of the session size
+ *
+ * @return true if Updater accepted the image
+ */
+auto ResumableUpload::beginUpdate() -> bool {
+    const int mode = m_target == UploadTarget::Firmware ? U_FLASH : U_FS;
+    const size_t room = OtaStream::available(mode);
+
+    if (m_size > room) {
+        return fail(UploadFailure::NoSpace, "The image is larger than the " + String(room) + " bytes available");
+    }
+
+    if (!Update.begin(m_size, mode)) {
+        const String error = Update.getErrorString();
+        Logger::error(("Update.begin failed: " + error).c_str(), "ResumableUpload");
+
+        return fail(UploadFailure::WriteFailed, error);
+    }
+
+    return true;
+}
+
+/**
+ * @brief Append a range to the partial file and commit it
+ *
+ * @param data Bytes of the range
+ * @param len Number of bytes
+ * @return true if the whole range was written, the offset follows the file either way
+ */
+auto ResumableUpload::writeFile(const uint8_t* data, size_t len) -> bool {
+    File part = LittleFS.open(tempPath(), "a");
+    if (!part) {
+        return fail(UploadFailure::WriteFailed, "Cannot open the partial file");
+    }
+
+    const size_t written = part.write(data, len);
+    m_offset = part.size();
+    part.close();
+
+    if (written != len) {
+        Logger::error((String("Short write to ") + tempPath()).c_str(), "ResumableUpload");
+
+        return fail(UploadFailure::WriteFailed, "Write to the file system failed");
+    }
+
+    return true;
+}
+
+/**
+ * @brief Verify the MD5 of the partial file as stored and rename it over the target
+ *
+ * @param md5 Expected MD5
+ * @return true if the file is in place
+ */
+auto ResumableUpload::finishFile(const String& md5) -> bool {
+    const String digest = FileMd5::of(tempPath());
+    if (digest.isEmpty()) {
+        return fail(UploadFailure::WriteFailed, "Cannot open the partial file");
+    }
+
+    if (!digest.equalsIgnoreCase(md5)) {
+        Logger::error((String("MD5 mismatch for ") + m_path + ", dropping the upload").c_str(), "ResumableUpload");
+        cancel(m_id);
+
+        return fail(UploadFailure::BadChecksum, "Checksum mismatch, the upload has to start over");
+    }
+
+    // LittleFS renames over an existing file in one commit, readers see the old file or the new one
+    if (!LittleFS.rename(tempPath(), m_path)) {
+        return fail(UploadFailure::WriteFailed, "Cannot replace the file");
+    }
+
+    LittleFS.remove(SESSION_PATH);
+    Logger::info((String("Upload of ") + m_path + " complete, " + String(m_size) + " bytes").c_str(),
+                 "ResumableUpload");
+    clear();
+
+    return true;
+}
+
+/**
+ * @brief Let Updater verify the MD5 and activate the image
+ *
+ * @param md5 Expected MD5
+ * @return true if the image is activated for the next boot
+ */
+auto ResumableUpload::finishUpdate(const String& md5) -> bool {
+    const bool filesystem = m_target == UploadTarget::Filesystem;
+
+    // end() drops the image on a mismatch, the session is over either way
+    Update.setMD5(md5.c_str());
+    const bool installed = Update.end();
+    const bool checksum = Update.getError() == UPDATE_ERROR_MD5;
+    const String error = Update.getErrorString();
+    clear();
+
+    if (!installed) {
+        Logger::error(("Update.end failed: " + error).c_str(), "ResumableUpload");
+
+        return fail(checksum ? UploadFailure::BadChecksum : UploadFailure::WriteFailed, error);
+    }
+
+    if (filesystem) {
+        Logger::info("File system image installed, mounting file system...", "ResumableUpload");
+        LittleFS.begin();
+    }
+
+    return true;
+}
+
+/**
+ * @brief Forget the session, what it wrote is left as is
+ *
+ * @return void
+ */
+auto ResumableUpload::clear() -> void {
+    m_active = false;
+    m_id = String();
+    m_path = String();
+    m_size = 0;
+    m_offset = 0;
+    m_headerSize = 0;
+    m_check = nullptr;
+}
+
+/**
+ * @brief Record a failure
+ *
+ * @param failure Kind of failure
+ * @param error Message for the client
+ * @return false, for the caller to return
+ */
+auto ResumableUpload::fail(UploadFailure failure, const String& error) -> bool {
+    m_failure = failure;
+    m_error = error;
+
+    return false;
+}
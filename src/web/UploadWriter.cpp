@@ -0,0 +1,279 @@
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <Logger.h>
+#include <cstring>
+
+#include "web/UploadWriter.h"
+
+static constexpr float BYTES_PER_KB = 1024.0F;
+static constexpr float MS_PER_S = 1000.0F;
+
+/**
+ * @brief Bytes in use on LittleFS
+ *
+ * @return used bytes, 0 if unknown
+ */
+static auto usedBytes() -> size_t {
+    FSInfo info;
+
+    return LittleFS.info(info) ? info.usedBytes : 0;
+}
+
+/**
+ * @brief Create the temporary file and allocate the staging buffer
+ *
+ * @param path File to write
+ * @param expectedSize Size announced by the client (Content-Length), 0 if unknown, refused early if it cannot fit
+ * @param headerSize Bytes handed to check before the first write to the file system, at most BUFFER_SIZE
+ * @param check Header check, nullptr to accept any content
+ * @return true if the upload can start
+ */
+auto UploadWriter::begin(const String& path, size_t expectedSize, size_t headerSize, THeaderCheck check) -> bool {
+    if (m_file) {
+        abort();
+    }
+
+    release();
+    m_path = path;
+    m_tempPath = path + TEMP_SUFFIX;
+    m_check = std::move(check);
+    m_headerSize = std::min(headerSize, BUFFER_SIZE);
+    m_failure = UploadFailure::None;
+    m_error = String();
+    m_stats = UploadStats();
+    m_startMs = millis();
+
+    // the previous file stays until the rename, both have to fit
+    FSInfo info;
+    if (expectedSize > 0 && LittleFS.info(info) && expectedSize > info.totalBytes - info.usedBytes) {
+        Logger::error((String("Not enough space for ") + path + " (" + String(expectedSize) + " bytes)").c_str(),
+                      "UploadWriter");
+
+        return fail(UploadFailure::NoSpace, "Not enough space on the file system");
+    }
+
+    m_buffer.reset(new (std::nothrow) uint8_t[BUFFER_SIZE]);
+    if (!m_buffer) {
+        Logger::error("Cannot allocate the upload buffer", "UploadWriter");
+
+        return fail(UploadFailure::WriteFailed, "Out of memory");
+    }
+
+    m_file = LittleFS.open(m_tempPath, "w");
+    if (!m_file) {
+        Logger::error((String("Cannot open ") + m_tempPath).c_str(), "UploadWriter");
+        release();
+
+        return fail(UploadFailure::WriteFailed, "Cannot create the file");
+    }
+
+    m_usedBefore = usedBytes();
+
+    return true;
+}
+
+/**
+ * @brief Append data, the file system is written each time the staging buffer is full
+ *
+ * @param data Bytes to append
+ * @param len Number of bytes
+ * @return false if a write failed, the upload should then be aborted
+ */
+auto UploadWriter::write(const uint8_t* data, size_t len) -> bool {
+    if (!m_file) {
+        return false;
+    }
+
+    while (len > 0) {
+        size_t take = std::min(len, BUFFER_SIZE - m_fill);
+        memcpy(m_buffer.get() + m_fill, data, take);
+        m_fill += take;
+        data += take;
+        len -= take;
+        m_stats.bytes += take;
+
+        if (!checkHeader(false)) {
+            abort();
+
+            return false;
+        }
+
+        if (m_fill == BUFFER_SIZE && !flush()) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Write the staged tail, close the file, rename it over the target and compute the statistics
+ *
+ * @return true if every byte reached the file and it replaced the target, the temporary file is removed otherwise
+ */
+auto UploadWriter::finish() -> bool {
+    if (!m_file) {
+        return false;
+    }
+
+    // a file shorter than its header never reached the check
+    if (!checkHeader(true)) {
+        abort();
+
+        return false;
+    }
+
+    bool writeOk = flush();
+    m_file.close();
+
+    m_stats.elapsedMs = millis() - m_startMs;
+    m_stats.kbps = m_stats.elapsedMs > 0 ? static_cast<float>(m_stats.bytes) / BYTES_PER_KB * MS_PER_S /
+                                               static_cast<float>(m_stats.elapsedMs)
+                                         : 0.0F;
+
+    // growth of the used space before the old file is released: the sectors the new file occupies, not a count of
+    // erases (LittleFS also erases for metadata and on block reuse, and the flash driver reports no erase counter)
+    const size_t usedAfter = usedBytes();
+    const size_t grown = usedAfter > m_usedBefore ? usedAfter - m_usedBefore : 0;
+    m_stats.sectorsUsed = static_cast<uint32_t>((grown + SECTOR_SIZE - 1) / SECTOR_SIZE);
+
+    // LittleFS renames over an existing file in one commit, readers see the old file or the new one
+    if (writeOk && !LittleFS.rename(m_tempPath, m_path)) {
+        Logger::error((String("Cannot rename ") + m_tempPath + " to " + m_path).c_str(), "UploadWriter");
+        writeOk = fail(UploadFailure::WriteFailed, "Cannot replace the file");
+    }
+
+    if (!writeOk) {
+        LittleFS.remove(m_tempPath);
+    }
+
+    release();
+
+    return writeOk;
+}
+
+/**
+ * @brief Drop the upload and remove the temporary file, the target is left untouched
+ *
+ * @return void
+ */
+auto UploadWriter::abort() -> void {
+    if (m_file) {
+        m_file.close();
+    }
+
+    if (!m_tempPath.isEmpty() && LittleFS.exists(m_tempPath) && !LittleFS.remove(m_tempPath)) {
+        Logger::error((String("Failed to remove incomplete file: ") + m_tempPath).c_str(), "UploadWriter");
+    }
+
+    release();
+}
+
+/**
+ * @brief Whether an upload is in progress
+ *
+ * @return true between begin() and finish() or abort()
+ */
+auto UploadWriter::isOpen() const -> bool { return static_cast<bool>(m_file); }
+
+/**
+ * @brief File being written, or last written
+ *
+ * @return path given to begin()
+ */
+auto UploadWriter::getPath() const -> const String& { return m_path; }
+
+/**
+ * @brief Statistics of the last finished upload
+ *
+ * @return bytes, duration, throughput in KiB/s, file system writes and sectors taken (from the change of used space)
+ */
+auto UploadWriter::getStats() const -> UploadStats { return m_stats; }
+
+/**
+ * @brief Why the last upload failed
+ *
+ * @return None if it succeeded or is still running
+ */
+auto UploadWriter::getFailure() const -> UploadFailure { return m_failure; }
+
+/**
+ * @brief Message of the last failure, for the client
+ *
+ * @return message, empty without failure
+ */
+auto UploadWriter::getError() const -> const String& { return m_error; }
+
+/**
+ * @brief Run the header check once enough bytes are staged, before any of them is written
+ *
+ * @param complete true at the end of the upload, the check then runs on whatever was received
+ * @return false if the content was rejected
+ */
+auto UploadWriter::checkHeader(bool complete) -> bool {
+    if (!m_check || (!complete && m_fill < m_headerSize)) {
+        return true;
+    }
+
+    String error;
+    const bool accepted = m_check(m_buffer.get(), m_fill, error);
+    m_check = nullptr;
+
+    if (!accepted) {
+        Logger::error((String("Rejected ") + m_path + ": " + error).c_str(), "UploadWriter");
+
+        return fail(UploadFailure::Rejected, error);
+    }
+
+    return true;
+}
+
+/**
+ * @brief Record a failure
+ *
+ * @param failure Kind of failure
+ * @param error Message for the client
+ * @return false, for the caller to return
+ */
+auto UploadWriter::fail(UploadFailure failure, const String& error) -> bool {
+    m_failure = failure;
+    m_error = error;
+
+    return false;
+}
+
+/**
+ * @brief Write the staged bytes to the file
+ *
+ * @return true if all were written
+ */
+auto UploadWriter::flush() -> bool {
+    if (m_fill == 0) {
+        return true;
+    }
+
+    size_t written = m_file.write(m_buffer.get(), m_fill);
+    m_stats.writes++;
+
+    if (written != m_fill) {
+        Logger::error((String("Short write to ") + m_tempPath).c_str(), "UploadWriter");
+        m_fill = 0;
+
+        return fail(UploadFailure::WriteFailed, "Write to the file system failed");
+    }
+
+    m_fill = 0;
+
+    return true;
+}
+
+/**
+ * @brief Free the staging buffer between uploads
+ *
+ * @return void
+ */
+auto UploadWriter::release() -> void {
+    m_buffer.reset();
+    m_check = nullptr;
+    m_fill = 0;
+}
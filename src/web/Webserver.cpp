@@ -1,9 +1,9 @@
 #include <Arduino.h>
-#include <ESP8266WebServer.h>
 #include <LittleFS.h>
 #include <functional>
 #include <Logger.h>
 
+#include "web/WebAssets.h"
 #include "web/Webserver.h"
 
 /**
@@ -46,10 +46,11 @@ void Webserver::begin() {
 
 /**
  * @brief Handles incoming client requests
+ * @param budgetUs Time the server may spend before returning, checked between parsing steps
  *
  * @return void
  */
-void Webserver::handleClient() { _server.handleClient(); }
+void Webserver::handleClient(uint32_t budgetUs) { _server.handleClient(budgetUs); }
 
 /**
  * @brief Register a handler for a route
@@ -87,29 +88,26 @@ void Webserver::on(const String& uri, std::function<void()> handler) {
 void Webserver::serveStatic(const String& uri, const String& path, const String& contentType, int cacheSeconds,
                             bool tryGzip) {
     _server.on(uri.c_str(), HTTP_GET, [this, path, contentType, cacheSeconds, tryGzip, uri]() {
-        String fsPath = path;
+        String servePath = path;
         String enc = "";
-        String servePath = fsPath;
+        File f;
 
+        // opening is the existence check, a missing .gz costs one lookup instead of two
         if (tryGzip) {
-            String gzPath = fsPath + String(".gz");
-            if (LittleFS.exists(gzPath)) {
-                servePath = gzPath;
+            f = LittleFS.open(path + String(".gz"), "r");
+            if (f) {
+                servePath = path + String(".gz");
                 enc = "gzip";
             }
         }
 
-        if (!LittleFS.exists(servePath)) {
-            Logger::error(("File not found: " + servePath).c_str(), "Webserver");
-            _server.send(HTTP_CODE_NOT_FOUND, "text/plain", "Not found");
-
-            return;
+        if (!f) {
+            f = LittleFS.open(path, "r");
         }
 
-        File f = LittleFS.open(servePath, "r");
         if (!f) {
-            Logger::error(("Failed to open file: " + servePath).c_str(), "Webserver");
-            _server.send(HTTP_CODE_INTERNAL_ERROR, "text/plain", "Open failed");
+            Logger::error(("File not found: " + servePath).c_str(), "Webserver");
+            _server.send(HTTP_CODE_NOT_FOUND, "text/plain", "Not found");
 
             return;
         }
@@ -117,7 +115,7 @@ void Webserver::serveStatic(const String& uri, const String& path, const String&
         size_t size = f.size();
 
         String ct = contentType;
-        if (ct.length() == 0) ct = guessContentType(fsPath);
+        if (ct.length() == 0) ct = guessContentType(path);
 
         if (cacheSeconds > 0) {
             _server.sendHeader("Cache-Control", String("public, max-age=") + String(cacheSeconds));
@@ -130,13 +128,46 @@ void Webserver::serveStatic(const String& uri, const String& path, const String&
         }
 
         _server.setContentLength(size);
+        // not closed here: the server keeps the handle and streams the file from the main loop
         _server.streamFile(f, ct);
-        f.close();
 
         Logger::info(("Served " + servePath + " for URI: " + uri).c_str(), "Webserver");
     });
 }
 
+/**
+ * @brief Serve the web UI compiled into the firmware by scripts/web_bundle.py
+ *
+ * Every asset is a GET route answered from flash with its gzip bytes and a strong ETag. The browser revalidates on
+ * each load (no-cache) and gets an empty 304 while the firmware, hence the ETag, is unchanged
+ *
+ * @return void
+ */
+void Webserver::serveBundle() {
+    _server.collectHeader("If-None-Match");
+
+    for (const WebAsset& asset : WEB_ASSETS) {
+        _server.on(asset.uri, HTTP_GET, [this, &asset]() {
+            _server.sendHeader("ETag", asset.etag);
+            _server.sendHeader("Cache-Control", "no-cache");
+
+            String match = _server.header("If-None-Match");
+            if (match == "*" || match.indexOf(asset.etag) >= 0) {
+                _server.send(HTTP_CODE_NOT_MODIFIED, nullptr, "");
+
+                return;
+            }
+
+            _server.sendHeader("Content-Encoding", "gzip");
+            _server.send_P(HTTP_CODE_OK, asset.contentType, asset.data, asset.size);
+        });
+    }
+
+    Logger::info((String("Serving ") + String(sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0])) + " web assets from flash")
+                     .c_str(),
+                 "Webserver");
+}
+
 /**
  * @brief Simple notFound handler registration
  * @param handler The function to call when a route is not found
@@ -150,9 +181,9 @@ void Webserver::onNotFound(std::function<void()> handler) {
 /**
  * @brief Expose underlying server where advanced config is needed
  *
- * @return reference to the underlying ESP8266WebServer
+ * @return reference to the underlying HttpServer
  */
-auto Webserver::raw() -> ESP8266WebServer& { return _server; }
+auto Webserver::raw() -> HttpServer& { return _server; }
 
 /**
  * @brief Guess the content type based on the file extension
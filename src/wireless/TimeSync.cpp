@@ -0,0 +1,44 @@
+#include <Logger.h>
+
+#include "wireless/TimeSync.h"
+
+// Anything before 2024-01-01 means SNTP has not answered yet (the RTC starts at 1970 on boot)
+static constexpr time_t TIME_SYNC_MIN_EPOCH = 1704067200;
+
+/**
+ * @brief Start SNTP, the core polls the server in the background (once per hour by default)
+ *
+ * @param server NTP server name or IP, the string must outlive the sync (the core keeps the pointer)
+ * @param timezone POSIX TZ string, e.g. "CET-1CEST,M3.5.0,M10.5.0/3"
+ */
+auto TimeSync::begin(const char* server, const char* timezone) -> void {
+    configTime(timezone, server);
+
+    Logger::info((String("SNTP started with ") + server + ", TZ " + timezone).c_str(), "TimeSync");
+}
+
+/**
+ * @brief Check whether the system clock has been set by SNTP
+ *
+ * @return true once a valid time has been received
+ */
+auto TimeSync::isSynced() -> bool { return time(nullptr) >= TIME_SYNC_MIN_EPOCH; }
+
+/**
+ * @brief Current local time
+ *
+ * @param out Receives the broken down local time
+ *
+ * @return false if the time is not synchronised yet
+ */
+auto TimeSync::getLocalTime(struct tm& out) -> bool {
+    const time_t now = time(nullptr);
+
+    if (now < TIME_SYNC_MIN_EPOCH) {
+        return false;
+    }
+
+    localtime_r(&now, &out);
+
+    return true;
+}
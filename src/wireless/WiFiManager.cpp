@@ -52,6 +52,7 @@ auto WiFiManager::startStationMode() -> bool {
 
     if (WiFi.status() == WL_CONNECTED) {
         _apMode = false;
+        _connected = true;
         return true;
     }
 
@@ -72,6 +73,29 @@ auto WiFiManager::startAccessPointMode() -> bool {
     return true;
 }
 
+/**
+ * @brief Station mode housekeeping: report when the link drops and comes back, the SDK reconnects on its own
+ *
+ * @return void
+ */
+auto WiFiManager::update() -> void {
+    if (_apMode) {
+        return;
+    }
+
+    bool connected = WiFi.status() == WL_CONNECTED;
+    if (connected == _connected) {
+        return;
+    }
+
+    _connected = connected;
+    if (connected) {
+        Logger::info(("Reconnected, IP : " + WiFi.localIP().toString()).c_str(), "WiFiManager");
+    } else {
+        Logger::warn("Connection lost", "WiFiManager");
+    }
+}
+
 auto WiFiManager::isApMode() const -> bool { return _apMode; }
 
 auto WiFiManager::getIP() const -> IPAddress { return _apMode ? WiFi.softAPIP() : WiFi.localIP(); }
@@ -0,0 +1,212 @@
+#include <unity.h>
+
+#include <chrono>
+#include <cstdio>
+#include <initializer_list>
+
+#include "display/Blend565.h"
+
+static constexpr size_t LINE = 240;
+static constexpr uint8_t MID_ALPHA = 16;
+
+/**
+ * @brief Per channel reference of Blend565::blend, the kernels must match it bit for bit
+ */
+static auto referenceBlend(uint16_t from, uint16_t to, uint8_t alpha) -> uint16_t {
+    const uint32_t inv = Blend565::ALPHA_MAX - alpha;
+    const uint32_t red = ((((from >> 11) & 0x1FU) * inv) + (((to >> 11) & 0x1FU) * alpha)) >> 5;
+    const uint32_t green = ((((from >> 5) & 0x3FU) * inv) + (((to >> 5) & 0x3FU) * alpha)) >> 5;
+    const uint32_t blue = (((from & 0x1FU) * inv) + ((to & 0x1FU) * alpha)) >> 5;
+
+    return static_cast<uint16_t>((red << 11) | (green << 5) | blue);
+}
+
+/**
+ * @brief Deterministic test pixels covering every channel value
+ */
+static auto testPixel(size_t index, uint32_t seed) -> uint16_t {
+    uint32_t value = (static_cast<uint32_t>(index) + 1U) * 2654435761U ^ seed;
+    value ^= value >> 15;
+
+    return static_cast<uint16_t>(value);
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_blend_endpoints() {
+    for (uint32_t color = 0; color <= 0xFFFFU; color += 7) {
+        const auto from = static_cast<uint16_t>(color);
+        const auto to = static_cast<uint16_t>(~color);
+
+        TEST_ASSERT_EQUAL_HEX16(from, Blend565::blend(from, to, 0));
+        TEST_ASSERT_EQUAL_HEX16(to, Blend565::blend(from, to, Blend565::ALPHA_MAX));
+    }
+}
+
+void test_blend_matches_reference() {
+    for (uint8_t alpha = 0; alpha <= Blend565::ALPHA_MAX; alpha++) {
+        for (size_t i = 0; i < 4096; i++) {
+            const uint16_t from = testPixel(i, 0x1234U);
+            const uint16_t to = testPixel(i, 0xBEEFU);
+
+            TEST_ASSERT_EQUAL_HEX16(referenceBlend(from, to, alpha), Blend565::blend(from, to, alpha));
+        }
+    }
+}
+
+void test_blend_midpoint() {
+    // white over black at half weight: every channel halves, rounding down
+    TEST_ASSERT_EQUAL_HEX16(0x7BEF, Blend565::blend(0x0000, 0xFFFF, MID_ALPHA));
+    TEST_ASSERT_EQUAL_HEX16(0x7800, Blend565::blend(0xF800, 0x0000, MID_ALPHA));
+    TEST_ASSERT_EQUAL_HEX16(0x03E0, Blend565::blend(0x0000, 0x07E0, MID_ALPHA));
+    TEST_ASSERT_EQUAL_HEX16(0x000F, Blend565::blend(0x001F, 0x0000, MID_ALPHA));
+}
+
+void test_blend_pair_matches_single() {
+    for (uint8_t alpha = 0; alpha <= Blend565::ALPHA_MAX; alpha++) {
+        for (size_t i = 0; i < 1024; i += 2) {
+            const uint32_t from = testPixel(i, 1U) | (static_cast<uint32_t>(testPixel(i + 1, 1U)) << 16);
+            const uint32_t to = testPixel(i, 2U) | (static_cast<uint32_t>(testPixel(i + 1, 2U)) << 16);
+            const uint32_t pair = Blend565::blendPair(from, to, alpha);
+
+            TEST_ASSERT_EQUAL_HEX16(referenceBlend(from & 0xFFFFU, to & 0xFFFFU, alpha), pair & 0xFFFFU);
+            TEST_ASSERT_EQUAL_HEX16(referenceBlend(from >> 16, to >> 16, alpha), pair >> 16);
+        }
+    }
+}
+
+void test_crossfade_odd_widths() {
+    alignas(4) uint16_t from[LINE + 2];
+    alignas(4) uint16_t to[LINE + 2];
+    alignas(4) uint16_t out[LINE + 2];
+
+    for (size_t i = 0; i < LINE + 2; i++) {
+        from[i] = testPixel(i, 3U);
+        to[i] = testPixel(i, 4U);
+    }
+
+    for (size_t count : {size_t{1}, size_t{3}, size_t{7}, LINE - 1, LINE}) {
+        for (uint8_t alpha : {uint8_t{0}, uint8_t{5}, MID_ALPHA, uint8_t{31}, Blend565::ALPHA_MAX}) {
+            for (auto& pixel : out) {
+                pixel = 0xA5A5;
+            }
+
+            Blend565::crossfade(out, from, to, count, alpha);
+
+            for (size_t i = 0; i < count; i++) {
+                TEST_ASSERT_EQUAL_HEX16(referenceBlend(from[i], to[i], alpha), out[i]);
+            }
+            TEST_ASSERT_EQUAL_HEX16(0xA5A5, out[count]);
+        }
+    }
+}
+
+void test_crossfade_in_place() {
+    alignas(4) uint16_t line[LINE];
+    alignas(4) uint16_t to[LINE];
+
+    for (size_t i = 0; i < LINE; i++) {
+        line[i] = testPixel(i, 5U);
+        to[i] = testPixel(i, 6U);
+    }
+
+    alignas(4) uint16_t expected[LINE];
+    for (size_t i = 0; i < LINE; i++) {
+        expected[i] = referenceBlend(line[i], to[i], 9);
+    }
+
+    Blend565::crossfade(line, line, to, LINE, 9);
+
+    TEST_ASSERT_EQUAL_HEX16_ARRAY(expected, line, LINE);
+}
+
+void test_wipe_and_dissolve_endpoints() {
+    alignas(4) uint16_t from[LINE];
+    alignas(4) uint16_t to[LINE];
+    alignas(4) uint16_t out[LINE];
+
+    for (size_t i = 0; i < LINE; i++) {
+        from[i] = 0x1111;
+        to[i] = 0x2222;
+    }
+
+    Blend565::wipe(out, from, to, LINE - 1, 100);
+    TEST_ASSERT_EQUAL_HEX16(0x2222, out[99]);
+    TEST_ASSERT_EQUAL_HEX16(0x1111, out[100]);
+    TEST_ASSERT_EQUAL_HEX16(0x1111, out[LINE - 2]);
+
+    for (uint16_t row = 0; row < 4; row++) {
+        Blend565::dissolve(out, from, to, LINE - 1, row, 0);
+        TEST_ASSERT_EQUAL_HEX16_ARRAY(from, out, LINE - 1);
+
+        Blend565::dissolve(out, from, to, LINE - 1, row, Blend565::DISSOLVE_LEVELS);
+        TEST_ASSERT_EQUAL_HEX16_ARRAY(to, out, LINE - 1);
+    }
+
+    // half way, 8 of every 16 pixels of a 4x4 tile come from the incoming line
+    size_t incoming = 0;
+    for (uint16_t row = 0; row < 4; row++) {
+        Blend565::dissolve(out, from, to, 4, row, Blend565::DISSOLVE_LEVELS / 2);
+        for (size_t i = 0; i < 4; i++) {
+            incoming += out[i] == 0x2222 ? 1 : 0;
+        }
+    }
+    TEST_ASSERT_EQUAL_UINT32(8, incoming);
+}
+
+/**
+ * @brief Time of one 240 px crossfade line, printed only: the host compiler vectorises the per channel loop, the
+ * comparison that matters is the one on the LX106, which has no SIMD
+ */
+void test_crossfade_line_time() {
+    static constexpr int RUNS = 20000;
+    alignas(4) uint16_t from[LINE];
+    alignas(4) uint16_t to[LINE];
+    alignas(4) uint16_t out[LINE];
+    uint32_t checksum = 0;
+
+    for (size_t i = 0; i < LINE; i++) {
+        from[i] = testPixel(i, 7U);
+        to[i] = testPixel(i, 8U);
+    }
+
+    const auto swarStart = std::chrono::steady_clock::now();
+    for (int run = 0; run < RUNS; run++) {
+        Blend565::crossfade(out, from, to, LINE, static_cast<uint8_t>(run & 31));
+        checksum += out[run % LINE];
+    }
+    const auto swarEnd = std::chrono::steady_clock::now();
+
+    for (int run = 0; run < RUNS; run++) {
+        for (size_t i = 0; i < LINE; i++) {
+            out[i] = referenceBlend(from[i], to[i], static_cast<uint8_t>(run & 31));
+        }
+        checksum += out[run % LINE];
+    }
+    const auto scalarEnd = std::chrono::steady_clock::now();
+
+    const auto nsPerLine = [](std::chrono::steady_clock::duration elapsed) -> double {
+        return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) / RUNS;
+    };
+
+    char message[128];
+    snprintf(message, sizeof(message), "240 px crossfade: %.0f ns/line SWAR, %.0f ns/line per channel (checksum %u)",
+             nsPerLine(swarEnd - swarStart), nsPerLine(scalarEnd - swarEnd), static_cast<unsigned>(checksum));
+    TEST_MESSAGE(message);
+}
+
+auto main() -> int {
+    UNITY_BEGIN();
+    RUN_TEST(test_blend_endpoints);
+    RUN_TEST(test_blend_matches_reference);
+    RUN_TEST(test_blend_midpoint);
+    RUN_TEST(test_blend_pair_matches_single);
+    RUN_TEST(test_crossfade_odd_widths);
+    RUN_TEST(test_crossfade_in_place);
+    RUN_TEST(test_wipe_and_dissolve_endpoints);
+    RUN_TEST(test_crossfade_line_time);
+
+    return UNITY_END();
+}
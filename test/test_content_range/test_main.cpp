@@ -0,0 +1,83 @@
+#include <unity.h>
+
+#include <initializer_list>
+
+#include "web/ContentRange.h"
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_parses_a_range() {
+    ContentRange range;
+
+    TEST_ASSERT_TRUE(ContentRange::parse("bytes 0-2047/10000", range));
+    TEST_ASSERT_EQUAL_UINT32(0, range.start);
+    TEST_ASSERT_EQUAL_UINT32(2048, range.end);
+    TEST_ASSERT_EQUAL_UINT32(10000, range.total);
+
+    TEST_ASSERT_TRUE(ContentRange::parse("bytes 8192-9999/10000", range));
+    TEST_ASSERT_EQUAL_UINT32(8192, range.start);
+    TEST_ASSERT_EQUAL_UINT32(10000, range.end);
+    TEST_ASSERT_EQUAL_UINT32(10000, range.total);
+}
+
+void test_single_byte_range() {
+    ContentRange range;
+
+    TEST_ASSERT_TRUE(ContentRange::parse("bytes 0-0/1", range));
+    TEST_ASSERT_EQUAL_UINT32(0, range.start);
+    TEST_ASSERT_EQUAL_UINT32(1, range.end);
+    TEST_ASSERT_EQUAL_UINT32(1, range.total);
+}
+
+void test_rejects_bounds_out_of_order() {
+    ContentRange range;
+
+    TEST_ASSERT_FALSE(ContentRange::parse("bytes 10-9/100", range));   // last before first
+    TEST_ASSERT_FALSE(ContentRange::parse("bytes 0-100/100", range));  // last past the end
+    TEST_ASSERT_FALSE(ContentRange::parse("bytes 0-0/0", range));
+}
+
+void test_rejects_malformed_headers() {
+    ContentRange range;
+
+    for (const char* value : {"", "bytes", "bytes ", "0-9/10", "bits 0-9/10", "bytes 0-9", "bytes 0/10", "bytes -9/10",
+                              "bytes 0-/10", "bytes 0-9/", "bytes 0-9/*", "bytes */10", "bytes a-9/10", "bytes 0-9/10 ",
+                              "bytes 0-9/10x", "bytes +0-9/10", "bytes 0 -9/10", "Bytes 0-9/10"}) {
+        TEST_ASSERT_FALSE_MESSAGE(ContentRange::parse(value, range), value);
+    }
+
+    TEST_ASSERT_FALSE(ContentRange::parse(nullptr, range));
+}
+
+void test_rejects_overflowing_numbers() {
+    ContentRange range;
+
+    TEST_ASSERT_FALSE(ContentRange::parse("bytes 0-9/99999999999999999999999", range));
+    TEST_ASSERT_FALSE(ContentRange::parse("bytes 99999999999999999999999-0/10", range));
+}
+
+void test_failed_parse_keeps_the_range() {
+    ContentRange range;
+    range.start = 1;
+    range.end = 2;
+    range.total = 3;
+
+    TEST_ASSERT_FALSE(ContentRange::parse("bytes 5-4/10", range));
+    TEST_ASSERT_EQUAL_UINT32(1, range.start);
+    TEST_ASSERT_EQUAL_UINT32(2, range.end);
+    TEST_ASSERT_EQUAL_UINT32(3, range.total);
+}
+
+auto main() -> int {
+    UNITY_BEGIN();
+    RUN_TEST(test_parses_a_range);
+    RUN_TEST(test_single_byte_range);
+    RUN_TEST(test_rejects_bounds_out_of_order);
+    RUN_TEST(test_rejects_malformed_headers);
+    RUN_TEST(test_rejects_overflowing_numbers);
+    RUN_TEST(test_failed_parse_keeps_the_range);
+
+    return UNITY_END();
+}
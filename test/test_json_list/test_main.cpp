@@ -0,0 +1,102 @@
+#include <unity.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "web/JsonListWriter.h"
+
+/**
+ * @brief Output collecting what the writer prints, stands in for an Arduino Print
+ */
+struct StringOut {
+    std::string text;
+
+    auto print(const char* value) -> void { text += value; }
+    auto print(char value) -> void { text += value; }
+};
+
+/**
+ * @brief Stream a list the way sendJsonList() does, items and cursors given as already serialised strings
+ */
+static auto streamList(const char* head, const std::vector<std::string>& items, size_t limit) -> std::string {
+    JsonListWriter writer(head, "files", limit);
+    StringOut out;
+    size_t index = 0;
+
+    writer.writeHead(out);
+
+    for (;;) {
+        const bool hasItem = index < items.size();
+        const std::string cursor = std::to_string(index);
+
+        if (hasItem && writer.beginItem(out, cursor.c_str())) {
+            out.print(items[index++].c_str());
+            continue;
+        }
+
+        writer.writeEnd(out, hasItem);
+
+        return out.text;
+    }
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_complete_list() {
+    TEST_ASSERT_EQUAL_STRING("{\"files\":[{\"a\":1},{\"a\":2}],\"next\":null}",
+                             streamList("{}", {"{\"a\":1}", "{\"a\":2}"}, SIZE_MAX).c_str());
+}
+
+void test_empty_list() {
+    TEST_ASSERT_EQUAL_STRING("{\"files\":[],\"next\":null}", streamList("{}", {}, SIZE_MAX).c_str());
+}
+
+void test_head_members_come_first() {
+    TEST_ASSERT_EQUAL_STRING("{\"total\":3,\"used\":1,\"files\":[1],\"next\":null}",
+                             streamList("{\"total\":3,\"used\":1}", {"1"}, SIZE_MAX).c_str());
+}
+
+void test_head_that_is_not_an_object() {
+    TEST_ASSERT_EQUAL_STRING("{\"files\":[1],\"next\":null}", streamList("null", {"1"}, SIZE_MAX).c_str());
+    TEST_ASSERT_EQUAL_STRING("{\"files\":[1],\"next\":null}", streamList("", {"1"}, SIZE_MAX).c_str());
+    TEST_ASSERT_EQUAL_STRING("{\"files\":[1],\"next\":null}", streamList(nullptr, {"1"}, SIZE_MAX).c_str());
+}
+
+void test_limit_cuts_the_list_with_a_cursor() {
+    TEST_ASSERT_EQUAL_STRING("{\"files\":[10,11],\"next\":\"1\"}",
+                             streamList("{}", {"10", "11", "12", "13"}, 2).c_str());
+}
+
+void test_limit_equal_to_the_length_completes_the_list() {
+    TEST_ASSERT_EQUAL_STRING("{\"files\":[10,11],\"next\":null}", streamList("{}", {"10", "11"}, 2).c_str());
+}
+
+void test_cursor_is_escaped() {
+    JsonListWriter writer("{}", "files", 1);
+    StringOut out;
+
+    writer.writeHead(out);
+    TEST_ASSERT_TRUE(writer.beginItem(out, "/gif/a \"b\"\\c\n\xC3\xA9.gif"));
+    out.print("1");
+    TEST_ASSERT_FALSE(writer.beginItem(out, "/gif/next.gif"));
+    writer.writeEnd(out, true);
+
+    TEST_ASSERT_EQUAL_STRING("{\"files\":[1],\"next\":\"/gif/a \\\"b\\\"\\\\c\\u000a\xC3\xA9.gif\"}", out.text.c_str());
+    TEST_ASSERT_EQUAL_UINT32(1, writer.count());
+}
+
+auto main() -> int {
+    UNITY_BEGIN();
+    RUN_TEST(test_complete_list);
+    RUN_TEST(test_empty_list);
+    RUN_TEST(test_head_members_come_first);
+    RUN_TEST(test_head_that_is_not_an_object);
+    RUN_TEST(test_limit_cuts_the_list_with_a_cursor);
+    RUN_TEST(test_limit_equal_to_the_length_completes_the_list);
+    RUN_TEST(test_cursor_is_escaped);
+
+    return UNITY_END();
+}
@@ -0,0 +1,143 @@
+#include <unity.h>
+
+#include <memory>
+#include <thread>
+
+#include "system/SpscRing.h"
+
+static constexpr size_t RING_SIZE = 8;
+static constexpr uint32_t THREAD_COUNT = 200000;
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_empty_ring_pops_nothing() {
+    SpscRing<int, RING_SIZE> ring;
+    int value = -1;
+
+    TEST_ASSERT_FALSE(ring.pop(value));
+    TEST_ASSERT_EQUAL_INT(-1, value);
+    TEST_ASSERT_TRUE(ring.empty());
+    TEST_ASSERT_FALSE(ring.full());
+}
+
+void test_fifo_until_full() {
+    SpscRing<int, RING_SIZE> ring;
+
+    for (int i = 0; i < static_cast<int>(RING_SIZE); ++i) {
+        TEST_ASSERT_FALSE(ring.full());
+        TEST_ASSERT_TRUE(ring.push(i));
+    }
+
+    TEST_ASSERT_TRUE(ring.full());
+    TEST_ASSERT_FALSE(ring.empty());
+    TEST_ASSERT_FALSE(ring.push(99));
+
+    int value = -1;
+
+    for (int i = 0; i < static_cast<int>(RING_SIZE); ++i) {
+        TEST_ASSERT_TRUE(ring.pop(value));
+        TEST_ASSERT_EQUAL_INT(i, value);
+    }
+
+    TEST_ASSERT_FALSE(ring.pop(value));
+}
+
+void test_order_kept_across_wraps() {
+    SpscRing<uint32_t, RING_SIZE> ring;
+    uint32_t next = 0;
+    uint32_t expected = 0;
+    uint32_t value = 0;
+
+    // uneven bursts so the head and tail meet at every slot
+    for (uint32_t round = 0; round < 1000; ++round) {
+        for (uint32_t i = 0; i <= round % RING_SIZE; ++i) {
+            TEST_ASSERT_TRUE(ring.push(next++));
+        }
+        while (ring.pop(value)) {
+            TEST_ASSERT_EQUAL_UINT32(expected++, value);
+        }
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(next, expected);
+}
+
+void test_pop_releases_the_slot() {
+    SpscRing<std::shared_ptr<int>, RING_SIZE> ring;
+    auto shared = std::make_shared<int>(7);
+
+    TEST_ASSERT_TRUE(ring.push(shared));
+    TEST_ASSERT_EQUAL_INT(2, shared.use_count());
+
+    std::shared_ptr<int> taken;
+
+    TEST_ASSERT_TRUE(ring.pop(taken));
+    TEST_ASSERT_EQUAL_INT(7, *taken);
+    taken.reset();
+    TEST_ASSERT_EQUAL_INT(1, shared.use_count());
+}
+
+void test_move_push_keeps_value_when_full() {
+    SpscRing<std::unique_ptr<int>, RING_SIZE> ring;
+
+    for (int i = 0; i < static_cast<int>(RING_SIZE); ++i) {
+        TEST_ASSERT_TRUE(ring.push(std::make_unique<int>(i)));
+    }
+
+    auto extra = std::make_unique<int>(99);
+
+    TEST_ASSERT_FALSE(ring.push(std::move(extra)));
+    TEST_ASSERT_NOT_NULL(extra.get());
+
+    std::unique_ptr<int> taken;
+
+    TEST_ASSERT_TRUE(ring.pop(taken));
+    TEST_ASSERT_EQUAL_INT(0, *taken);
+}
+
+void test_producer_and_consumer_threads() {
+    SpscRing<uint32_t, RING_SIZE> ring;
+    uint32_t received = 0;
+    uint32_t outOfOrder = 0;
+
+    std::thread consumer([&ring, &received, &outOfOrder]() {
+        uint32_t value = 0;
+
+        while (received < THREAD_COUNT) {
+            if (!ring.pop(value)) {
+                std::this_thread::yield();
+                continue;
+            }
+            if (value != received) {
+                outOfOrder++;
+            }
+            received++;
+        }
+    });
+
+    for (uint32_t i = 0; i < THREAD_COUNT;) {
+        if (ring.push(i)) {
+            ++i;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    consumer.join();
+
+    TEST_ASSERT_EQUAL_UINT32(THREAD_COUNT, received);
+    TEST_ASSERT_EQUAL_UINT32(0, outOfOrder);
+}
+
+auto main() -> int {
+    UNITY_BEGIN();
+    RUN_TEST(test_empty_ring_pops_nothing);
+    RUN_TEST(test_fifo_until_full);
+    RUN_TEST(test_order_kept_across_wraps);
+    RUN_TEST(test_pop_releases_the_slot);
+    RUN_TEST(test_move_push_keeps_value_when_full);
+    RUN_TEST(test_producer_and_consumer_threads);
+
+    return UNITY_END();
+}
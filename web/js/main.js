@@ -63,8 +63,10 @@ function gifUploadHandler() {
       this.uploadMessage = "";
       const file = this.$refs.fileInput.files[0];
 
-      if (!file || file.type !== "image/gif") {
-        this.uploadMessage = "Please select a GIF file";
+      const isQ565 = file && file.name.toLowerCase().endsWith(".q565");
+
+      if (!file || (file.type !== "image/gif" && !isQ565)) {
+        this.uploadMessage = "Please select a GIF or Q565 file";
         this.uploading = false;
 
         return;
@@ -118,37 +120,11 @@ function gifUploadHandler() {
   };
 }
 
-function includeHTML(id, url, callback) {
-  fetch(url)
-    .then((response) => response.text())
-    .then((data) => {
-      document.getElementById(id).innerHTML = data;
-      if (typeof callback === "function") callback();
-    });
-}
-
-function setHeaderTitle(title) {
-  const interval = setInterval(() => {
-    const h1 = document.getElementById("header-title");
-    if (h1) {
-      h1.textContent = title;
-      clearInterval(interval);
-    }
-  }, 20);
-}
-
 document.addEventListener("DOMContentLoaded", () => {
-  if (document.getElementById("header-placeholder")) {
-    includeHTML("header-placeholder", "./header.html", () => {
-      let pageTitle =
-        document.title && document.title.trim()
-          ? document.title.trim()
-          : "Placeholder Title";
-      setHeaderTitle(pageTitle);
-    });
-  }
-  if (document.getElementById("footer-placeholder")) {
-    includeHTML("footer-placeholder", "./footer.html");
+  // header.html is included in the page by scripts/web_bundle.py
+  const h1 = document.getElementById("header-title");
+  if (h1 && document.title && document.title.trim()) {
+    h1.textContent = document.title.trim();
   }
 });
 